@@ -1,7 +1,41 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include "board.h"
+#include "board_stats.h"
+#include "board_backend.h"
+#include "search.h"
+#include "analysis.h"
+#include "repetition.h"
+
+// Nom de joueur qui confie ce joueur à l'ordinateur (voir search.h)
+#define BOT_NAME "ordi"
+// Temps de réflexion de l'ordinateur pour toute la partie, en millisecondes
+#define BOT_TIME_MS 120000
+// Taille de la table de transposition de chaque ordinateur
+#define BOT_TABLE_BYTES (64u << 20)
+
+// Moteur de chaque joueur joué par l'ordinateur (NULL pour un humain) et son temps restant
+static search_engine *bots[NB_PLAYERS + 1];
+static long bot_time[NB_PLAYERS + 1];
+// Base de positions analysées consultée par l'ordinateur avant de chercher (voir posdb.h), si le fichier existe
+#define BOT_DATABASE "positions.db"
+static posdb database;
+static bool database_open = false;
+
+// Durée de l'analyse qui prépare l'indice d'un joueur humain, en millisecondes
+#define HINT_TIME_MS 10000
+
+// Analyse du tour en cours pour la commande H (NULL si aucune)
+static analysis hint = NULL;
+// La recherche lit la structure du plateau de board.c : faux avec une autre implémentation
+static bool search_enabled = true;
+
+// Une position atteinte ce nombre de fois rend la partie nulle (0 pour jouer sans cette règle)
+#define DRAW_REPETITIONS REPETITION_DRAW
+// Positions atteintes depuis la fin du placement (tenu seulement avec board.c, comme la recherche)
+static repetition_history history;
 
 
 /// @brief Enumération des différents Etats du jeu
@@ -84,6 +118,9 @@ void display_board(board game, char *name_n, char *name_s)
         else if (lig == DIMENSION - 4) {
             printf("[U] : Undo / [C] : Cancel");
         }
+        else if (lig == DIMENSION - 5) {
+            printf("[H] : Indice");
+        }
         else if (lig == DIMENSION - 6) {
             printf("[s]wap / [r]ebond");
         }
@@ -364,7 +401,14 @@ void setup_pieces_game(board game, player p, char *name_n, char *name_s)
             break;
         }
 
-        if(p == NORTH_P)
+        if(bots[p] != NULL)
+        {
+            size taille;
+            search_placement(game, p, &taille, &column);
+            piece = taille;
+            printf("L'ordinateur place une pièce %d en colonne %d\n", piece, column + 1);
+        }
+        else if(p == NORTH_P)
         {
             printf("%s (NORD), numéro de la colonne", name_n); // Petit ajout perso
             column = saisir_coord(game, " : ", 1, DIMENSION, 1, p);
@@ -391,6 +435,13 @@ GameState state_setup(board game, player current_player, char *name_n, char *nam
 {
     setup_pieces_game(game, current_player, name_n, name_s);
 
+    //le joueur qui a posé en second commence : la partie part de cette position
+    repetition_clear(&history, DRAW_REPETITIONS);
+    if (search_enabled)
+    {
+        repetition_push(&history, repetition_key(game, next_player(current_player)));
+    }
+
     return STATE_TURN_START;
 }
 
@@ -399,9 +450,61 @@ GameState state_turn_start(board game, player *current_player, char *name_n, cha
 {
     *current_player = turn_manager(*current_player, name_n, name_s);
 
+    //analyse en arrière-plan du tour d'un humain, lue par la commande H
+    if (bots[*current_player] == NULL && search_enabled)
+    {
+        analysis_options options = { .time_ms = HINT_TIME_MS };
+        hint = analysis_start(game, *current_player, NULL, &options);
+    }
+
     return STATE_PLAYER_TURN;
 }
 
+/// @brief Affiche une case sous la forme (ligne,colonne), ou "le but"
+/// @param square numéro de la case, NO_SQUARE pour le but
+void print_square(int square)
+{
+    if (square == NO_SQUARE) {
+        printf("le but");
+    } else {
+        printf("(%d,%d)", square / DIMENSION + 1, square % DIMENSION + 1);
+    }
+}
+
+/// @brief Affiche un tour : pièce prise, arrivée et échange
+/// @param t le tour
+void print_turn(const turn *t)
+{
+    printf("pièce ");
+    print_square(t->from);
+    printf(" vers ");
+    print_square(t->to);
+    if (t->swap_to != NO_SQUARE) {
+        printf(", échange vers ");
+        print_square(t->swap_to);
+    }
+}
+
+/// @brief Affiche le meilleur tour trouvé jusqu'ici par l'analyse du tour en cours
+void print_hint()
+{
+    search_result result;
+    bool running = analysis_poll(hint, &result);
+
+    if (result.depth == 0) {
+        printf("L'analyse n'a encore rien trouvé, réessayez.\n");
+        return;
+    }
+    printf("Indice : ");
+    print_turn(&result.best);
+    printf("\n(profondeur %d, score %d%s)\n", result.depth, result.score, running ? ", analyse en cours" : "");
+    if (result.pv_length > 1) {
+        printf("Réponse attendue : ");
+        print_turn(&result.pv[1]);
+        printf("\n");
+    }
+}
+
 /// @brief Etat du tour du joueur pick de pièce, déplacement et tout action
 /// @param game plateau de jeu
 /// @param current_player joueur qui joue
@@ -442,6 +545,9 @@ GameState state_player_turn(board game, player *current_player, char *name_n, ch
         printf("N / S / O / E : déplacer la pièce\n");
         printf("U : annuler le dernier pas\n");
         printf("C : annuler tout le mouvement\n");
+        if (hint != NULL) {
+            printf("H : indice\n");
+        }
         if (is_move_possible(game, GOAL)) {
             printf("G : aller vers le but\n");
         }
@@ -474,6 +580,11 @@ GameState state_player_turn(board game, player *current_player, char *name_n, ch
             return STATE_PLAYER_TURN;
         }
 
+        if (cmd == 'H' && hint != NULL) {
+            print_hint();
+            continue;
+        }
+
         if (cmd == 'G') {
             if (!is_move_possible(game, GOAL)) {
                 printf("Impossible d'aller au but maintenant.\n");
@@ -564,6 +675,57 @@ GameState state_player_turn(board game, player *current_player, char *name_n, ch
     return STATE_PLAYER_TURN;
 }
 
+/// @brief Etat du tour joué par l'ordinateur : recherche du tour, puis réflexion pendant le tour de l'adversaire
+/// @param game plateau de jeu
+/// @param current_player joueur qui joue
+/// @return prochain etat du jeu
+GameState state_bot_turn(board game, player *current_player, char *name_n, char *name_s)
+{
+    player p = *current_player;
+    search_limits limits = { .time_ms = bot_time[p] };
+    search_result result;
+
+    display_board(game, name_n, name_s);
+    printf("L'ordinateur réfléchit...\n");
+
+    search_set_history(bots[p], &history);
+    if (!search_best_turn(bots[p], game, p, &limits, &result)) {
+        printf("L'ordinateur ne peut plus jouer : il abandonne.\n");
+        return STATE_GAME_OVER;
+    }
+    bot_time[p] -= result.time_ms;
+    if (bot_time[p] < 0) {
+        bot_time[p] = 0;
+    }
+
+    play_turn(game, p, &result.best);
+
+    printf("L'ordinateur joue la ");
+    print_turn(&result.best);
+    printf("\n(profondeur %d, score %d, %ld ms%s)\n", result.depth, result.score, result.time_ms,
+           result.ponder_hit ? ", réflexion reprise" : "");
+
+    //l'ordinateur réfléchit pendant que l'humain saisit son tour
+    if (get_winner(game) == NO_PLAYER && bots[next_player(p)] == NULL) {
+        search_ponder_start(bots[p], game, p);
+    }
+
+    return STATE_END_TURN;
+}
+
+/// @brief Confie un joueur à l'ordinateur si son nom est BOT_NAME
+/// @param p le joueur
+/// @param name son nom
+/// @return false si la mémoire manque
+bool init_bot(player p, const char *name)
+{
+    if (strcmp(name, BOT_NAME) != 0) {
+        return true;
+    }
+    bots[p] = search_create(BOT_TABLE_BYTES);
+    bot_time[p] = BOT_TIME_MS;
+    return bots[p] != NULL;
+}
 
 /// @brief Etat de fin de tour qui test si le jeu est fini ou non 
 /// @param game plateau de jeu
@@ -573,6 +735,9 @@ GameState state_end_turn(board game, player *current_player, char *name_n, char
 {
     player w = get_winner(game);
 
+    analysis_stop(hint);
+    hint = NULL;
+
     if (w != NO_PLAYER) {
         if (w == NORTH_P)
             printf("VICTOIRE ! Bravo %s (NORD) a gagné !\n", name_n);
@@ -582,23 +747,69 @@ GameState state_end_turn(board game, player *current_player, char *name_n, char
         return STATE_GAME_OVER;
     }
 
+    if (search_enabled)
+    {
+        repetition_push(&history, repetition_key(game, next_player(*current_player)));
+        if (repetition_is_draw(&history))
+        {
+            printf("MATCH NUL : la même position est revenue %d fois.\n", DRAW_REPETITIONS);
+            return STATE_GAME_OVER;
+        }
+    }
+
     return STATE_TURN_START;
 }
 
 int main(int args, char **argv)
 {
+#ifdef BOARD_BACKEND_DYNAMIC
+    //implémentation du plateau choisie sur la ligne de commande, par exemple : ./jeu board_V
+    if (args > 1 && !board_backend_select(argv[1]))
+    {
+        printf("Implémentation inconnue : %s\n", argv[1]);
+        return 1;
+    }
+#endif
     board game = new_game();
 
     
     char name_n[50];
     char name_s[50];
 
-    printf("Entrez le nom du joueur NORD : ");
+    printf("Entrez le nom du joueur NORD (%s pour l'ordinateur) : ", BOT_NAME);
     scanf("%s", name_n);
 
-    printf("Entrez le nom du joueur SUD : ");
+    printf("Entrez le nom du joueur SUD (%s pour l'ordinateur) : ", BOT_NAME);
     scanf("%s", name_s);
-    
+
+    if (!init_bot(NORTH_P, name_n) || !init_bot(SOUTH_P, name_s))
+    {
+        printf("Mémoire insuffisante pour l'ordinateur\n");
+        return 1;
+    }
+#ifdef BOARD_BACKEND_DYNAMIC
+    //la recherche lit la structure du plateau de board.c
+    search_enabled = strcmp(board_backend_current()->name, "board") == 0;
+    if ((bots[NORTH_P] != NULL || bots[SOUTH_P] != NULL) && !search_enabled)
+    {
+        printf("L'ordinateur ne joue qu'avec l'implémentation board\n");
+        return 1;
+    }
+#endif
+
+    //la base est projetée en lecture seule : rien à charger
+    if ((bots[NORTH_P] != NULL || bots[SOUTH_P] != NULL) && posdb_open(&database, BOT_DATABASE))
+    {
+        database_open = true;
+        printf("Base de positions %s : %lu positions\n", BOT_DATABASE, (unsigned long)posdb_count(&database));
+        for (int i = SOUTH_P; i <= NORTH_P; i++) {
+            if (bots[i] != NULL)
+            {
+                search_set_database(bots[i], &database);
+            }
+        }
+    }
+
 
     player p = first_player(pile_ou_face());
 
@@ -624,7 +835,10 @@ int main(int args, char **argv)
                 state = state_turn_start(game, &p, name_n, name_s);
                 break;
             case STATE_PLAYER_TURN:
-                state = state_player_turn(game, &p, name_n, name_s);
+                if (bots[p] != NULL)
+                    state = state_bot_turn(game, &p, name_n, name_s);
+                else
+                    state = state_player_turn(game, &p, name_n, name_s);
                 break;
             case STATE_END_TURN:
                 state = state_end_turn(game, &p, name_n, name_s);
@@ -632,9 +846,20 @@ int main(int args, char **argv)
         }
     }
     
+    search_destroy(bots[NORTH_P]);
+    search_destroy(bots[SOUTH_P]);
+    if (database_open)
+    {
+        posdb_close(&database);
+    }
     destroy_game(game);
     printf("suppression du plateau et sortie\n");
 
+#ifdef BOARD_STATS
+    //mesures des fonctions du plateau pendant la partie
+    board_stats_dump_json(stderr);
+#endif
+
     return 0;
 }
 
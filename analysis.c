@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include "analysis.h"
+
+
+struct analysis_s {
+    search_engine *engine;
+    board game;               // copie privée de la position
+    player to_move;
+    analysis_options options;
+    analysis_callback callback;
+    pthread_t thread;
+
+    // protégés par lock : dernier résultat et état du thread
+    pthread_mutex_t lock;
+    search_result latest;
+    bool running;
+};
+
+// Rapport d'une profondeur terminée : gardé pour analysis_poll, puis transmis
+static void report(const search_result *result, void *data) {
+    struct analysis_s *a = data;
+
+    pthread_mutex_lock(&a->lock);
+    a->latest = *result;
+    pthread_mutex_unlock(&a->lock);
+
+    if (a->callback != NULL)
+    {
+        a->callback(result, a->options.data);
+    }
+}
+
+static void *analysis_main(void *arg) {
+    struct analysis_s *a = arg;
+
+    search_iterate(a->engine, a->game, a->to_move, a->options.max_depth, a->options.time_ms, report, a);
+
+    pthread_mutex_lock(&a->lock);
+    a->running = false;
+    pthread_mutex_unlock(&a->lock);
+    return NULL;
+}
+
+static void release(struct analysis_s *a) {
+    search_destroy(a->engine);
+    if (a->game != NULL)
+    {
+        destroy_game(a->game);
+    }
+    pthread_mutex_destroy(&a->lock);
+    free(a);
+}
+
+analysis analysis_start(board game, player p, analysis_callback callback, const analysis_options *options) {
+    struct analysis_s *a = calloc(1, sizeof(struct analysis_s));
+    if (a == NULL)
+    {
+        return NULL;
+    }
+
+    if (options != NULL)
+    {
+        a->options = *options;
+    }
+    a->callback = callback;
+    a->to_move = p;
+    a->running = true;
+    pthread_mutex_init(&a->lock, NULL);
+    a->game = copy_game(game);
+    a->engine = search_create(a->options.table_bytes > 0 ? a->options.table_bytes : ANALYSIS_TABLE_BYTES);
+    if (a->game == NULL || a->engine == NULL)
+    {
+        release(a);
+        return NULL;
+    }
+
+    if (pthread_create(&a->thread, NULL, analysis_main, a) != 0)
+    {
+        release(a);
+        return NULL;
+    }
+    return a;
+}
+
+bool analysis_poll(analysis handle, search_result *latest) {
+    pthread_mutex_lock(&handle->lock);
+    bool running = handle->running;
+    if (latest != NULL)
+    {
+        *latest = handle->latest;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return running;
+}
+
+void analysis_stop(analysis handle) {
+    if (handle == NULL)
+    {
+        return;
+    }
+    search_stop(handle->engine);
+    pthread_join(handle->thread, NULL);
+    release(handle);
+}
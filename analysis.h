@@ -0,0 +1,74 @@
+#ifndef _ANALYSIS_H_
+#define _ANALYSIS_H_
+
+#include "board.h"
+#include "search.h"
+
+/**
+ * \file analysis.h
+ *
+ * \brief Analyse d'une position en arrière-plan, pour les indices et les évaluations.
+ *
+ * Une analyse tourne dans son propre thread, sur une copie du plateau et avec son propre
+ * moteur (search.h) : l'interface continue de lire les saisies pendant ce temps.
+ * Chaque profondeur terminée est rapportée à la fonction donnée au départ,
+ * et la dernière peut être relue à tout moment avec ::analysis_poll.
+ * ::analysis_stop interrompt la recherche en moins d'une milliseconde
+ * (plus la durée de l'appel de la fonction de rapport en cours, s'il y en a un).
+ */
+
+/**
+ * @brief taille par défaut de la table de transposition d'une analyse.
+ */
+#define ANALYSIS_TABLE_BYTES (16u << 20)
+
+/**
+ * @brief Fonction de rapport, appelée depuis le thread de l'analyse à chaque profondeur terminée.
+ * @param result la profondeur, le score, la variante principale...
+ * @param data le pointeur donné dans ::analysis_options.
+ */
+typedef void (*analysis_callback)(const search_result *result, void *data);
+
+/**
+ * @brief Options d'une analyse ; tout à zéro pour les valeurs par défaut.
+ */
+typedef struct {
+	int max_depth; /**< profondeur maximale, 0 pour ::SEARCH_MAX_DEPTH */
+	long time_ms; /**< durée maximale en millisecondes, 0 sans limite */
+	size_t table_bytes; /**< taille de la table, 0 pour ::ANALYSIS_TABLE_BYTES */
+	void *data; /**< passé à la fonction de rapport */
+} analysis_options;
+
+/**
+ * @brief Une analyse en cours ou terminée.
+ */
+typedef struct analysis_s *analysis;
+
+/**
+ * @brief Lance l'analyse d'une position.
+ * @param game le plateau, entre deux tours ; il est recopié et peut changer ensuite.
+ * @param p le joueur qui a le trait.
+ * @param callback la fonction de rapport, ou NULL (les résultats se lisent avec ::analysis_poll).
+ * @param options les options, ou NULL pour les valeurs par défaut.
+ * @return l'analyse, NULL si la mémoire manque ou si le thread n'a pas pu être créé.
+ */
+analysis analysis_start(board game, player p, analysis_callback callback, const analysis_options *options);
+
+/**
+ * @brief Relit le dernier résultat de l'analyse, sans attendre.
+ * @param handle l'analyse.
+ * @param latest si non NULL, reçoit le dernier résultat (depth vaut 0 s'il n'y en a pas encore).
+ * @return true si l'analyse tourne encore.
+ */
+bool analysis_poll(analysis handle, search_result *latest);
+
+/**
+ * @brief Arrête l'analyse, attend la fin de son thread et la libère.
+ *
+ * À appeler pour toute analyse, même terminée d'elle-même.
+ *
+ * @param handle l'analyse (NULL est accepté).
+ */
+void analysis_stop(analysis handle);
+
+#endif /*_ANALYSIS_H_*/
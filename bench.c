@@ -0,0 +1,480 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "board.h"
+#include "board_backend.h"
+
+// Mesure du coût des fonctions de board.h (ns par appel) sur des positions de parties
+// Seul board.h est utilisé : le même fichier se compile avec chacune des implémentations.
+// Compilation :
+//   gcc -O2 bench.c board.c eval.c board_tables.c -o bench
+//   gcc -O2 bench.c board_V.c -o bench_V        (de même avec board_W.c et board_Wendy.c)
+//   gcc -O2 -DBOARD_BACKEND_DYNAMIC bench.c board_backend*.c eval.c board_tables.c -o bench_all
+// Usage : ./bench [-n positions] [-r mesures] [-s graine] [-l nom] [-b implémentation|all] > resultats.json
+// (-b seulement avec BOARD_BACKEND_DYNAMIC : all mesure les implémentations l'une après l'autre)
+//
+// Chaque fonction est mesurée r fois sur tout le corpus ; une mesure donne le temps moyen
+// d'un appel, et les statistiques (médiane, centiles) portent sur les r mesures.
+// Le tableau lisible va sur stderr, le JSON sur stdout, pour comparer deux commits.
+
+// Longueur maximale d'une partie du corpus, et nombre maximal de pas d'un mouvement
+#define MAX_GAME_TURNS 80
+#define MAX_PATH 64
+
+typedef enum {
+    OP_NEW_GAME,
+    OP_COPY_GAME,
+    OP_DESTROY_GAME,
+    OP_GET_PIECE_SIZE,
+    OP_SOUTHMOST_LINE,
+    OP_PICK_PIECE,
+    OP_IS_MOVE_POSSIBLE,
+    OP_MOVE_PIECE,
+    OP_SWAP_PIECE,
+    OP_CANCEL_STEP,
+    OP_CANCEL_MOVEMENT,
+    NB_OPS
+} bench_op;
+
+static const char *op_names[NB_OPS] = {
+    "new_game", "copy_game", "destroy_game", "get_piece_size", "southmost_occupied_line",
+    "pick_piece", "is_move_possible", "move_piece", "swap_piece", "cancel_step", "cancel_movement"
+};
+
+// Une position du corpus, avec ce qu'il faut pour y mesurer chaque fonction
+typedef struct {
+    board game;
+    player p;                 // joueur qui a le trait
+    int pick_line;            // pièce de la ligne active
+    int pick_col;
+    int step;                 // premier pas qui garde la pièce en main, -1 s'il n'y en a pas
+    int nb_swap_steps;        // pas qui mènent la pièce sur une autre pièce, -1 si aucun chemin trouvé
+    direction swap_steps[MAX_PATH];
+    int swap_line;            // case vide où envoyer la pièce rencontrée
+    int swap_col;
+} bench_position;
+
+static uint64_t rng_state;
+
+// Générateur xorshift64*
+static int random_below(int n) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (int)((rng_state * 0x2545f4914f6cdd1dULL) >> 33) % n;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int active_line(board game, player p) {
+    return (p == SOUTH_P) ? southmost_occupied_line(game) : northmost_occupied_line(game);
+}
+
+// Une colonne au hasard parmi les cases occupées (ou vides) de la ligne, -1 s'il n'y en a pas
+static int random_column(board game, int line, bool occupied) {
+    int columns[DIMENSION];
+    int nb = 0;
+    for (int c = 0; c < DIMENSION; c++) {
+        if ((get_piece_size(game, line, c) != NONE) == occupied)
+        {
+            columns[nb++] = c;
+        }
+    }
+    return (nb == 0) ? -1 : columns[random_below(nb)];
+}
+
+// Une case vide au hasard (il y en a toujours)
+static void random_empty_square(board game, int *line, int *column) {
+    do {
+        *line = random_below(DIMENSION);
+        *column = random_column(game, *line, false);
+    } while (*column < 0);
+}
+
+// Placement au hasard : chaque joueur pose ses pièces chacun son tour
+static void random_setup(board game, player p) {
+    for (int i = 0; i < 2 * NB_SIZE * NB_INITIAL_PIECES; i++) {
+        int line = (p == SOUTH_P) ? 0 : DIMENSION - 1;
+        size piece;
+        do {
+            piece = ONE + random_below(NB_SIZE);
+        } while (nb_pieces_available(game, piece, p) <= 0);
+        place_piece(game, piece, p, random_column(game, line, false));
+        p = next_player(p);
+    }
+}
+
+// Mène la pièce en main par des pas au hasard jusqu'à la poser, ou jusqu'à une autre pièce si stop_on_piece.
+// Le but n'est jamais joué. Renvoie le nombre de pas, -1 si la pièce est bloquée.
+static int random_walk(board game, direction *path, bool stop_on_piece) {
+    int nb = 0;
+    while (picked_piece_owner(game) != NO_PLAYER && nb < MAX_PATH) {
+        if (stop_on_piece && movement_left(game) == 0)
+        {
+            return nb;
+        }
+
+        direction legal[4];
+        int nb_legal = 0;
+        for (direction d = SOUTH; d <= WEST; d++) {
+            if (is_move_possible(game, d))
+            {
+                legal[nb_legal++] = d;
+            }
+        }
+        if (nb_legal == 0)
+        {
+            return -1;
+        }
+        path[nb] = legal[random_below(nb_legal)];
+        move_piece(game, path[nb++]);
+    }
+    return (picked_piece_owner(game) == NO_PLAYER && !stop_on_piece) ? nb : -1;
+}
+
+// Joue un tour au hasard ; renvoie false si aucun tour n'a été trouvé
+static bool random_turn(board game, player p) {
+    direction path[MAX_PATH];
+
+    for (int attempt = 0; attempt < 20; attempt++) {
+        int line = active_line(game, p);
+        int column = random_column(game, line, true);
+        if (column < 0 || pick_piece(game, p, line, column) != OK)
+        {
+            return false;
+        }
+
+        //une fois sur deux, la pièce va jusqu'à une autre pièce et l'échange
+        if (random_below(2) == 0 && random_walk(game, path, true) >= 0)
+        {
+            int l, c;
+            random_empty_square(game, &l, &c);
+            if (swap_piece(game, l, c) == OK)
+            {
+                return true;
+            }
+        }
+        if (picked_piece_owner(game) != NO_PLAYER && random_walk(game, path, false) < 0)
+        {
+            cancel_movement(game);
+            continue;
+        }
+        if (picked_piece_owner(game) == NO_PLAYER)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Prépare les mesures sur une position : pièce à prendre, premier pas, chemin vers un échange
+static void prepare_position(bench_position *bp) {
+    board work = copy_game(bp->game);
+    direction path[MAX_PATH];
+
+    bp->pick_line = active_line(work, bp->p);
+    bp->pick_col = random_column(work, bp->pick_line, true);
+    bp->step = -1;
+    bp->nb_swap_steps = -1;
+    pick_piece(work, bp->p, bp->pick_line, bp->pick_col);
+
+    for (direction d = SOUTH; d <= WEST && bp->step < 0; d++) {
+        if (is_move_possible(work, d) && move_piece(work, d) == OK)
+        {
+            if (picked_piece_owner(work) != NO_PLAYER)
+            {
+                bp->step = d;
+                cancel_step(work);
+            }
+            else
+            {
+                //la pièce a été posée : on repart de la position
+                destroy_game(work);
+                work = copy_game(bp->game);
+                pick_piece(work, bp->p, bp->pick_line, bp->pick_col);
+            }
+        }
+    }
+
+    for (int attempt = 0; attempt < 30 && bp->nb_swap_steps < 0; attempt++) {
+        int nb = random_walk(work, path, true);
+        if (nb >= 0)
+        {
+            bp->nb_swap_steps = nb;
+            memcpy(bp->swap_steps, path, nb * sizeof(direction));
+            random_empty_square(work, &bp->swap_line, &bp->swap_col);
+        }
+        destroy_game(work);
+        work = copy_game(bp->game);
+        pick_piece(work, bp->p, bp->pick_line, bp->pick_col);
+    }
+    destroy_game(work);
+}
+
+// Corpus : les positions de parties jouées au hasard, avant chaque tour
+static int build_corpus(bench_position *corpus, int nb_positions) {
+    int nb = 0;
+    while (nb < nb_positions) {
+        board game = new_game();
+        player p = random_below(2) ? NORTH_P : SOUTH_P;
+        random_setup(game, p);
+
+        for (int t = 0; t < MAX_GAME_TURNS && nb < nb_positions; t++) {
+            corpus[nb].game = copy_game(game);
+            corpus[nb].p = p;
+            prepare_position(&corpus[nb]);
+            nb++;
+            if (!random_turn(game, p) || get_winner(game) != NO_PLAYER)
+            {
+                break;
+            }
+            p = next_player(p);
+        }
+        destroy_game(game);
+    }
+    return nb;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Une mesure de chaque fonction sur tout le corpus ; time[op] reçoit les ns par appel
+static void measure_round(bench_position *corpus, int nb, board *work, double *time) {
+    volatile long sink = 0;
+    long count[NB_OPS] = { 0 };
+    double t;
+
+    for (int op = 0; op < NB_OPS; op++) {
+        time[op] = 0;
+    }
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        work[i] = new_game();
+    }
+    time[OP_NEW_GAME] += now_ns() - t;
+    count[OP_NEW_GAME] += nb;
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        destroy_game(work[i]);
+    }
+    time[OP_DESTROY_GAME] += now_ns() - t;
+    count[OP_DESTROY_GAME] += nb;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        work[i] = copy_game(corpus[i].game);
+    }
+    time[OP_COPY_GAME] += now_ns() - t;
+    count[OP_COPY_GAME] += nb;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        for (int l = 0; l < DIMENSION; l++) {
+            for (int c = 0; c < DIMENSION; c++) {
+                sink += get_piece_size(work[i], l, c);
+            }
+        }
+    }
+    time[OP_GET_PIECE_SIZE] += now_ns() - t;
+    count[OP_GET_PIECE_SIZE] += (long)nb * DIMENSION * DIMENSION;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        sink += southmost_occupied_line(work[i]);
+    }
+    time[OP_SOUTHMOST_LINE] += now_ns() - t;
+    count[OP_SOUTHMOST_LINE] += nb;
+
+    //mouvement : prise, tests, un pas, annulation du pas, annulation du mouvement
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        sink += pick_piece(work[i], corpus[i].p, corpus[i].pick_line, corpus[i].pick_col);
+    }
+    time[OP_PICK_PIECE] += now_ns() - t;
+    count[OP_PICK_PIECE] += nb;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        for (direction d = GOAL; d <= WEST; d++) {
+            sink += is_move_possible(work[i], d);
+        }
+    }
+    time[OP_IS_MOVE_POSSIBLE] += now_ns() - t;
+    count[OP_IS_MOVE_POSSIBLE] += (long)nb * 5;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        if (corpus[i].step >= 0)
+        {
+            sink += move_piece(work[i], corpus[i].step);
+            count[OP_MOVE_PIECE]++;
+        }
+    }
+    time[OP_MOVE_PIECE] += now_ns() - t;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        if (corpus[i].step >= 0)
+        {
+            sink += cancel_step(work[i]);
+            count[OP_CANCEL_STEP]++;
+        }
+    }
+    time[OP_CANCEL_STEP] += now_ns() - t;
+
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        sink += cancel_movement(work[i]);
+    }
+    time[OP_CANCEL_MOVEMENT] += now_ns() - t;
+    count[OP_CANCEL_MOVEMENT] += nb;
+
+    //échange : la pièce est d'abord menée sur une autre pièce (hors mesure)
+    for (int i = 0; i < nb; i++) {
+        if (corpus[i].nb_swap_steps >= 0)
+        {
+            pick_piece(work[i], corpus[i].p, corpus[i].pick_line, corpus[i].pick_col);
+            for (int s = 0; s < corpus[i].nb_swap_steps; s++) {
+                move_piece(work[i], corpus[i].swap_steps[s]);
+            }
+        }
+    }
+    t = now_ns();
+    for (int i = 0; i < nb; i++) {
+        if (corpus[i].nb_swap_steps >= 0)
+        {
+            sink += swap_piece(work[i], corpus[i].swap_line, corpus[i].swap_col);
+            count[OP_SWAP_PIECE]++;
+        }
+    }
+    time[OP_SWAP_PIECE] += now_ns() - t;
+
+    for (int i = 0; i < nb; i++) {
+        destroy_game(work[i]);
+    }
+
+    for (int op = 0; op < NB_OPS; op++) {
+        time[op] = (count[op] > 0) ? time[op] / count[op] : 0;
+    }
+    (void)sink;
+}
+
+// Mesure toutes les fonctions avec l'implémentation liée (ou choisie) et écrit les résultats
+static void run_bench(const char *label, int nb_positions, int nb_rounds, uint64_t seed,
+                      bench_position *corpus, board *work, double *samples) {
+    //même graine pour chaque implémentation : mêmes parties si elles suivent les mêmes règles
+    rng_state = (seed + 1) * 0x9e3779b97f4a7c15ULL;
+    int nb = build_corpus(corpus, nb_positions);
+
+    //une mesure d'échauffement, puis les mesures gardées
+    double time[NB_OPS];
+    measure_round(corpus, nb, work, time);
+    for (int r = 0; r < nb_rounds; r++) {
+        measure_round(corpus, nb, work, time);
+        for (int op = 0; op < NB_OPS; op++) {
+            samples[op * nb_rounds + r] = time[op];
+        }
+    }
+
+    fprintf(stderr, "%s : %d positions, %d mesures (ns par appel)\n", label, nb, nb_rounds);
+    fprintf(stderr, "%-24s %9s %9s %9s %9s %9s\n", "fonction", "min", "p10", "médiane", "p90", "p99");
+    printf("{\n  \"implementation\": \"%s\",\n  \"dimension\": %d,\n  \"positions\": %d,\n  \"rounds\": %d,\n  \"seed\": %llu,\n  \"results\": {",
+           label, DIMENSION, nb, nb_rounds, (unsigned long long)seed);
+    for (int op = 0; op < NB_OPS; op++) {
+        double *s = &samples[op * nb_rounds];
+        qsort(s, nb_rounds, sizeof(double), compare_doubles);
+        double p10 = s[(nb_rounds - 1) * 10 / 100];
+        double median = s[(nb_rounds - 1) / 2];
+        double p90 = s[(nb_rounds - 1) * 90 / 100];
+        double p99 = s[(nb_rounds - 1) * 99 / 100];
+
+        fprintf(stderr, "%-24s %9.2f %9.2f %9.2f %9.2f %9.2f\n", op_names[op], s[0], p10, median, p90, p99);
+        printf("%s\n    \"%s\": { \"min\": %.3f, \"p10\": %.3f, \"median\": %.3f, \"p90\": %.3f, \"p99\": %.3f }",
+               op > 0 ? "," : "", op_names[op], s[0], p10, median, p90, p99);
+    }
+    printf("\n  }\n}");
+
+    for (int i = 0; i < nb; i++) {
+        destroy_game(corpus[i].game);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int nb_positions = 1000;
+    int nb_rounds = 101;
+    uint64_t seed = 1;
+    const char *label = NULL;
+    const char *backend = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-n") == 0) nb_positions = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-r") == 0) nb_rounds = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-s") == 0) seed = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "-l") == 0) label = argv[i + 1];
+        else if (strcmp(argv[i], "-b") == 0) backend = argv[i + 1];
+    }
+    if (nb_positions < 1 || nb_rounds < 1 || argc % 2 == 0)
+    {
+        fprintf(stderr, "usage : %s [-n positions] [-r mesures] [-s graine] [-l nom] [-b implémentation|all]\n", argv[0]);
+        return 1;
+    }
+
+    bench_position *corpus = malloc(nb_positions * sizeof(bench_position));
+    board *work = malloc(nb_positions * sizeof(board));
+    double *samples = malloc((size_t)NB_OPS * nb_rounds * sizeof(double));
+    if (corpus == NULL || work == NULL || samples == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+
+#ifdef BOARD_BACKEND_DYNAMIC
+    //toutes les implémentations l'une après l'autre : un tableau JSON
+    if (backend != NULL && strcmp(backend, "all") == 0)
+    {
+        printf("[");
+        for (int i = 0; board_backend_get(i) != NULL; i++) {
+            board_backend_select(board_backend_get(i)->name);
+            printf(i > 0 ? ",\n" : "\n");
+            run_bench(board_backend_get(i)->name, nb_positions, nb_rounds, seed, corpus, work, samples);
+        }
+        printf("\n]\n");
+        free(corpus);
+        free(work);
+        free(samples);
+        return 0;
+    }
+    else if (backend != NULL && !board_backend_select(backend))
+    {
+        fprintf(stderr, "implémentation inconnue : %s\n", backend);
+        return 1;
+    }
+    if (label == NULL)
+    {
+        label = board_backend_current()->name;
+    }
+#else
+    if (backend != NULL)
+    {
+        fprintf(stderr, "-b demande une compilation avec -DBOARD_BACKEND_DYNAMIC (voir board_backend.h)\n");
+        return 1;
+    }
+#endif
+    run_bench(label != NULL ? label : "board", nb_positions, nb_rounds, seed, corpus, work, samples);
+    printf("\n");
+
+    free(corpus);
+    free(work);
+    free(samples);
+    return 0;
+}
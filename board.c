@@ -1,74 +1,54 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef BOARD_STATS
+// les points d'entrée sont compilés sous le nom nom_impl, board_stats.c les mesure
+#define BOARD_STATS_IMPL
+#endif
+#include "board_stats.h"
 #include "board.h"
+#include "board_s.h"
 
 
-// Structure qui sauvegarde les coordonnées d'un pas  utile pour annulé un move 
-typedef struct {
-    int old_line;
-    int old_col;
-    int moves_at_step;
-} step_history;
-
-// Structure principale du plateau de jeu
-struct board_s {
-    size grid[DIMENSION][DIMENSION]; 
-
-    // Compteurs pour la phase de placement 
-    int setup_counts[NB_PLAYERS + 1][NB_SIZE + 1];
-
-    player winner;
-
-    //Attributs de la pièce en main
-    player current_player;
-    size picked_piece;
-    int p_line;
-    int p_col;
-    int moves_remaining;
-    
-
-    int start_line;
-    int start_col;
-
-    step_history history[50];
-    int history_index;
-};
-
 // Fonction pour l'initialisation d'une nouvelle partie
 board new_game() {
 
     // Allocation mémoire pour la structure du board
     board game = (board)malloc(sizeof(struct board_s));
-    
-    //Boucle d'initialisation du board à NONE
-    for(int i=0; i<DIMENSION; i++){
-        for(int j=0; j<DIMENSION; j++){
-            game->grid[i][j] = NONE;
-        }
-    }
-
-    // Initialisation des compteurs de setup à 0
-    for(int p=0; p<=NB_PLAYERS; p++){
-        for(int s=0; s<=NB_SIZE; s++){
-            game->setup_counts[p][s] = 0;
-        }
+    if (game == NULL)
+    {
+        return NULL;
     }
+    
+    //grille vide (NONE vaut 0) et compteurs de setup à 0 ; l'historique des pas n'a pas à être initialisé
+    memset(game->grid, 0, sizeof(game->grid));
+    memset(game->setup_counts, 0, sizeof(game->setup_counts));
 
     game->winner = NO_PLAYER;
     game->current_player = NO_PLAYER;
     game->picked_piece = NONE;
     game->p_line = -1;
     game->p_col = -1;
+    game->moves_remaining = 0;
     game->history_index = 0;
+    game->used_edges = 0;
+    game->occupied = 0;
+    game->key = 0;
+    game->nb_pieces = 0;
+    memset(game->square_index, -1, sizeof(game->square_index));
+    eval_reset(&game->features);
 
     return game;
 }
 
 // Fonction pour copier l'état actuel du jeu
 board copy_game(board original_game) {
-    board copy = new_game();
-    *copy = *original_game; 
+    board copy = (board)malloc(sizeof(struct board_s));
+    if (copy == NULL)
+    {
+        return NULL;
+    }
+    *copy = *original_game;
     return copy;
 }
 
@@ -93,6 +73,56 @@ bool is_inside(int line, int col) {
     return (line >= 0 && line < DIMENSION && col >= 0 && col < DIMENSION);
 }
 
+// Pose une pièce dans la grille en tenant à jour la liste des pièces, le masque d'occupation, la clé et l'évaluation
+void put_piece(board game, int line, int col, size piece) {
+    int square = SQUARE(line, col);
+
+    game->grid[line][col] = piece;
+    game->occupied |= (uint64_t)1 << square;
+    game->key ^= zobrist_table[square][piece];
+
+    //la pièce est ajoutée en fin de liste
+    game->pieces[game->nb_pieces].square = square;
+    game->pieces[game->nb_pieces].piece = piece;
+    game->square_index[square] = game->nb_pieces;
+    game->nb_pieces++;
+
+    eval_add_piece(&game->features, game->grid, line, col);
+}
+
+// Retire la pièce d'une case de la grille et renvoie sa taille
+size remove_piece(board game, int line, int col) {
+    int square = SQUARE(line, col);
+    size piece = game->grid[line][col];
+
+    game->grid[line][col] = NONE;
+    game->occupied &= ~((uint64_t)1 << square);
+    game->key ^= zobrist_table[square][piece];
+
+    //la dernière pièce de la liste prend la place de la pièce retirée
+    int index = game->square_index[square];
+    game->nb_pieces--;
+    game->pieces[index] = game->pieces[game->nb_pieces];
+    game->square_index[game->pieces[index].square] = index;
+    game->square_index[square] = -1;
+
+    eval_remove_piece(&game->features, game->grid, line, col, piece);
+    return piece;
+}
+
+// Vide la grille d'un coup, sans retirer les pièces une à une
+void clear_grid(board game) {
+    for (int i = 0; i < game->nb_pieces; i++) {
+        int square = game->pieces[i].square;
+        game->grid[SQUARE_LINE(square)][SQUARE_COL(square)] = NONE;
+        game->square_index[square] = -1;
+    }
+    game->nb_pieces = 0;
+    game->occupied = 0;
+    game->key = 0;
+    eval_reset(&game->features);
+}
+
 size get_piece_size(board game, int line, int column) {
 
     //Si les coordonnées rentrées ne sont pas dans le plateau on retourne NONE
@@ -111,6 +141,12 @@ size get_piece_size(board game, int line, int column) {
 }
 
 
+// Clé de la position : pièces de la grille et joueur qui a le trait
+uint64_t position_key(board game, player to_move) {
+    return game->key ^ zobrist_side[to_move];
+}
+
+
 // Fonction pour obtenir le gagnant
 player get_winner(board game) {
     return game->winner;
@@ -118,32 +154,22 @@ player get_winner(board game) {
 
 // Trouve la ligne la plus au sud qui contient une pièce
 int southmost_occupied_line(board game) {
-
-    // Parcours du plateau de haut en bas
-    for (int l = 0; l < DIMENSION; l++) {
-        for (int c = 0; c < DIMENSION; c++) {
-            if (game->grid[l][c] != NONE) 
-            {
-                return l;
-            }
-        }
+    //le bit le plus faible du masque d'occupation est la case occupée la plus au sud
+    if (game->occupied == 0)
+    {
+        return -1;
     }
-    return -1;
+    return __builtin_ctzll(game->occupied) / DIMENSION;
 }
 
 // Trouve la ligne la plus au nord qui contient une pièce
 int northmost_occupied_line(board game) {
-
-    // Parcours du plateau de bas en haut
-    for (int l = DIMENSION - 1; l >= 0; l--) {
-        for (int c = 0; c < DIMENSION; c++) {
-            if (game->grid[l][c] != NONE) 
-            {
-                return l;
-            }
-        }
+    //le bit le plus fort du masque d'occupation est la case occupée la plus au nord
+    if (game->occupied == 0)
+    {
+        return -1;
     }
-    return -1;
+    return (63 - __builtin_clzll(game->occupied)) / DIMENSION;
 }
 
 // Fonction qui retourne le joueur propriétaire de la pièce en main
@@ -208,7 +234,7 @@ return_code place_piece(board game, size piece, player player, int column) {
 
     if (game->grid[line][column] != NONE) return EMPTY;
 
-    game->grid[line][column] = piece;
+    put_piece(game, line, column, piece);
     game->setup_counts[player][piece]++;
     
     return OK;
@@ -249,65 +275,49 @@ return_code pick_piece(board game, player current_player, int line, int column)
     game->moves_remaining = game->picked_piece;
     
     //la case devient vide
-    game->grid[line][column] = NONE;
+    remove_piece(game, line, column);
 
     //pour annuler les mouvements
     game->start_line = line;
     game->start_col = column;
     game->history_index = 0;
+    game->used_edges = 0;
 
     return OK;
 }
 
 bool is_move_possible(board game, direction direction) {
     if (game->picked_piece == NONE) return false;
+    if (direction < GOAL || direction > WEST) return false;
+
+    int square = SQUARE(game->p_line, game->p_col);
 
-    //les coordonnées
-    int target_l = game->p_line;
-    int target_c = game->p_col;
-
-    switch(direction) {
-        case NORTH:
-            target_l++;
-            break;
-        case SOUTH:
-            target_l--;
-            break;
-        case EAST:
-            target_c++;
-            break;
-        case WEST:
-            target_c--;
-            break;
-        case GOAL:
-            if (game->current_player == SOUTH_P && game->p_line == DIMENSION - 1)
-            {
-                return true;
-            }
-            if (game->current_player == NORTH_P && game->p_line == 0)
-            {
-                return true;
-            }    
-            return false;
+    //le but n'est accessible que depuis la ligne la plus proche du but adverse
+    if (direction == GOAL)
+    {
+        return (goal_flags[square] >> game->current_player) & 1;
     }
 
+    //la case visée et le segment emprunté sont lus dans les tables
+    int target = neighbour_table[square][direction];
+    int edge = edge_table[square][direction];
+
     //si c'est pas dans la grille -> false
-    if (!is_inside(target_l, target_c)) return false;
+    if (target == NO_SQUARE) return false;
+
+    //on ne peut pas repasser par un segment déjà emprunté
+    if ((game->used_edges >> edge) & 1) return false;
+
+    size target_piece = game->grid[SQUARE_LINE(target)][SQUARE_COL(target)];
 
     //si on doit rebondir alors on doit rebondir sur une case vide
     if (game->moves_remaining == 0 && game->grid[game->p_line][game->p_col] != NONE) 
     {
-        if (game->grid[target_l][target_c] != NONE) return false;
-        return true;
+        return target_piece == NONE;
     }
 
     //si on essaye de rebondir mais que ce n'est pas notre dernier déplacements -> false
-    if (game->grid[target_l][target_c] != NONE) 
-    {
-        if (game->moves_remaining != 1) return false;
-    }
-
-    return true;
+    return target_piece == NONE || game->moves_remaining == 1;
 }
 
 return_code move_piece(board game, direction direction) {
@@ -323,33 +333,36 @@ return_code move_piece(board game, direction direction) {
 
     if (direction == GOAL) 
     {
+        BOARD_EVENT(EVENT_GOAL);
         game->winner = game->current_player;
         game->picked_piece = NONE;
         game->moves_remaining = 0;
         return OK;
     }
 
-    int new_l = game->p_line;
-    int new_c = game->p_col;
-    if (direction == NORTH) new_l++;
-    if (direction == SOUTH) new_l--;
-    if (direction == EAST)  new_c++;
-    if (direction == WEST)  new_c--;
+    int square = SQUARE(game->p_line, game->p_col);
+    int target = neighbour_table[square][direction];
+    int edge = edge_table[square][direction];
 
     //on actualise les données de l'historique des coups
     game->history[game->history_index].old_line = game->p_line;
     game->history[game->history_index].old_col = game->p_col;
     game->history[game->history_index].moves_at_step = game->moves_remaining;
+    game->history[game->history_index].edge = edge;
     game->history_index++;
+    game->used_edges |= (uint64_t)1 << edge;
 
     //si il y a un rebond on ajoute le nombre de coup en fonction de la valeur de la case
     if (game->moves_remaining == 0 && game->grid[game->p_line][game->p_col] != NONE) 
     {
         int bounce_size = game->grid[game->p_line][game->p_col];
         game->moves_remaining = bounce_size;
+        BOARD_EVENT(EVENT_BOUNCE);
     }
 
     //on actualise les coordonnées de la pièce dans le jeu
+    int new_l = SQUARE_LINE(target);
+    int new_c = SQUARE_COL(target);
     game->p_line = new_l;
     game->p_col = new_c;
     game->moves_remaining--;
@@ -363,7 +376,7 @@ return_code move_piece(board game, direction direction) {
     {
         if (game->moves_remaining == 0) 
         {
-            game->grid[new_l][new_c] = game->picked_piece;
+            put_piece(game, new_l, new_c, game->picked_piece);
             game->picked_piece = NONE;
         }
     }
@@ -393,14 +406,15 @@ return_code swap_piece(board game, int target_line, int target_column) {
     } 
 
     //on déplace la pièce aux coordonnées choisies
-    size piece_under = game->grid[game->p_line][game->p_col];
-    game->grid[target_line][target_column] = piece_under;
+    size piece_under = remove_piece(game, game->p_line, game->p_col);
+    put_piece(game, target_line, target_column, piece_under);
 
     //on pose la pièce aux coordonnées de la pièce qui a été déplacer
-    game->grid[game->p_line][game->p_col] = game->picked_piece;
+    put_piece(game, game->p_line, game->p_col, game->picked_piece);
 
     game->picked_piece = NONE;
     game->moves_remaining = 0;
+    BOARD_EVENT(EVENT_SWAP);
 
     return OK;
 }
@@ -412,7 +426,7 @@ return_code cancel_movement(board game) {
     }   
 
     //on remet la pièce à sa place initial
-    game->grid[game->start_line][game->start_col] = game->picked_piece;
+    put_piece(game, game->start_line, game->start_col, game->picked_piece);
     
     //on réinitialise les données du jeu
     game->picked_piece = NONE;
@@ -420,6 +434,7 @@ return_code cancel_movement(board game) {
     game->p_line = -1;
     game->p_col = -1;
     game->moves_remaining = 0;
+    BOARD_EVENT(EVENT_CANCEL);
     
     return OK;   
 }
@@ -443,6 +458,8 @@ return_code cancel_step(board game) {
     game->p_line = last.old_line;
     game->p_col = last.old_col;
     game->moves_remaining = last.moves_at_step;
+    game->used_edges &= ~((uint64_t)1 << last.edge);
+    BOARD_EVENT(EVENT_CANCEL);
 
     return OK;
 }
\ No newline at end of file
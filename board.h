@@ -80,8 +80,11 @@
  *
  * In the following, all indices are given from 0 to ::DIMENSION - 1.
  * Small line numbers correspond to the south.
+ * It may be overridden at compile time (-DDIMENSION=4) to build a reduced variant.
  */
+#ifndef DIMENSION
 #define DIMENSION 6
+#endif
 
 /**
  * @brief Pointer to the structure that holds the game. 
@@ -153,8 +156,11 @@ player next_player(player current_player);
 /**
  * @brief number of pieces of each size on each player's line at the beginning.
  * Usually, this value is 2.
+ * It may be overridden at compile time, like ::DIMENSION.
  */
+#ifndef NB_INITIAL_PIECES
 #define NB_INITIAL_PIECES 2
+#endif
 
 /**
  * @brief return codes give semantics to the values returned by functions.
@@ -172,13 +178,14 @@ typedef enum return_code_e {
 
 /**
  * @brief Defines a new empty ::board for starting a game.
+ * @return the new game, or NULL if memory is exhausted.
  */
 board new_game();
 
 /**
  * @brief Makes a deep copy of the game.
  * @param original_game the game to copy.
- * @return a new copy fully independent of the original game.
+ * @return a new copy fully independent of the original game, or NULL if memory is exhausted.
  */
 board copy_game(board original_game);
 
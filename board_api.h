@@ -0,0 +1,52 @@
+#ifndef _BOARD_API_H_
+#define _BOARD_API_H_
+
+#include "board.h"
+
+/**
+ * \file board_api.h
+ *
+ * \brief Liste des points d'entrée de board.h, pour les générer par macros.
+ *
+ * Chaque liste appelle X une fois par fonction de board.h, avec son indice dans
+ * ::board_entry (board_stats.h), son nom, ses paramètres et les arguments qui les reprennent.
+ * board_stats.c s'en sert pour les mesurer, board_backend.h pour les tables de fonctions.
+ */
+
+/**
+ * @brief Points d'entrée qui renvoient un ::return_code : X(indice, nom, paramètres, arguments).
+ */
+#define BOARD_CODE_ENTRIES(X) \
+	X(STAT_PLACE_PIECE, place_piece, (board game, size piece, player player, int column), (game, piece, player, column)) \
+	X(STAT_PICK_PIECE, pick_piece, (board game, player current_player, int line, int column), (game, current_player, line, column)) \
+	X(STAT_MOVE_PIECE, move_piece, (board game, direction direction), (game, direction)) \
+	X(STAT_SWAP_PIECE, swap_piece, (board game, int target_line, int target_column), (game, target_line, target_column)) \
+	X(STAT_CANCEL_MOVEMENT, cancel_movement, (board game), (game)) \
+	X(STAT_CANCEL_STEP, cancel_step, (board game), (game))
+
+/**
+ * @brief Autres points d'entrée : X(indice, type, nom, paramètres, arguments).
+ */
+#define BOARD_VALUE_ENTRIES(X) \
+	X(STAT_NEXT_PLAYER, player, next_player, (player current_player), (current_player)) \
+	X(STAT_NEW_GAME, board, new_game, (void), ()) \
+	X(STAT_COPY_GAME, board, copy_game, (board original_game), (original_game)) \
+	X(STAT_GET_PIECE_SIZE, size, get_piece_size, (board game, int line, int column), (game, line, column)) \
+	X(STAT_GET_WINNER, player, get_winner, (board game), (game)) \
+	X(STAT_SOUTHMOST_LINE, int, southmost_occupied_line, (board game), (game)) \
+	X(STAT_NORTHMOST_LINE, int, northmost_occupied_line, (board game), (game)) \
+	X(STAT_PICKED_OWNER, player, picked_piece_owner, (board game), (game)) \
+	X(STAT_PICKED_SIZE, size, picked_piece_size, (board game), (game)) \
+	X(STAT_PICKED_LINE, int, picked_piece_line, (board game), (game)) \
+	X(STAT_PICKED_COLUMN, int, picked_piece_column, (board game), (game)) \
+	X(STAT_MOVEMENT_LEFT, int, movement_left, (board game), (game)) \
+	X(STAT_PIECES_AVAILABLE, int, nb_pieces_available, (board game, size piece, player player), (game, piece, player)) \
+	X(STAT_IS_MOVE_POSSIBLE, bool, is_move_possible, (board game, direction direction), (game, direction))
+
+/**
+ * @brief Points d'entrée sans valeur de retour : X(indice, nom, paramètres, arguments).
+ */
+#define BOARD_VOID_ENTRIES(X) \
+	X(STAT_DESTROY_GAME, destroy_game, (board game), (game))
+
+#endif /*_BOARD_API_H_*/
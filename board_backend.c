@@ -0,0 +1,65 @@
+#include <string.h>
+#include "board_backend.h"
+
+// Fonctions de board.h qui passent par la table de l'implémentation choisie (voir board_backend.h)
+
+#ifdef BOARD_BACKEND_DYNAMIC
+
+extern const board_backend board_backend_board;
+extern const board_backend board_backend_board_V;
+extern const board_backend board_backend_board_W;
+extern const board_backend board_backend_board_Wendy;
+
+static const board_backend *const backends[] = {
+    &board_backend_board,
+    &board_backend_board_V,
+    &board_backend_board_W,
+    &board_backend_board_Wendy,
+    NULL
+};
+
+static const board_backend *current = &board_backend_board;
+
+bool board_backend_select(const char *name) {
+    for (int i = 0; backends[i] != NULL; i++) {
+        if (strcmp(backends[i]->name, name) == 0)
+        {
+            current = backends[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+const board_backend *board_backend_current(void) {
+    return current;
+}
+
+const board_backend *board_backend_get(int i) {
+    if (i < 0 || i >= (int)(sizeof(backends) / sizeof(backends[0])) - 1)
+    {
+        return NULL;
+    }
+    return backends[i];
+}
+
+#define CODE_DISPATCH(index, name, params, args) \
+    return_code name params { \
+        return current->fn_##name args; \
+    }
+
+#define VALUE_DISPATCH(index, type, name, params, args) \
+    type name params { \
+        return current->fn_##name args; \
+    }
+
+#define VOID_DISPATCH(index, name, params, args) \
+    void name params { \
+        current->fn_##name args; \
+    }
+
+BOARD_CODE_ENTRIES(CODE_DISPATCH)
+BOARD_VALUE_ENTRIES(VALUE_DISPATCH)
+BOARD_VOID_ENTRIES(VOID_DISPATCH)
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef _BOARD_BACKEND_H_
+#define _BOARD_BACKEND_H_
+
+/**
+ * \file board_backend.h
+ *
+ * \brief Choix à l'exécution de l'implémentation de board.h.
+ *
+ * Chaque implémentation (board.c, board_V.c, board_W.c, board_Wendy.c) est compilée
+ * dans son propre fichier board_backend_X.c, sous le préfixe X_, et décrite par une
+ * table ::board_backend. Avec ::BOARD_BACKEND_DYNAMIC, board_backend.c définit les fonctions
+ * de board.h, qui passent par la table choisie avec ::board_backend_select :
+ * \code
+ * gcc -O2 -DBOARD_BACKEND_DYNAMIC bench.c board_backend.c board_backend_board.c board_backend_V.c \
+ *     board_backend_W.c board_backend_Wendy.c eval.c board_tables.c -o bench_all
+ * \endcode
+ * Sans ::BOARD_BACKEND_DYNAMIC, rien ne change : une seule implémentation est compilée
+ * directement (board.c en production), sans indirection.
+ *
+ * Un plateau ne doit être utilisé qu'avec l'implémentation qui l'a créé :
+ * le choix se fait avant de créer les plateaux. Les modules qui lisent la structure
+ * du plateau (board_s.h : turn.c, eval.c, les recherches) supposent l'implémentation "board".
+ */
+
+#ifdef BOARD_BACKEND
+#ifdef BOARD_STATS
+#error "BOARD_STATS et les implémentations préfixées ne se combinent pas"
+#endif
+// board_backend_X.c : les fonctions de l'implémentation prennent le nom X_nom (avant la lecture de board.h)
+#define BOARD_BACKEND_CONCAT2(prefix, name) prefix##_##name
+#define BOARD_BACKEND_CONCAT(prefix, name) BOARD_BACKEND_CONCAT2(prefix, name)
+#define next_player BOARD_BACKEND_CONCAT(BOARD_BACKEND, next_player)
+#define new_game BOARD_BACKEND_CONCAT(BOARD_BACKEND, new_game)
+#define copy_game BOARD_BACKEND_CONCAT(BOARD_BACKEND, copy_game)
+#define destroy_game BOARD_BACKEND_CONCAT(BOARD_BACKEND, destroy_game)
+#define get_piece_size BOARD_BACKEND_CONCAT(BOARD_BACKEND, get_piece_size)
+#define get_winner BOARD_BACKEND_CONCAT(BOARD_BACKEND, get_winner)
+#define southmost_occupied_line BOARD_BACKEND_CONCAT(BOARD_BACKEND, southmost_occupied_line)
+#define northmost_occupied_line BOARD_BACKEND_CONCAT(BOARD_BACKEND, northmost_occupied_line)
+#define picked_piece_owner BOARD_BACKEND_CONCAT(BOARD_BACKEND, picked_piece_owner)
+#define picked_piece_size BOARD_BACKEND_CONCAT(BOARD_BACKEND, picked_piece_size)
+#define picked_piece_line BOARD_BACKEND_CONCAT(BOARD_BACKEND, picked_piece_line)
+#define picked_piece_column BOARD_BACKEND_CONCAT(BOARD_BACKEND, picked_piece_column)
+#define movement_left BOARD_BACKEND_CONCAT(BOARD_BACKEND, movement_left)
+#define nb_pieces_available BOARD_BACKEND_CONCAT(BOARD_BACKEND, nb_pieces_available)
+#define place_piece BOARD_BACKEND_CONCAT(BOARD_BACKEND, place_piece)
+#define pick_piece BOARD_BACKEND_CONCAT(BOARD_BACKEND, pick_piece)
+#define is_move_possible BOARD_BACKEND_CONCAT(BOARD_BACKEND, is_move_possible)
+#define move_piece BOARD_BACKEND_CONCAT(BOARD_BACKEND, move_piece)
+#define swap_piece BOARD_BACKEND_CONCAT(BOARD_BACKEND, swap_piece)
+#define cancel_movement BOARD_BACKEND_CONCAT(BOARD_BACKEND, cancel_movement)
+#define cancel_step BOARD_BACKEND_CONCAT(BOARD_BACKEND, cancel_step)
+// fonction auxiliaire que toutes les implémentations définissent
+#define is_inside BOARD_BACKEND_CONCAT(BOARD_BACKEND, is_inside)
+#endif
+
+#include <stdbool.h>
+#include "board_api.h"
+
+#define BOARD_BACKEND_CODE_MEMBER(index, name, params, args) return_code (*fn_##name) params;
+#define BOARD_BACKEND_VALUE_MEMBER(index, type, name, params, args) type (*fn_##name) params;
+#define BOARD_BACKEND_VOID_MEMBER(index, name, params, args) void (*fn_##name) params;
+
+/**
+ * @brief Une implémentation de board.h : son nom, et un pointeur fn_nom par fonction de board.h.
+ */
+typedef struct {
+	const char *name; /**< nom de l'implémentation, celui du fichier source ("board", "board_V"...) */
+	BOARD_CODE_ENTRIES(BOARD_BACKEND_CODE_MEMBER)
+	BOARD_VALUE_ENTRIES(BOARD_BACKEND_VALUE_MEMBER)
+	BOARD_VOID_ENTRIES(BOARD_BACKEND_VOID_MEMBER)
+} board_backend;
+
+#ifdef BOARD_BACKEND
+#define BOARD_BACKEND_STRING2(prefix) #prefix
+#define BOARD_BACKEND_STRING(prefix) BOARD_BACKEND_STRING2(prefix)
+#define BOARD_BACKEND_CODE_INIT(index, name, params, args) .fn_##name = name,
+#define BOARD_BACKEND_VALUE_INIT(index, type, name, params, args) .fn_##name = name,
+
+/**
+ * @brief Définit la table board_backend_X de l'implémentation compilée sous le préfixe X.
+ */
+#define BOARD_BACKEND_TABLE \
+	const board_backend BOARD_BACKEND_CONCAT(board_backend, BOARD_BACKEND) = { \
+		.name = BOARD_BACKEND_STRING(BOARD_BACKEND), \
+		BOARD_CODE_ENTRIES(BOARD_BACKEND_CODE_INIT) \
+		BOARD_VALUE_ENTRIES(BOARD_BACKEND_VALUE_INIT) \
+		BOARD_VOID_ENTRIES(BOARD_BACKEND_CODE_INIT) \
+	}
+#endif
+
+#ifdef BOARD_BACKEND_DYNAMIC
+/**
+ * @brief Choisit l'implémentation utilisée par les fonctions de board.h.
+ * @param name le nom de l'implémentation ("board", "board_V", "board_W", "board_Wendy").
+ * @return false si aucune implémentation ne porte ce nom (le choix ne change pas).
+ */
+bool board_backend_select(const char *name);
+
+/**
+ * @brief L'implémentation choisie ("board" au départ).
+ */
+const board_backend *board_backend_current(void);
+
+/**
+ * @brief La i-ème implémentation disponible, NULL après la dernière.
+ */
+const board_backend *board_backend_get(int i);
+#endif
+
+#endif /*_BOARD_BACKEND_H_*/
@@ -0,0 +1,6 @@
+// Implémentation board_V.c compilée sous le préfixe board_V_, pour le choix à l'exécution (board_backend.h)
+#define BOARD_BACKEND board_V
+#include "board_backend.h"
+#include "board_V.c"
+
+BOARD_BACKEND_TABLE;
@@ -0,0 +1,6 @@
+// Implémentation board_W.c compilée sous le préfixe board_W_, pour le choix à l'exécution (board_backend.h)
+#define BOARD_BACKEND board_W
+#include "board_backend.h"
+#include "board_W.c"
+
+BOARD_BACKEND_TABLE;
@@ -0,0 +1,6 @@
+// Implémentation board_Wendy.c compilée sous le préfixe board_Wendy_, pour le choix à l'exécution (board_backend.h)
+#define BOARD_BACKEND board_Wendy
+#include "board_backend.h"
+#include "board_Wendy.c"
+
+BOARD_BACKEND_TABLE;
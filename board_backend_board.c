@@ -0,0 +1,6 @@
+// Implémentation board.c compilée sous le préfixe board_, pour le choix à l'exécution (board_backend.h)
+#define BOARD_BACKEND board
+#include "board_backend.h"
+#include "board.c"
+
+BOARD_BACKEND_TABLE;
@@ -0,0 +1,106 @@
+#ifndef _BOARD_S_H_
+#define _BOARD_S_H_
+
+#include <stdint.h>
+#include "board.h"
+#include "board_tables.h"
+#include "eval.h"
+
+/**
+ * \file board_s.h
+ *
+ * \brief Structure interne du plateau, partagée par les modules du moteur.
+ *
+ * Ce fichier n'est inclus que par board.c et les modules qui ont besoin
+ * d'accéder directement à l'état du plateau (évaluation, recherche...).
+ * L'interface de jeu n'utilise que board.h.
+ */
+
+// Structure qui sauvegarde les coordonnées d'un pas  utile pour annulé un move 
+// (des octets : l'historique est recopié avec le plateau)
+typedef struct {
+    signed char old_line;
+    signed char old_col;
+    signed char moves_at_step;
+    signed char edge;
+} step_history;
+
+// Une pièce posée sur la grille
+typedef struct {
+    signed char square;
+    signed char piece; /* ::size */
+} piece_entry;
+
+// Structure principale du plateau de jeu
+struct board_s {
+    size grid[DIMENSION][DIMENSION]; 
+
+    // Tout ce que put_piece et remove_piece tiennent à jour, à la suite de la grille
+    // (en un bloc compact : une écriture dans la grille touche le moins de lignes de cache possible)
+
+    // Clé de Zobrist des pièces de la grille
+    uint64_t key;
+
+    // Cases occupées de la grille (un bit par case, la pièce en main n'y est pas)
+    uint64_t occupied;
+
+    // Liste des pièces posées (la pièce en main n'y est pas) et numéro de chaque case dans la liste (-1 si vide)
+    piece_entry pieces[NB_PIECES];
+    int nb_pieces;
+    signed char square_index[NB_SQUARES];
+
+    // Accumulateurs de l'évaluation, tenus à jour à chaque écriture dans grid
+    eval_features features;
+
+    // Compteurs pour la phase de placement 
+    int setup_counts[NB_PLAYERS + 1][NB_SIZE + 1];
+
+    player winner;
+
+    //Attributs de la pièce en main
+    player current_player;
+    size picked_piece;
+    int p_line;
+    int p_col;
+    int moves_remaining;
+    
+
+    int start_line;
+    int start_col;
+
+    // Segments déjà empruntés par la pièce en main (un bit par segment)
+    uint64_t used_edges;
+
+
+    // Un pas emprunte un segment différent à chaque fois : au plus NB_EDGES pas
+    int history_index;
+    step_history history[NB_EDGES];
+};
+
+/**
+ * @brief Pose une pièce sur une case vide de la grille.
+ *
+ * Toutes les écritures dans la grille passent par cette fonction et ::remove_piece,
+ * qui tiennent à jour la liste des pièces, l'occupation, la clé et l'évaluation.
+ */
+void put_piece(board game, int line, int col, size piece);
+
+/**
+ * @brief Retire la pièce d'une case de la grille et renvoie sa ::size.
+ */
+size remove_piece(board game, int line, int col);
+
+/**
+ * @brief Retire d'un coup toutes les pièces de la grille (la pièce en main n'est pas touchée).
+ */
+void clear_grid(board game);
+
+/**
+ * @brief Clé de Zobrist de la position, avec le joueur qui a le trait.
+ * @param game le plateau, entre deux tours.
+ * @param to_move le joueur qui a le trait.
+ * @return la clé sur 64 bits.
+ */
+uint64_t position_key(board game, player to_move);
+
+#endif /*_BOARD_S_H_*/
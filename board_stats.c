@@ -0,0 +1,224 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "board_stats.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define STATS_RDTSC 1
+#endif
+
+
+// Compteurs d'un thread, chaînés pour la somme
+typedef struct stats_block {
+    board_stats stats;
+    struct stats_block *next;
+} stats_block;
+
+static stats_block *all_blocks = NULL;
+static pthread_mutex_t blocks_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *entry_names[NB_BOARD_ENTRIES] = {
+#define CODE_NAME(index, name, params, args) [index] = #name,
+#define VALUE_NAME(index, type, name, params, args) [index] = #name,
+    BOARD_CODE_ENTRIES(CODE_NAME)
+    BOARD_VALUE_ENTRIES(VALUE_NAME)
+    BOARD_VOID_ENTRIES(CODE_NAME)
+};
+
+static const bool entry_has_code[NB_BOARD_ENTRIES] = {
+#define CODE_FLAG(index, name, params, args) [index] = true,
+    BOARD_CODE_ENTRIES(CODE_FLAG)
+};
+
+static const char *event_names[NB_BOARD_EVENTS] = { "bounces", "swaps", "cancels", "goals" };
+static const char *result_names[PARAM + 1] = { "ok", "empty", "forbidden", "param" };
+
+const char *board_stats_unit(void) {
+#ifdef STATS_RDTSC
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+// Lecture et écriture d'un compteur : seul son thread l'écrit, les autres peuvent le lire pendant ce temps
+static inline uint64_t load(const uint64_t *counter) {
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+static inline void add(uint64_t *counter, uint64_t value) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+void board_stats_merge(board_stats *out) {
+    uint64_t *sum = (uint64_t *)out;
+    uint64_t max_time[NB_BOARD_ENTRIES] = { 0 };
+
+    memset(out, 0, sizeof(*out));
+    pthread_mutex_lock(&blocks_lock);
+    for (stats_block *b = all_blocks; b != NULL; b = b->next) {
+        const uint64_t *counters = (const uint64_t *)&b->stats;
+        for (size_t i = 0; i < sizeof(board_stats) / sizeof(uint64_t); i++) {
+            sum[i] += load(&counters[i]);
+        }
+        for (int e = 0; e < NB_BOARD_ENTRIES; e++) {
+            uint64_t t = load(&b->stats.entries[e].max_time);
+            if (t > max_time[e])
+            {
+                max_time[e] = t;
+            }
+        }
+    }
+    pthread_mutex_unlock(&blocks_lock);
+
+    //les maxima ne s'additionnent pas
+    for (int e = 0; e < NB_BOARD_ENTRIES; e++) {
+        out->entries[e].max_time = max_time[e];
+    }
+}
+
+void board_stats_reset(void) {
+    pthread_mutex_lock(&blocks_lock);
+    for (stats_block *b = all_blocks; b != NULL; b = b->next) {
+        uint64_t *counters = (uint64_t *)&b->stats;
+        for (size_t i = 0; i < sizeof(board_stats) / sizeof(uint64_t); i++) {
+            __atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+        }
+    }
+    pthread_mutex_unlock(&blocks_lock);
+}
+
+void board_stats_dump_json(FILE *out) {
+    board_stats s;
+    board_stats_merge(&s);
+
+#ifdef BOARD_STATS
+    fprintf(out, "{\n  \"enabled\": true,\n");
+#else
+    fprintf(out, "{\n  \"enabled\": false,\n");
+#endif
+    fprintf(out, "  \"unit\": \"%s\",\n  \"events\": {", board_stats_unit());
+    for (int e = 0; e < NB_BOARD_EVENTS; e++) {
+        fprintf(out, "%s\"%s\": %llu", e > 0 ? ", " : " ", event_names[e], (unsigned long long)s.events[e]);
+    }
+    fprintf(out, " },\n  \"entries\": {");
+
+    bool first = true;
+    for (int e = 0; e < NB_BOARD_ENTRIES; e++) {
+        const entry_stats *es = &s.entries[e];
+        if (es->calls == 0)
+        {
+            continue;
+        }
+
+        fprintf(out, "%s\n    \"%s\": { \"calls\": %llu", first ? "" : ",", entry_names[e], (unsigned long long)es->calls);
+        first = false;
+        if (entry_has_code[e])
+        {
+            for (int r = OK; r <= PARAM; r++) {
+                fprintf(out, ", \"%s\": %llu", result_names[r], (unsigned long long)es->results[r]);
+            }
+        }
+        fprintf(out, ", \"total\": %llu, \"mean\": %.1f, \"max\": %llu, \"histogram\": [",
+                (unsigned long long)es->total_time, (double)es->total_time / es->calls, (unsigned long long)es->max_time);
+
+        //classes jusqu'à la dernière non vide
+        int last = STATS_BUCKETS - 1;
+        while (last > 0 && es->buckets[last] == 0) {
+            last--;
+        }
+        for (int b = 0; b <= last; b++) {
+            fprintf(out, "%s%llu", b > 0 ? ", " : "", (unsigned long long)es->buckets[b]);
+        }
+        fprintf(out, "] }");
+    }
+    fprintf(out, "\n  }\n}\n");
+}
+
+#ifdef BOARD_STATS
+
+static __thread stats_block *local = NULL;
+
+// Compteurs du thread, créés au premier appel et gardés après sa fin pour la somme
+static board_stats *thread_stats(void) {
+    if (local == NULL)
+    {
+        local = calloc(1, sizeof(stats_block));
+        if (local == NULL)
+        {
+            abort();
+        }
+        pthread_mutex_lock(&blocks_lock);
+        local->next = all_blocks;
+        all_blocks = local;
+        pthread_mutex_unlock(&blocks_lock);
+    }
+    return &local->stats;
+}
+
+static inline uint64_t stats_clock(void) {
+#ifdef STATS_RDTSC
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static void record(board_entry entry, uint64_t start, int result) {
+    uint64_t elapsed = stats_clock() - start;
+    entry_stats *es = &thread_stats()->entries[entry];
+    int bucket = (elapsed == 0) ? 0 : 64 - __builtin_clzll(elapsed);
+
+    add(&es->calls, 1);
+    if (result >= 0)
+    {
+        add(&es->results[result], 1);
+    }
+    add(&es->total_time, elapsed);
+    if (elapsed > load(&es->max_time))
+    {
+        __atomic_store_n(&es->max_time, elapsed, __ATOMIC_RELAXED);
+    }
+    add(&es->buckets[bucket < STATS_BUCKETS ? bucket : STATS_BUCKETS - 1], 1);
+}
+
+void board_stats_event(board_event event) {
+    add(&thread_stats()->events[event], 1);
+}
+
+// Les vraies fonctions de board.h : mesure de l'appel à la version de board.c
+#define CODE_WRAPPER(index, name, params, args) \
+    return_code name##_impl params; \
+    return_code name params { \
+        uint64_t start = stats_clock(); \
+        return_code rc = name##_impl args; \
+        record(index, start, rc); \
+        return rc; \
+    }
+
+#define VALUE_WRAPPER(index, type, name, params, args) \
+    type name##_impl params; \
+    type name params { \
+        uint64_t start = stats_clock(); \
+        type value = name##_impl args; \
+        record(index, start, -1); \
+        return value; \
+    }
+
+#define VOID_WRAPPER(index, name, params, args) \
+    void name##_impl params; \
+    void name params { \
+        uint64_t start = stats_clock(); \
+        name##_impl args; \
+        record(index, start, -1); \
+    }
+
+BOARD_CODE_ENTRIES(CODE_WRAPPER)
+BOARD_VALUE_ENTRIES(VALUE_WRAPPER)
+BOARD_VOID_ENTRIES(VOID_WRAPPER)
+
+#endif
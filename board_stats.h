@@ -0,0 +1,137 @@
+#ifndef _BOARD_STATS_H_
+#define _BOARD_STATS_H_
+
+/**
+ * \file board_stats.h
+ *
+ * \brief Compteurs et chronomètres des points d'entrée de board.h.
+ *
+ * Ils ne sont compilés que si ::BOARD_STATS est défini, pour board.c comme pour board_stats.c :
+ * \code
+ * gcc -DBOARD_STATS -pthread ... board.c board_stats.c ...
+ * \endcode
+ * Les fonctions de board.c sont alors compilées sous le nom nom_impl, et board_stats.c
+ * définit les vraies, qui mesurent l'appel. Les appels internes à board.c ne sont pas comptés.
+ * Sans ::BOARD_STATS, board.c est inchangé et les fonctions ci-dessous ne rapportent rien.
+ *
+ * Chaque thread a ses compteurs, sans verrou ; ::board_stats_merge les additionne à la demande.
+ * Les durées sont en cycles (rdtsc) sur x86, en nanosecondes (clock_gettime) ailleurs.
+ */
+
+#if defined(BOARD_STATS) && defined(BOARD_STATS_IMPL)
+// board.c : les points d'entrée prennent le nom nom_impl (avant la lecture de board.h)
+#define next_player next_player_impl
+#define new_game new_game_impl
+#define copy_game copy_game_impl
+#define destroy_game destroy_game_impl
+#define get_piece_size get_piece_size_impl
+#define get_winner get_winner_impl
+#define southmost_occupied_line southmost_occupied_line_impl
+#define northmost_occupied_line northmost_occupied_line_impl
+#define picked_piece_owner picked_piece_owner_impl
+#define picked_piece_size picked_piece_size_impl
+#define picked_piece_line picked_piece_line_impl
+#define picked_piece_column picked_piece_column_impl
+#define movement_left movement_left_impl
+#define nb_pieces_available nb_pieces_available_impl
+#define place_piece place_piece_impl
+#define pick_piece pick_piece_impl
+#define is_move_possible is_move_possible_impl
+#define move_piece move_piece_impl
+#define swap_piece swap_piece_impl
+#define cancel_movement cancel_movement_impl
+#define cancel_step cancel_step_impl
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include "board_api.h"
+
+#define BOARD_STATS_CODE_INDEX(index, name, params, args) index,
+#define BOARD_STATS_VALUE_INDEX(index, type, name, params, args) index,
+
+/**
+ * @brief Les points d'entrée mesurés.
+ */
+typedef enum {
+	BOARD_CODE_ENTRIES(BOARD_STATS_CODE_INDEX)
+	BOARD_VALUE_ENTRIES(BOARD_STATS_VALUE_INDEX)
+	BOARD_VOID_ENTRIES(BOARD_STATS_CODE_INDEX)
+	NB_BOARD_ENTRIES
+} board_entry;
+
+/**
+ * @brief Événements comptés à l'intérieur des mouvements.
+ */
+typedef enum {
+	EVENT_BOUNCE, /**< un pas qui part d'une pièce rencontrée (rebond) */
+	EVENT_SWAP, /**< un échange réussi */
+	EVENT_CANCEL, /**< une annulation réussie, d'un pas ou du mouvement */
+	EVENT_GOAL, /**< une pièce entrée dans le but */
+	NB_BOARD_EVENTS
+} board_event;
+
+/**
+ * @brief nombre de classes de durée : la classe i compte les durées de 2^(i-1) à 2^i - 1.
+ */
+#define STATS_BUCKETS 32
+
+/**
+ * @brief Mesures d'un point d'entrée.
+ */
+typedef struct {
+	uint64_t calls; /**< nombre d'appels */
+	uint64_t results[PARAM + 1]; /**< appels par ::return_code renvoyé (points d'entrée qui en renvoient un) */
+	uint64_t total_time; /**< somme des durées */
+	uint64_t max_time; /**< plus longue durée */
+	uint64_t buckets[STATS_BUCKETS]; /**< répartition des durées */
+} entry_stats;
+
+/**
+ * @brief Toutes les mesures d'un thread, ou leur somme.
+ */
+typedef struct {
+	entry_stats entries[NB_BOARD_ENTRIES]; /**< par ::board_entry */
+	uint64_t events[NB_BOARD_EVENTS]; /**< par ::board_event */
+} board_stats;
+
+#ifdef BOARD_STATS
+/**
+ * @brief Compte un événement dans les compteurs du thread (rien sans ::BOARD_STATS).
+ */
+#define BOARD_EVENT(event) board_stats_event(event)
+void board_stats_event(board_event event);
+#else
+#define BOARD_EVENT(event) ((void)0)
+#endif
+
+/**
+ * @brief Additionne les compteurs de tous les threads, y compris ceux qui sont terminés.
+ * @param out reçoit la somme (tout à zéro sans ::BOARD_STATS).
+ */
+void board_stats_merge(board_stats *out);
+
+/**
+ * @brief Remet tous les compteurs à zéro.
+ *
+ * Les compteurs d'un thread qui joue pendant la remise à zéro peuvent garder quelques appels.
+ */
+void board_stats_reset(void);
+
+/**
+ * @brief Unité des durées : "cycles" ou "ns".
+ */
+const char *board_stats_unit(void);
+
+/**
+ * @brief Écrit la somme des compteurs en JSON.
+ *
+ * Un objet avec "enabled", "unit", "events" et "entries" ; chaque point d'entrée appelé
+ * y a ses appels, ses résultats, ses durées totale, moyenne et maximale,
+ * et "histogram", le nombre d'appels de chaque classe de durée.
+ *
+ * @param out le fichier.
+ */
+void board_stats_dump_json(FILE *out);
+
+#endif /*_BOARD_STATS_H_*/
@@ -0,0 +1,102 @@
+#include "board_tables.h"
+
+
+// Les tables sont écrites par le préprocesseur : FOR_LINES et FOR_COLS répètent une macro
+// pour chaque ligne / colonne, selon la valeur de DIMENSION.
+#if DIMENSION < 1 || DIMENSION > 8
+#error "board_tables.c ne sait générer les tables que pour DIMENSION de 1 à 8"
+#endif
+
+#define LINES_1(f) f(0)
+#define LINES_2(f) LINES_1(f) f(1)
+#define LINES_3(f) LINES_2(f) f(2)
+#define LINES_4(f) LINES_3(f) f(3)
+#define LINES_5(f) LINES_4(f) f(4)
+#define LINES_6(f) LINES_5(f) f(5)
+#define LINES_7(f) LINES_6(f) f(6)
+#define LINES_8(f) LINES_7(f) f(7)
+
+#define COLS_1(f, l) f(l, 0)
+#define COLS_2(f, l) COLS_1(f, l) f(l, 1)
+#define COLS_3(f, l) COLS_2(f, l) f(l, 2)
+#define COLS_4(f, l) COLS_3(f, l) f(l, 3)
+#define COLS_5(f, l) COLS_4(f, l) f(l, 4)
+#define COLS_6(f, l) COLS_5(f, l) f(l, 5)
+#define COLS_7(f, l) COLS_6(f, l) f(l, 6)
+#define COLS_8(f, l) COLS_7(f, l) f(l, 7)
+
+// indirections pour que DIMENSION soit remplacé par sa valeur avant le collage
+#define FOR_LINES__(n, f) LINES_##n(f)
+#define FOR_LINES_(n, f) FOR_LINES__(n, f)
+#define FOR_LINES(f) FOR_LINES_(DIMENSION, f)
+
+#define FOR_COLS__(n, f, l) COLS_##n(f, l)
+#define FOR_COLS_(n, f, l) FOR_COLS__(n, f, l)
+#define FOR_COLS(f, l) FOR_COLS_(DIMENSION, f, l)
+
+// segments horizontaux (l,c)-(l,c+1) puis verticaux (l,c)-(l+1,c)
+#define H_EDGE(l, c) ((l) * (DIMENSION - 1) + (c))
+#define V_EDGE(l, c) (DIMENSION * (DIMENSION - 1) + (l) * DIMENSION + (c))
+
+// une entrée par direction, dans l'ordre de l'énumération : GOAL, SOUTH, NORTH, EAST, WEST
+#define NEIGHBOURS(l, c) { \
+    NO_SQUARE, \
+    (l) > 0 ? SQUARE((l) - 1, c) : NO_SQUARE, \
+    (l) < DIMENSION - 1 ? SQUARE((l) + 1, c) : NO_SQUARE, \
+    (c) < DIMENSION - 1 ? SQUARE(l, (c) + 1) : NO_SQUARE, \
+    (c) > 0 ? SQUARE(l, (c) - 1) : NO_SQUARE },
+#define NEIGHBOURS_LINE(l) FOR_COLS(NEIGHBOURS, l)
+
+#define EDGES(l, c) { \
+    NO_EDGE, \
+    (l) > 0 ? V_EDGE((l) - 1, c) : NO_EDGE, \
+    (l) < DIMENSION - 1 ? V_EDGE(l, c) : NO_EDGE, \
+    (c) < DIMENSION - 1 ? H_EDGE(l, c) : NO_EDGE, \
+    (c) > 0 ? H_EDGE(l, (c) - 1) : NO_EDGE },
+#define EDGES_LINE(l) FOR_COLS(EDGES, l)
+
+// le joueur SUD vise le but nord (dernière ligne), le joueur NORD le but sud (ligne 0)
+#define GOAL_FLAGS(l, c) \
+    (((l) == DIMENSION - 1) ? (1 << SOUTH_P) : 0) | (((l) == 0) ? (1 << NORTH_P) : 0),
+#define GOAL_FLAGS_LINE(l) FOR_COLS(GOAL_FLAGS, l)
+
+const signed char neighbour_table[NB_SQUARES][NB_DIRECTIONS] = { FOR_LINES(NEIGHBOURS_LINE) };
+
+const signed char edge_table[NB_SQUARES][NB_DIRECTIONS] = { FOR_LINES(EDGES_LINE) };
+
+const unsigned char goal_flags[NB_SQUARES] = { FOR_LINES(GOAL_FLAGS_LINE) };
+
+// clés de Zobrist : le mélange splitmix64 est une expression constante, évaluée à la compilation
+#define MIX_A(z) (((z) ^ ((z) >> 30)) * 0xbf58476d1ce4e5b9ULL)
+#define MIX_B(z) (((z) ^ ((z) >> 27)) * 0x94d049bb133111ebULL)
+#define MIX_C(z) ((z) ^ ((z) >> 31))
+#define SPLITMIX(x) MIX_C(MIX_B(MIX_A((uint64_t)(x) * 0x9e3779b97f4a7c15ULL + 0x9e3779b97f4a7c15ULL)))
+
+#define ZOBRIST(l, c) { 0, SPLITMIX(SQUARE(l, c) * 4 + 1), SPLITMIX(SQUARE(l, c) * 4 + 2), SPLITMIX(SQUARE(l, c) * 4 + 3) },
+#define ZOBRIST_LINE(l) FOR_COLS(ZOBRIST, l)
+
+const uint64_t zobrist_table[NB_SQUARES][NB_SIZE + 1] = { FOR_LINES(ZOBRIST_LINE) };
+
+const uint64_t zobrist_side[NB_PLAYERS + 1] = { 0, SPLITMIX(4 * NB_SQUARES + 1), SPLITMIX(4 * NB_SQUARES + 2) };
+
+// C(n, k) = C(n, k - 1) * (n - k + 1) / k : chaque division est exacte
+#define BINOM_0(n) 1ULL
+#define BINOM_1(n) (BINOM_0(n) * (n) / 1)
+#define BINOM_2(n) (BINOM_1(n) * ((n) - 1) / 2)
+#define BINOM_3(n) (BINOM_2(n) * ((n) - 2) / 3)
+#define BINOM_4(n) (BINOM_3(n) * ((n) - 3) / 4)
+#define BINOM_5(n) (BINOM_4(n) * ((n) - 4) / 5)
+#define BINOM_6(n) (BINOM_5(n) * ((n) - 5) / 6)
+#define BINOM_7(n) (BINOM_6(n) * ((n) - 6) / 7)
+#define BINOM_8(n) (BINOM_7(n) * ((n) - 7) / 8)
+#define BINOM_9(n) (BINOM_8(n) * ((n) - 8) / 9)
+#define BINOM_10(n) (BINOM_9(n) * ((n) - 9) / 10)
+#define BINOM_11(n) (BINOM_10(n) * ((n) - 10) / 11)
+#define BINOM_12(n) (BINOM_11(n) * ((n) - 11) / 12)
+
+#define BINOM_ROW(n) { BINOM_0(n), BINOM_1(n), BINOM_2(n), BINOM_3(n), BINOM_4(n), BINOM_5(n), BINOM_6(n), \
+    BINOM_7(n), BINOM_8(n), BINOM_9(n), BINOM_10(n), BINOM_11(n), BINOM_12(n) },
+#define BINOM_SQUARE(l, c) BINOM_ROW(SQUARE(l, c))
+#define BINOM_LINE(l) FOR_COLS(BINOM_SQUARE, l)
+
+const uint64_t binomial_table[NB_SQUARES + 1][MAX_BINOMIAL_K + 1] = { FOR_LINES(BINOM_LINE) BINOM_ROW(NB_SQUARES) };
@@ -0,0 +1,101 @@
+#ifndef _BOARD_TABLES_H_
+#define _BOARD_TABLES_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file board_tables.h
+ *
+ * \brief Tables de déplacement précalculées pour la dimension du plateau.
+ *
+ * Les cases sont numérotées de 0 à ::NB_SQUARES - 1, ligne par ligne en partant du sud.
+ * Les tables sont construites à la compilation à partir de ::DIMENSION
+ * (voir board_tables.c) : changer ::DIMENSION dans board.h suffit à les régénérer.
+ */
+
+/**
+ * @brief nombre de cases du plateau.
+ */
+#define NB_SQUARES (DIMENSION * DIMENSION)
+
+/**
+ * @brief nombre de pièces en jeu : chaque joueur place ::NB_INITIAL_PIECES pièces de chaque taille.
+ */
+#define NB_PIECES (NB_PLAYERS * NB_SIZE * NB_INITIAL_PIECES)
+
+/**
+ * @brief nombre de segments entre deux cases voisines.
+ */
+#define NB_EDGES (2 * DIMENSION * (DIMENSION - 1))
+
+/**
+ * @brief valeur des tables pour une case ou un segment inexistant (hors du plateau).
+ */
+#define NO_SQUARE (-1)
+#define NO_EDGE (-1)
+
+/**
+ * @brief numéro de la case (line, column), et coordonnées d'une case.
+ */
+#define SQUARE(line, column) ((line) * DIMENSION + (column))
+#define SQUARE_LINE(square) ((square) / DIMENSION)
+#define SQUARE_COL(square) ((square) % DIMENSION)
+
+/**
+ * @brief masque des cases d'une ligne, et de la ligne d'où le joueur peut jouer ::GOAL.
+ */
+#define LINE_MASK(line) (((((uint64_t)1) << DIMENSION) - 1) << ((line) * DIMENSION))
+#define GOAL_LINE_MASK(p) ((p) == SOUTH_P ? LINE_MASK(DIMENSION - 1) : LINE_MASK(0))
+
+/**
+ * @brief masque de toutes les cases du plateau.
+ */
+#define BOARD_MASK (NB_SQUARES == 64 ? ~(uint64_t)0 : (((uint64_t)1) << (NB_SQUARES % 64)) - 1)
+
+/**
+ * @brief nombre d'entrées par case dans les tables indexées par ::direction.
+ */
+#define NB_DIRECTIONS 5
+
+// les segments empruntés par une pièce sont mémorisés dans un masque de 64 bits
+_Static_assert(NB_EDGES <= 64, "DIMENSION trop grande pour les masques de segments");
+
+/**
+ * @brief case voisine dans chaque direction, ::NO_SQUARE hors du plateau (et pour ::GOAL).
+ */
+extern const signed char neighbour_table[NB_SQUARES][NB_DIRECTIONS];
+
+/**
+ * @brief numéro du segment parcouru en quittant la case dans chaque direction, ::NO_EDGE sinon.
+ */
+extern const signed char edge_table[NB_SQUARES][NB_DIRECTIONS];
+
+/**
+ * @brief pour chaque case, le bit (1 << joueur) est levé si le joueur peut y jouer ::GOAL.
+ */
+extern const unsigned char goal_flags[NB_SQUARES];
+
+/**
+ * @brief clé de Zobrist d'une pièce de chaque ::size sur chaque case (0 pour ::NONE).
+ */
+extern const uint64_t zobrist_table[NB_SQUARES][NB_SIZE + 1];
+
+/**
+ * @brief clé de Zobrist du joueur qui a le trait.
+ */
+extern const uint64_t zobrist_side[NB_PLAYERS + 1];
+
+/**
+ * @brief plus grand k de ::binomial_table : les positions rangées ont au plus 12 pièces.
+ */
+#define MAX_BINOMIAL_K 12
+
+_Static_assert(NB_PIECES <= MAX_BINOMIAL_K, "trop de pièces pour binomial_table");
+
+/**
+ * @brief coefficients binomiaux : binomial_table[n][k] = C(n, k), nul si k > n.
+ */
+extern const uint64_t binomial_table[NB_SQUARES + 1][MAX_BINOMIAL_K + 1];
+
+#endif /*_BOARD_TABLES_H_*/
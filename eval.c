@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <string.h>
+#include "board_s.h"
+#include "eval.h"
+
+
+// Poids par défaut des termes (dans l'ordre de eval_term)
+int eval_weights[NB_EVAL_TERMS] = { 4, 40, 2, 4, 6, 3, 10 };
+
+// Cases des lignes first à last
+static uint64_t lines_mask(int first, int last) {
+    uint64_t mask = 0;
+    for (int l = first; l <= last; l++) {
+        mask |= LINE_MASK(l);
+    }
+    return mask;
+}
+
+// Moitié du plateau de chaque joueur
+static uint64_t half_mask(player p) {
+    if (p == SOUTH_P)
+    {
+        return lines_mask(0, DIMENSION / 2 - 1);
+    }
+    return lines_mask(DIMENSION / 2, DIMENSION - 1);
+}
+
+// Cases d'où une pièce de cette taille peut atteindre la ligne du but adverse de p
+static uint64_t threat_mask(player p, size piece) {
+    if (p == SOUTH_P)
+    {
+        return lines_mask(DIMENSION - 1 - (int)piece, DIMENSION - 1);
+    }
+    return lines_mask(0, (int)piece);
+}
+
+// Cases d'une colonne
+static uint64_t column_mask(int column) {
+    uint64_t mask = 0;
+    for (int l = 0; l < DIMENSION; l++) {
+        mask |= (uint64_t)1 << SQUARE(l, column);
+    }
+    return mask;
+}
+
+// Somme des voisins vides des pièces d'une ligne : une direction à la fois, sur le masque des cases occupées
+static int line_mobility(uint64_t occupied, int line) {
+    uint64_t pieces = occupied & LINE_MASK(line);
+    uint64_t empty = ~occupied & BOARD_MASK;
+    uint64_t east = pieces & ~column_mask(DIMENSION - 1);
+    uint64_t west = pieces & ~column_mask(0);
+
+    return __builtin_popcountll((pieces << DIMENSION) & empty)
+        + __builtin_popcountll((pieces >> DIMENSION) & empty)
+        + __builtin_popcountll((east << 1) & empty)
+        + __builtin_popcountll((west >> 1) & empty);
+}
+
+// Pièces d'une taille (toutes pour NONE) sur une ligne
+static int line_size(const eval_features *features, int line, size piece) {
+    return __builtin_popcountll(features->squares[piece] & LINE_MASK(line));
+}
+
+// Pièces qui peuvent atteindre la ligne du but adverse de p
+static int threats(const eval_features *features, player p) {
+    int count = 0;
+    for (size s = ONE; s <= THREE; s++) {
+        count += __builtin_popcountll(features->squares[s] & threat_mask(p, s));
+    }
+    return count;
+}
+
+void eval_reset(eval_features *features) {
+    memset(features, 0, sizeof(eval_features));
+}
+
+void eval_add_piece(eval_features *features, size grid[DIMENSION][DIMENSION], int line, int column) {
+    uint64_t bit = (uint64_t)1 << SQUARE(line, column);
+
+    features->squares[grid[line][column]] |= bit;
+    features->squares[NONE] |= bit;
+}
+
+void eval_remove_piece(eval_features *features, size grid[DIMENSION][DIMENSION], int line, int column, size piece) {
+    uint64_t bit = (uint64_t)1 << SQUARE(line, column);
+
+    (void)grid;
+    features->squares[piece] &= ~bit;
+    features->squares[NONE] &= ~bit;
+}
+
+int eval_active_line(const eval_features *features, player p) {
+    uint64_t squares = features->squares[NONE];
+
+    if (squares == 0)
+    {
+        return -1;
+    }
+    if (p == SOUTH_P)
+    {
+        return __builtin_ctzll(squares) / DIMENSION;
+    }
+    return (63 - __builtin_clzll(squares)) / DIMENSION;
+}
+
+void eval_terms(board game, player p, int terms[NB_EVAL_TERMS]) {
+    const eval_features *f = &game->features;
+    player opponent = next_player(p);
+    int own_line = eval_active_line(f, p);
+    int opp_line = eval_active_line(f, opponent);
+
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        terms[t] = 0;
+    }
+
+    terms[TERM_SIDE] = __builtin_popcountll(f->squares[NONE] & half_mask(opponent)) - __builtin_popcountll(f->squares[NONE] & half_mask(p));
+    terms[TERM_THREAT] = threats(f, p) - threats(f, opponent);
+    terms[TERM_TEMPO] = 1;
+
+    //plateau vide : seuls les termes globaux ont un sens
+    if (own_line < 0 || opp_line < 0)
+    {
+        return;
+    }
+
+    terms[TERM_ONE] = line_size(f, own_line, ONE) - line_size(f, opp_line, ONE);
+    terms[TERM_TWO] = line_size(f, own_line, TWO) - line_size(f, opp_line, TWO);
+    terms[TERM_THREE] = line_size(f, own_line, THREE) - line_size(f, opp_line, THREE);
+    terms[TERM_MOBILITY] = line_mobility(f->squares[NONE], own_line) - line_mobility(f->squares[NONE], opp_line);
+}
+
+int evaluate(board game, player p) {
+    if (game->winner != NO_PLAYER)
+    {
+        return (game->winner == p) ? EVAL_WIN : -EVAL_WIN;
+    }
+
+    int terms[NB_EVAL_TERMS];
+    eval_terms(game, p, terms);
+
+    int score = 0;
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        score += eval_weights[t] * terms[t];
+    }
+    return score;
+}
@@ -0,0 +1,121 @@
+#ifndef _EVAL_H_
+#define _EVAL_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file eval.h
+ *
+ * \brief Évaluation statique des positions pour les joueurs artificiels.
+ *
+ * Les termes de l'évaluation sont calculés à partir d'accumulateurs
+ * (::eval_features) rangés dans le plateau et mis à jour de façon incrémentale
+ * à chaque fois qu'une pièce est posée ou retirée de la grille
+ * (place_piece, pick_piece, move_piece, swap_piece et les annulations).
+ * Ce sont des masques de cases : une pose ou un retrait ne change qu'un bit,
+ * et évaluer une position ne demande aucun parcours des 36 cases,
+ * seulement des comptes de bits sur ces masques.
+ */
+
+/**
+ * @brief valeur renvoyée par ::evaluate quand la partie est gagnée.
+ */
+#define EVAL_WIN 100000
+
+/**
+ * @brief les différents termes de l'évaluation.
+ *
+ * Chaque terme est exprimé du point de vue du joueur évalué
+ * (valeur du joueur moins valeur de l'adversaire).
+ */
+typedef enum eval_term_e {
+	TERM_SIDE, /**< pièces dans la moitié adverse du plateau */
+	TERM_THREAT, /**< pièces assez grandes pour atteindre la ligne du but adverse */
+	TERM_ONE, /**< pièces ::ONE sur la ligne active */
+	TERM_TWO, /**< pièces ::TWO sur la ligne active */
+	TERM_THREE, /**< pièces ::THREE sur la ligne active */
+	TERM_MOBILITY, /**< cases libres autour des pièces de la ligne active */
+	TERM_TEMPO, /**< constante, bonus du joueur qui a le trait */
+	} eval_term;
+
+/**
+ * @brief nombre de termes de l'évaluation.
+ */
+#define NB_EVAL_TERMS 7
+
+/**
+ * @brief Accumulateurs de l'évaluation.
+ *
+ * Les masques décrivent uniquement les pièces posées sur la grille :
+ * la pièce en main pendant un mouvement n'y figure pas.
+ */
+typedef struct {
+	uint64_t squares[NB_SIZE + 1]; /**< cases des pièces de chaque taille (bit SQUARE(l, c)), [NONE] = toutes les pièces */
+} eval_features;
+
+/**
+ * @brief poids de chaque terme, modifiables (par exemple par un réglage automatique).
+ */
+extern int eval_weights[NB_EVAL_TERMS];
+
+/**
+ * @brief Remet les accumulateurs à zéro (plateau vide).
+ * @param features les accumulateurs à initialiser.
+ */
+void eval_reset(eval_features *features);
+
+/**
+ * @brief Met à jour les accumulateurs après la pose d'une pièce.
+ *
+ * Doit être appelée après l'écriture de la pièce dans la grille.
+ *
+ * @param features les accumulateurs à mettre à jour.
+ * @param grid la grille, contenant déjà la pièce posée.
+ * @param line la ligne de la pièce.
+ * @param column la colonne de la pièce.
+ */
+void eval_add_piece(eval_features *features, size grid[DIMENSION][DIMENSION], int line, int column);
+
+/**
+ * @brief Met à jour les accumulateurs après le retrait d'une pièce.
+ *
+ * Doit être appelée après l'effacement de la case dans la grille.
+ *
+ * @param features les accumulateurs à mettre à jour.
+ * @param grid la grille, où la case est déjà vide.
+ * @param line la ligne de la pièce retirée.
+ * @param column la colonne de la pièce retirée.
+ * @param piece la ::size de la pièce retirée.
+ */
+void eval_remove_piece(eval_features *features, size grid[DIMENSION][DIMENSION], int line, int column, size piece);
+
+/**
+ * @brief Renvoie la ligne depuis laquelle le joueur doit jouer, -1 si le plateau est vide.
+ * @param features les accumulateurs du plateau.
+ * @param p le joueur.
+ * @return la ligne active du joueur.
+ */
+int eval_active_line(const eval_features *features, player p);
+
+/**
+ * @brief Calcule les termes de l'évaluation du point de vue d'un joueur.
+ * @param game le plateau.
+ * @param p le joueur dont on prend le point de vue.
+ * @param terms tableau de ::NB_EVAL_TERMS valeurs à remplir.
+ */
+void eval_terms(board game, player p, int terms[NB_EVAL_TERMS]);
+
+/**
+ * @brief Évalue la position du point de vue d'un joueur.
+ *
+ * Renvoie ::EVAL_WIN (ou -::EVAL_WIN) si la partie a un gagnant,
+ * sinon la somme pondérée des termes.
+ *
+ * @param game le plateau.
+ * @param p le joueur dont on prend le point de vue.
+ * @return le score, positif si la position est favorable à p.
+ */
+int evaluate(board game, player p);
+
+#endif /*_EVAL_H_*/
@@ -0,0 +1,266 @@
+#include "board_s.h"
+#include "eval_batch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_AVX2_KERNEL 1
+#endif
+
+
+// Les termes sont calculés du point de vue de SOUTH_P puis changés de signe pour NORTH_P :
+// ils sont tous antisymétriques, sauf TERM_TEMPO qui vaut toujours 1.
+
+// Masques de colonnes, de moitié et de menaces
+static inline uint64_t column_mask(int column) {
+    uint64_t mask = 0;
+    for (int l = 0; l < DIMENSION; l++) {
+        mask |= (uint64_t)1 << SQUARE(l, column);
+    }
+    return mask;
+}
+
+// Moitié sud du plateau (les lignes de la moitié de SOUTH_P dans eval.c)
+static inline uint64_t south_half_mask(void) {
+    uint64_t mask = 0;
+    for (int l = 0; l < DIMENSION / 2; l++) {
+        mask |= LINE_MASK(l);
+    }
+    return mask;
+}
+
+// Cases d'où une pièce de taille s menace la ligne du but adverse de p
+static inline uint64_t threat_mask(player p, int s) {
+    uint64_t mask = 0;
+    for (int l = 0; l < DIMENSION; l++) {
+        int distance = (p == SOUTH_P) ? DIMENSION - 1 - l : l;
+        if (distance <= s)
+        {
+            mask |= LINE_MASK(l);
+        }
+    }
+    return mask;
+}
+
+void eval_batch_clear(eval_batch *batch) {
+    batch->nb = 0;
+}
+
+int eval_batch_add(eval_batch *batch, board game, player p) {
+    if (batch->nb >= EVAL_BATCH_SIZE)
+    {
+        return -1;
+    }
+
+    int i = batch->nb++;
+    uint64_t masks[NB_SIZE + 1] = { 0 };
+    for (int k = 0; k < game->nb_pieces; k++) {
+        masks[game->pieces[k].piece] |= (uint64_t)1 << game->pieces[k].square;
+    }
+    for (int s = ONE; s <= THREE; s++) {
+        batch->pieces[s - 1][i] = masks[s];
+    }
+    batch->to_move[i] = (p == NORTH_P) ? ~(uint64_t)0 : 0;
+    return i;
+}
+
+// Masques utilisés par les noyaux, calculés une fois par appel
+typedef struct {
+    uint64_t not_last;      // toutes les colonnes sauf la dernière
+    uint64_t not_first;     // toutes les colonnes sauf la première
+    uint64_t south_half;
+    uint64_t threats[NB_PLAYERS + 1][NB_SIZE + 1];
+} batch_masks;
+
+static void init_masks(batch_masks *m) {
+    m->not_last = ~column_mask(DIMENSION - 1);
+    m->not_first = ~column_mask(0);
+    m->south_half = south_half_mask();
+    for (int s = ONE; s <= THREE; s++) {
+        m->threats[SOUTH_P][s] = threat_mask(SOUTH_P, s);
+        m->threats[NORTH_P][s] = threat_mask(NORTH_P, s);
+    }
+}
+
+// Voisins vides des pièces de pieces (une case vide comptée une fois par pièce voisine)
+static inline int free_neighbours(const batch_masks *m, uint64_t pieces, uint64_t empty) {
+    return __builtin_popcountll(pieces & (empty >> DIMENSION))
+        + __builtin_popcountll(pieces & (empty << DIMENSION))
+        + __builtin_popcountll(pieces & (empty >> 1) & m->not_last)
+        + __builtin_popcountll(pieces & (empty << 1) & m->not_first);
+}
+
+static void evaluate_scalar(const eval_batch *batch, int *scores) {
+    batch_masks m;
+    init_masks(&m);
+
+    for (int i = 0; i < batch->nb; i++) {
+        uint64_t one = batch->pieces[ONE - 1][i];
+        uint64_t two = batch->pieces[TWO - 1][i];
+        uint64_t three = batch->pieces[THREE - 1][i];
+        uint64_t occupied = one | two | three;
+        uint64_t empty = ~occupied & BOARD_MASK;
+
+        //lignes actives : la plus au sud pour SOUTH_P, la plus au nord pour NORTH_P
+        uint64_t south_line = 0;
+        uint64_t north_line = 0;
+        if (occupied != 0)
+        {
+            south_line = LINE_MASK(__builtin_ctzll(occupied) / DIMENSION);
+            north_line = LINE_MASK((63 - __builtin_clzll(occupied)) / DIMENSION);
+        }
+
+        int terms[NB_EVAL_TERMS];
+        terms[TERM_SIDE] = __builtin_popcountll(occupied & ~m.south_half) - __builtin_popcountll(occupied & m.south_half);
+        terms[TERM_THREAT] = __builtin_popcountll((one & m.threats[SOUTH_P][ONE]) | (two & m.threats[SOUTH_P][TWO]) | (three & m.threats[SOUTH_P][THREE]))
+            - __builtin_popcountll((one & m.threats[NORTH_P][ONE]) | (two & m.threats[NORTH_P][TWO]) | (three & m.threats[NORTH_P][THREE]));
+        terms[TERM_ONE] = __builtin_popcountll(one & south_line) - __builtin_popcountll(one & north_line);
+        terms[TERM_TWO] = __builtin_popcountll(two & south_line) - __builtin_popcountll(two & north_line);
+        terms[TERM_THREE] = __builtin_popcountll(three & south_line) - __builtin_popcountll(three & north_line);
+        terms[TERM_MOBILITY] = free_neighbours(&m, occupied & south_line, empty) - free_neighbours(&m, occupied & north_line, empty);
+
+        int score = 0;
+        for (int t = 0; t < NB_EVAL_TERMS; t++) {
+            if (t != TERM_TEMPO)
+            {
+                score += eval_weights[t] * terms[t];
+            }
+        }
+        scores[i] = (batch->to_move[i] ? -score : score) + eval_weights[TERM_TEMPO];
+    }
+}
+
+#ifdef HAVE_AVX2_KERNEL
+
+// Nombre de bits de chaque mot de 64 bits (comptage par quartets avec une table, puis somme des octets)
+__attribute__((target("avx2")))
+static inline __m256i popcount_avx2(__m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low);
+    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+static inline __m256i free_neighbours_avx2(__m256i pieces, __m256i empty, __m256i not_last, __m256i not_first) {
+    __m256i north = _mm256_and_si256(pieces, _mm256_srli_epi64(empty, DIMENSION));
+    __m256i south = _mm256_and_si256(pieces, _mm256_slli_epi64(empty, DIMENSION));
+    __m256i east = _mm256_and_si256(_mm256_and_si256(pieces, _mm256_srli_epi64(empty, 1)), not_last);
+    __m256i west = _mm256_and_si256(_mm256_and_si256(pieces, _mm256_slli_epi64(empty, 1)), not_first);
+    return _mm256_add_epi64(_mm256_add_epi64(popcount_avx2(north), popcount_avx2(south)),
+                            _mm256_add_epi64(popcount_avx2(east), popcount_avx2(west)));
+}
+
+// Différence de comptage entre deux masques, multipliée par un poids
+__attribute__((target("avx2")))
+static inline __m256i weighted_diff(__m256i a, __m256i b, int weight) {
+    __m256i diff = _mm256_sub_epi64(popcount_avx2(a), popcount_avx2(b));
+    return _mm256_mul_epi32(diff, _mm256_set1_epi64x(weight));
+}
+
+// Quatre positions par itération, un mot de 64 bits par position
+__attribute__((target("avx2")))
+static void evaluate_avx2(const eval_batch *batch, int *scores) {
+    batch_masks m;
+    init_masks(&m);
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i board_mask = _mm256_set1_epi64x(BOARD_MASK);
+    const __m256i not_last = _mm256_set1_epi64x(m.not_last);
+    const __m256i not_first = _mm256_set1_epi64x(m.not_first);
+    const __m256i south_half = _mm256_set1_epi64x(m.south_half);
+    const __m256i north_half = _mm256_set1_epi64x(~m.south_half);
+    const __m256i tempo = _mm256_set1_epi64x(eval_weights[TERM_TEMPO]);
+    __m256i threats[NB_PLAYERS + 1][NB_SIZE + 1];
+    __m256i lines[DIMENSION];
+    for (int s = ONE; s <= THREE; s++) {
+        threats[SOUTH_P][s] = _mm256_set1_epi64x(m.threats[SOUTH_P][s]);
+        threats[NORTH_P][s] = _mm256_set1_epi64x(m.threats[NORTH_P][s]);
+    }
+    for (int l = 0; l < DIMENSION; l++) {
+        lines[l] = _mm256_set1_epi64x(LINE_MASK(l));
+    }
+
+    for (int i = 0; i < batch->nb; i += 4) {
+        __m256i one = _mm256_loadu_si256((const __m256i *)&batch->pieces[ONE - 1][i]);
+        __m256i two = _mm256_loadu_si256((const __m256i *)&batch->pieces[TWO - 1][i]);
+        __m256i three = _mm256_loadu_si256((const __m256i *)&batch->pieces[THREE - 1][i]);
+        __m256i to_move = _mm256_loadu_si256((const __m256i *)&batch->to_move[i]);
+        __m256i occupied = _mm256_or_si256(_mm256_or_si256(one, two), three);
+        __m256i empty = _mm256_andnot_si256(occupied, board_mask);
+
+        //lignes actives : la dernière ligne occupée rencontrée gagne
+        __m256i south_line = zero;
+        __m256i north_line = zero;
+        for (int l = 0; l < DIMENSION; l++) {
+            __m256i north_candidate = lines[l];
+            __m256i south_candidate = lines[DIMENSION - 1 - l];
+            __m256i north_empty = _mm256_cmpeq_epi64(_mm256_and_si256(occupied, north_candidate), zero);
+            __m256i south_empty = _mm256_cmpeq_epi64(_mm256_and_si256(occupied, south_candidate), zero);
+            north_line = _mm256_blendv_epi8(north_candidate, north_line, north_empty);
+            south_line = _mm256_blendv_epi8(south_candidate, south_line, south_empty);
+        }
+
+        __m256i south_threats = _mm256_or_si256(_mm256_or_si256(
+            _mm256_and_si256(one, threats[SOUTH_P][ONE]),
+            _mm256_and_si256(two, threats[SOUTH_P][TWO])),
+            _mm256_and_si256(three, threats[SOUTH_P][THREE]));
+        __m256i north_threats = _mm256_or_si256(_mm256_or_si256(
+            _mm256_and_si256(one, threats[NORTH_P][ONE]),
+            _mm256_and_si256(two, threats[NORTH_P][TWO])),
+            _mm256_and_si256(three, threats[NORTH_P][THREE]));
+
+        __m256i score = weighted_diff(_mm256_and_si256(occupied, north_half), _mm256_and_si256(occupied, south_half), eval_weights[TERM_SIDE]);
+        score = _mm256_add_epi64(score, weighted_diff(south_threats, north_threats, eval_weights[TERM_THREAT]));
+        score = _mm256_add_epi64(score, weighted_diff(_mm256_and_si256(one, south_line), _mm256_and_si256(one, north_line), eval_weights[TERM_ONE]));
+        score = _mm256_add_epi64(score, weighted_diff(_mm256_and_si256(two, south_line), _mm256_and_si256(two, north_line), eval_weights[TERM_TWO]));
+        score = _mm256_add_epi64(score, weighted_diff(_mm256_and_si256(three, south_line), _mm256_and_si256(three, north_line), eval_weights[TERM_THREE]));
+        __m256i mobility = _mm256_sub_epi64(free_neighbours_avx2(_mm256_and_si256(occupied, south_line), empty, not_last, not_first),
+                                            free_neighbours_avx2(_mm256_and_si256(occupied, north_line), empty, not_last, not_first));
+        score = _mm256_add_epi64(score, _mm256_mul_epi32(mobility, _mm256_set1_epi64x(eval_weights[TERM_MOBILITY])));
+
+        //changement de signe pour NORTH_P : (x ^ m) - m avec m = 0 ou ~0
+        score = _mm256_sub_epi64(_mm256_xor_si256(score, to_move), to_move);
+        score = _mm256_add_epi64(score, tempo);
+
+        long long out[4];
+        _mm256_storeu_si256((__m256i *)out, score);
+        for (int k = 0; k < 4 && i + k < batch->nb; k++) {
+            scores[i + k] = (int)out[k];
+        }
+    }
+}
+
+#endif
+
+// Noyau choisi au premier appel
+static void (*kernel)(const eval_batch *, int *) = NULL;
+
+static void select_kernel(void) {
+    kernel = evaluate_scalar;
+#ifdef HAVE_AVX2_KERNEL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        kernel = evaluate_avx2;
+    }
+#endif
+}
+
+void evaluate_batch(const eval_batch *batch, int *scores) {
+    if (kernel == NULL)
+    {
+        select_kernel();
+    }
+    kernel(batch, scores);
+}
+
+const char *eval_batch_kernel(void) {
+    if (kernel == NULL)
+    {
+        select_kernel();
+    }
+    return kernel == evaluate_scalar ? "scalar" : "avx2";
+}
@@ -0,0 +1,62 @@
+#ifndef _EVAL_BATCH_H_
+#define _EVAL_BATCH_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file eval_batch.h
+ *
+ * \brief Évaluation de nombreuses positions d'un coup.
+ *
+ * Les positions sont rangées en structure de tableaux : pour chaque taille,
+ * le masque des cases occupées par les pièces de cette taille, et le joueur qui a le trait.
+ * Tous les termes de ::eval_terms se calculent sur ces masques par des ET et des comptages de bits,
+ * ce qui permet de traiter quatre positions par instruction avec AVX2.
+ *
+ * Le noyau AVX2 est choisi à l'exécution si le processeur le permet (CPUID),
+ * sinon un noyau scalaire équivalent est utilisé. Les deux donnent exactement
+ * les scores de ::evaluate.
+ */
+
+/**
+ * @brief nombre maximal de positions d'un lot.
+ */
+#define EVAL_BATCH_SIZE 64
+
+/**
+ * @brief Un lot de positions, en structure de tableaux.
+ */
+typedef struct {
+	uint64_t pieces[NB_SIZE][EVAL_BATCH_SIZE]; /**< pieces[s - 1][i] : cases des pièces de taille s dans la position i */
+	uint64_t to_move[EVAL_BATCH_SIZE]; /**< ~0 si le joueur qui a le trait est ::NORTH_P, 0 pour ::SOUTH_P */
+	int nb; /**< nombre de positions du lot */
+} eval_batch;
+
+/**
+ * @brief Vide un lot.
+ */
+void eval_batch_clear(eval_batch *batch);
+
+/**
+ * @brief Ajoute une position au lot.
+ * @param batch le lot.
+ * @param game le plateau, sans gagnant ; la pièce en main est ignorée.
+ * @param p le joueur du point de vue duquel la position est évaluée.
+ * @return l'indice de la position dans le lot, -1 si le lot est plein.
+ */
+int eval_batch_add(eval_batch *batch, board game, player p);
+
+/**
+ * @brief Évalue toutes les positions du lot.
+ * @param batch le lot.
+ * @param scores reçoit le score de chaque position, comme ::evaluate.
+ */
+void evaluate_batch(const eval_batch *batch, int *scores);
+
+/**
+ * @brief Nom du noyau choisi à l'exécution ("avx2" ou "scalar").
+ */
+const char *eval_batch_kernel(void);
+
+#endif /*_EVAL_BATCH_H_*/
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "board.h"
+#include "board_tables.h"
+
+// Générateur hors ligne de walks_table.c (voir walks.h)
+// Compilation : gcc gen_walks.c board_tables.c -o gen_walks && ./gen_walks > walks_table.c
+
+typedef struct {
+    uint64_t inter;
+    uint64_t edges;
+    int squares[NB_SIZE];
+    int dirs[NB_SIZE];
+} gen_walk;
+
+// au plus 4 * 3 * 3 chemins de 3 pas depuis une case
+static gen_walk walks[NB_SQUARES * 36 * NB_SIZE];
+static int nb_walks = 0;
+
+// Prolonge le chemin en cours d'un pas dans chaque direction, sans repasser par un segment
+static void extend(int k, gen_walk current, int square, int depth) {
+    for (int d = SOUTH; d <= WEST; d++) {
+        int next = neighbour_table[square][d];
+        int edge = edge_table[square][d];
+        if (next == NO_SQUARE || ((current.edges >> edge) & 1))
+        {
+            continue;
+        }
+
+        gen_walk w = current;
+        w.edges |= (uint64_t)1 << edge;
+        w.squares[depth] = next;
+        w.dirs[depth] = d;
+
+        if (depth + 1 == k)
+        {
+            walks[nb_walks++] = w;
+        }
+        else
+        {
+            w.inter |= (uint64_t)1 << next;
+            extend(k, w, next, depth + 1);
+        }
+    }
+}
+
+int main(void) {
+    int first[NB_SQUARES][NB_SIZE + 2];
+
+    for (int sq = 0; sq < NB_SQUARES; sq++) {
+        for (int k = ONE; k <= THREE; k++) {
+            gen_walk empty = { 0, 0, { NO_SQUARE, NO_SQUARE, NO_SQUARE }, { GOAL, GOAL, GOAL } };
+            first[sq][k] = nb_walks;
+            extend(k, empty, sq, 0);
+        }
+        first[sq][THREE + 1] = nb_walks;
+        first[sq][0] = first[sq][ONE];
+    }
+
+    printf("// Fichier généré par gen_walks.c, ne pas modifier à la main.\n");
+    printf("#include \"walks.h\"\n\n");
+    printf("#if DIMENSION != %d\n", DIMENSION);
+    printf("#error \"table générée pour DIMENSION %d : relancer gen_walks\"\n", DIMENSION);
+    printf("#endif\n\n");
+
+    printf("const walk walk_table[%d] = {\n", nb_walks);
+    for (int i = 0; i < nb_walks; i++) {
+        gen_walk *w = &walks[i];
+        printf("    { 0x%llxULL, 0x%llxULL, { %d, %d, %d }, { %d, %d, %d } },\n",
+               (unsigned long long)w->inter, (unsigned long long)w->edges,
+               w->squares[0], w->squares[1], w->squares[2], w->dirs[0], w->dirs[1], w->dirs[2]);
+    }
+    printf("};\n\n");
+
+    printf("const unsigned short walk_first[NB_SQUARES][NB_SIZE + 2] = {\n");
+    for (int sq = 0; sq < NB_SQUARES; sq++) {
+        printf("    {");
+        for (int k = 0; k <= THREE + 1; k++) {
+            printf(" %d%s", first[sq][k], k <= THREE ? "," : "");
+        }
+        printf(" },\n");
+    }
+    printf("};\n");
+
+    return 0;
+}
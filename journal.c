@@ -0,0 +1,299 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "board_s.h"
+#include "journal.h"
+
+
+// Signature et version du format
+#define JOURNAL_MAGIC 0x314e524a4742ULL   // "BGJRN1"
+#define JOURNAL_VERSION 1
+
+// Mot de validation d'une case : utilisée, instantané courant, nombre d'enregistrements valides
+#define COMMIT_USED 0x80000000u
+#define COMMIT_SNAPSHOT 0x40000000u
+#define COMMIT_COUNT 0x0000ffffu
+
+// Opérations enregistrées
+enum {
+    OP_PLACE,            // taille, joueur, colonne
+    OP_PICK,             // joueur, ligne, colonne
+    OP_MOVE,             // direction
+    OP_SWAP,             // ligne, colonne
+    OP_CANCEL_STEP,
+    OP_CANCEL_MOVEMENT
+};
+
+// En-tête du fichier : ce qu'il faut pour refuser un fichier d'un autre exécutable
+typedef struct {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t dimension;
+    uint32_t board_bytes;
+    uint32_t ring;
+    uint32_t nb_slots;
+    uint32_t slot_bytes;
+} journal_header;
+
+// Un enregistrement : une opération et ses paramètres
+typedef struct {
+    unsigned char op;
+    signed char a;
+    signed char b;
+    signed char c;
+} journal_record;
+
+// Une case du fichier ; les instantanés suivent, de slot_bytes au total
+typedef struct {
+    uint32_t commit;
+    uint32_t pad;
+    journal_record records[JOURNAL_RING];
+    unsigned char snapshots[];    // deux copies du plateau, l'une courante, l'autre pour le prochain instantané
+} journal_slot;
+
+struct journal_s {
+    int fd;
+    unsigned char *map;
+    size_t map_bytes;
+    int nb_slots;
+    size_t slot_bytes;
+};
+
+// Copie du plateau arrondie à 8 octets
+static size_t snapshot_bytes(void) {
+    return (sizeof(struct board_s) + 7) & ~(size_t)7;
+}
+
+static size_t header_bytes(void) {
+    return (sizeof(journal_header) + 63) & ~(size_t)63;
+}
+
+static journal_slot *get_slot(journal j, int slot) {
+    return (journal_slot *)(j->map + header_bytes() + (size_t)slot * j->slot_bytes);
+}
+
+journal journal_open(const char *path, int nb_slots) {
+    if (nb_slots <= 0)
+    {
+        return NULL;
+    }
+    journal j = calloc(1, sizeof(struct journal_s));
+    if (j == NULL)
+    {
+        return NULL;
+    }
+    j->nb_slots = nb_slots;
+    j->slot_bytes = (sizeof(journal_slot) + 2 * snapshot_bytes() + 63) & ~(size_t)63;
+    j->map_bytes = header_bytes() + (size_t)nb_slots * j->slot_bytes;
+
+    j->fd = open(path, O_RDWR | O_CREAT, 0644);
+    struct stat st;
+    if (j->fd < 0 || fstat(j->fd, &st) < 0)
+    {
+        free(j);
+        return NULL;
+    }
+    bool created = st.st_size == 0;
+    if ((created && ftruncate(j->fd, j->map_bytes) < 0) || (!created && (size_t)st.st_size != j->map_bytes))
+    {
+        close(j->fd);
+        free(j);
+        return NULL;
+    }
+
+    j->map = mmap(NULL, j->map_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, j->fd, 0);
+    if (j->map == MAP_FAILED)
+    {
+        close(j->fd);
+        free(j);
+        return NULL;
+    }
+
+    journal_header expected = {
+        .magic = JOURNAL_MAGIC,
+        .version = JOURNAL_VERSION,
+        .dimension = DIMENSION,
+        .board_bytes = sizeof(struct board_s),
+        .ring = JOURNAL_RING,
+        .nb_slots = nb_slots,
+        .slot_bytes = j->slot_bytes,
+    };
+    if (created)
+    {
+        //le fichier neuf est rempli de zéros : toutes les cases sont vides
+        memcpy(j->map, &expected, sizeof(expected));
+    }
+    else if (memcmp(j->map, &expected, sizeof(expected)) != 0)
+    {
+        journal_close(j);
+        return NULL;
+    }
+    return j;
+}
+
+void journal_close(journal j) {
+    if (j == NULL)
+    {
+        return;
+    }
+    munmap(j->map, j->map_bytes);
+    close(j->fd);
+    free(j);
+}
+
+bool journal_sync(journal j) {
+    return msync(j->map, j->map_bytes, MS_SYNC) == 0;
+}
+
+bool journal_slot_used(journal j, int slot) {
+    return (__atomic_load_n(&get_slot(j, slot)->commit, __ATOMIC_ACQUIRE) & COMMIT_USED) != 0;
+}
+
+void journal_snapshot(journal j, int slot, board game) {
+    if (j == NULL)
+    {
+        return;
+    }
+    journal_slot *s = get_slot(j, slot);
+    uint32_t commit = s->commit;
+    //le nouvel instantané va dans la copie qui n'est pas courante, puis un seul mot le rend courant
+    uint32_t next = (commit & COMMIT_USED) && !(commit & COMMIT_SNAPSHOT) ? COMMIT_SNAPSHOT : 0;
+    memcpy(s->snapshots + (next ? snapshot_bytes() : 0), game, sizeof(struct board_s));
+    __atomic_store_n(&s->commit, COMMIT_USED | next, __ATOMIC_RELEASE);
+}
+
+void journal_attach(journal j, int slot, board game) {
+    if (j == NULL)
+    {
+        return;
+    }
+    journal_slot *s = get_slot(j, slot);
+    __atomic_store_n(&s->commit, 0, __ATOMIC_RELEASE);
+    journal_snapshot(j, slot, game);
+}
+
+void journal_detach(journal j, int slot) {
+    if (j == NULL)
+    {
+        return;
+    }
+    __atomic_store_n(&get_slot(j, slot)->commit, 0, __ATOMIC_RELEASE);
+}
+
+static void record(journal j, int slot, board game, unsigned char op, int a, int b, int c) {
+    if (j == NULL)
+    {
+        return;
+    }
+    journal_slot *s = get_slot(j, slot);
+    uint32_t commit = s->commit;
+    uint32_t count = commit & COMMIT_COUNT;
+    if (count == JOURNAL_RING)
+    {
+        //anneau plein : l'instantané remplace les enregistrements
+        journal_snapshot(j, slot, game);
+        return;
+    }
+    s->records[count] = (journal_record){op, (signed char)a, (signed char)b, (signed char)c};
+    __atomic_store_n(&s->commit, commit + 1, __ATOMIC_RELEASE);
+}
+
+board journal_recover(journal j, int slot) {
+    journal_slot *s = get_slot(j, slot);
+    uint32_t commit = __atomic_load_n(&s->commit, __ATOMIC_ACQUIRE);
+    if (!(commit & COMMIT_USED))
+    {
+        return NULL;
+    }
+
+    board game = new_game();
+    if (game == NULL)
+    {
+        return NULL;
+    }
+    memcpy(game, s->snapshots + ((commit & COMMIT_SNAPSHOT) ? snapshot_bytes() : 0), sizeof(struct board_s));
+    uint32_t count = commit & COMMIT_COUNT;
+    for (uint32_t i = 0; i < count; i++) {
+        journal_record r = s->records[i];
+        switch (r.op)
+        {
+            case OP_PLACE:
+                place_piece(game, (size)r.a, (player)r.b, r.c);
+                break;
+            case OP_PICK:
+                pick_piece(game, (player)r.a, r.b, r.c);
+                break;
+            case OP_MOVE:
+                move_piece(game, (direction)r.a);
+                break;
+            case OP_SWAP:
+                swap_piece(game, r.a, r.b);
+                break;
+            case OP_CANCEL_STEP:
+                cancel_step(game);
+                break;
+            case OP_CANCEL_MOVEMENT:
+                cancel_movement(game);
+                break;
+        }
+    }
+    return game;
+}
+
+return_code journal_place_piece(journal j, int slot, board game, size piece, player p, int column) {
+    return_code rc = place_piece(game, piece, p, column);
+    if (rc == OK)
+    {
+        record(j, slot, game, OP_PLACE, piece, p, column);
+    }
+    return rc;
+}
+
+return_code journal_pick_piece(journal j, int slot, board game, player p, int line, int column) {
+    return_code rc = pick_piece(game, p, line, column);
+    if (rc == OK)
+    {
+        record(j, slot, game, OP_PICK, p, line, column);
+    }
+    return rc;
+}
+
+return_code journal_move_piece(journal j, int slot, board game, direction d) {
+    return_code rc = move_piece(game, d);
+    if (rc == OK)
+    {
+        record(j, slot, game, OP_MOVE, d, 0, 0);
+    }
+    return rc;
+}
+
+return_code journal_swap_piece(journal j, int slot, board game, int target_line, int target_column) {
+    return_code rc = swap_piece(game, target_line, target_column);
+    if (rc == OK)
+    {
+        record(j, slot, game, OP_SWAP, target_line, target_column, 0);
+    }
+    return rc;
+}
+
+return_code journal_cancel_step(journal j, int slot, board game) {
+    return_code rc = cancel_step(game);
+    if (rc == OK)
+    {
+        record(j, slot, game, OP_CANCEL_STEP, 0, 0, 0);
+    }
+    return rc;
+}
+
+return_code journal_cancel_movement(journal j, int slot, board game) {
+    return_code rc = cancel_movement(game);
+    if (rc == OK)
+    {
+        record(j, slot, game, OP_CANCEL_MOVEMENT, 0, 0, 0);
+    }
+    return rc;
+}
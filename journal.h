@@ -0,0 +1,104 @@
+#ifndef _JOURNAL_H_
+#define _JOURNAL_H_
+
+#include <stdbool.h>
+#include "board.h"
+
+/**
+ * \file journal.h
+ *
+ * \brief Journal des parties dans un fichier projeté en mémoire, pour reprendre après un arrêt brutal.
+ *
+ * Le fichier a une case par partie. Une case contient une copie complète du plateau
+ * (l'instantané) et un anneau de ::JOURNAL_RING enregistrements de 4 octets : un par appel
+ * réussi de place_piece, pick_piece, move_piece, swap_piece, cancel_step ou cancel_movement.
+ * Quand l'anneau est plein, un nouvel instantané le remplace.
+ *
+ * Le fichier est projeté avec mmap (MAP_SHARED) : un enregistrement n'est qu'une écriture
+ * en mémoire, sans appel système. Si le processus meurt, le noyau garde les pages écrites
+ * et la reprise (::journal_recover) relit l'instantané puis rejoue l'anneau. Contre une coupure
+ * de courant, ::journal_sync force l'écriture sur disque, au rythme choisi par l'appelant.
+ *
+ * Les fonctions qui écrivent acceptent un journal NULL : elles ne font alors que l'appel de board.h,
+ * ce qui rend le journal facultatif pour l'appelant.
+ *
+ * Chaque case n'est écrite que par le code qui joue sa partie : des parties différentes
+ * peuvent être jouées en même temps par des threads différents, sans verrou du journal.
+ * Une case est validée par un seul mot de 32 bits, écrit en dernier :
+ * une écriture interrompue n'est jamais relue.
+ *
+ * L'instantané est une copie de la structure du plateau (board_s.h) : le journal suppose
+ * l'implémentation board.c, et un fichier écrit par un autre exécutable (autre ::DIMENSION,
+ * autre structure) est refusé.
+ */
+
+/**
+ * @brief enregistrements entre deux instantanés d'une partie.
+ */
+#define JOURNAL_RING 64
+
+/**
+ * @brief Un journal ouvert.
+ */
+typedef struct journal_s *journal;
+
+/**
+ * @brief Ouvre un journal, ou le crée s'il n'existe pas.
+ * @param path le fichier.
+ * @param nb_slots nombre de parties du fichier ; un fichier existant doit en avoir autant.
+ * @return le journal, NULL si le fichier ne peut pas être ouvert ou ne correspond pas à cet exécutable.
+ */
+journal journal_open(const char *path, int nb_slots);
+
+/**
+ * @brief Ferme le journal ; son contenu reste dans le fichier.
+ */
+void journal_close(journal j);
+
+/**
+ * @brief Force l'écriture du journal sur disque (msync).
+ * @return false en cas d'erreur.
+ */
+bool journal_sync(journal j);
+
+/**
+ * @brief Indique si une case du journal contient une partie.
+ */
+bool journal_slot_used(journal j, int slot);
+
+/**
+ * @brief Reconstruit la partie d'une case : son dernier instantané, puis les enregistrements qui le suivent.
+ * @param j le journal.
+ * @param slot la case.
+ * @return un nouveau plateau (à détruire avec destroy_game), NULL si la case est vide ou si la mémoire manque.
+ */
+board journal_recover(journal j, int slot);
+
+/**
+ * @brief Commence le journal d'une partie dans une case : un premier instantané y est écrit.
+ */
+void journal_attach(journal j, int slot, board game);
+
+/**
+ * @brief Vide une case : sa partie ne sera plus reprise.
+ */
+void journal_detach(journal j, int slot);
+
+/**
+ * @brief Écrit un instantané de la partie, par exemple après des changements faits sans les fonctions ci-dessous.
+ */
+void journal_snapshot(journal j, int slot, board game);
+
+/**@{
+ * \name Fonctions de board.h qui enregistrent leur appel s'il réussit.
+ * Elles prennent en plus le journal et la case de la partie.
+ */
+return_code journal_place_piece(journal j, int slot, board game, size piece, player p, int column);
+return_code journal_pick_piece(journal j, int slot, board game, player p, int line, int column);
+return_code journal_move_piece(journal j, int slot, board game, direction d);
+return_code journal_swap_piece(journal j, int slot, board game, int target_line, int target_column);
+return_code journal_cancel_step(journal j, int slot, board game);
+return_code journal_cancel_movement(journal j, int slot, board game);
+/**@}*/
+
+#endif /*_JOURNAL_H_*/
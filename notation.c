@@ -0,0 +1,348 @@
+#include <stdlib.h>
+#include <string.h>
+#include "board_s.h"
+#include "notation.h"
+
+
+// État du mouvement lu, appliqué au plateau seulement si tout le texte est valide
+typedef struct {
+    size grid[DIMENSION][DIMENSION];
+    int available[NB_PLAYERS + 1][NB_SIZE + 1];
+    player to_move;
+    player winner;
+    size picked;
+    int line;
+    int column;
+    int moves;
+    int start_line;
+    int start_column;
+    uint64_t used_edges;
+} parsed_position;
+
+static const char player_chars[NB_PLAYERS + 1] = {'-', 'S', 'N'};
+
+static bool read_player(char c, player *p) {
+    for (int i = 0; i <= NB_PLAYERS; i++) {
+        if (player_chars[i] == c)
+        {
+            *p = (player)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Lit un chiffre entre 0 et max
+static bool read_digit(const char **s, int max, int *value) {
+    if (**s < '0' || **s > '0' + max)
+    {
+        return false;
+    }
+    *value = **s - '0';
+    (*s)++;
+    return true;
+}
+
+static bool read_square(const char **s, int *line, int *column) {
+    return read_digit(s, DIMENSION - 1, line) && read_digit(s, DIMENSION - 1, column);
+}
+
+static bool read_hex(const char **s, uint64_t *value) {
+    int nb_digits = 0;
+    *value = 0;
+    while (nb_digits < 16) {
+        char c = **s;
+        int digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else
+        {
+            break;
+        }
+        *value = (*value << 4) | digit;
+        nb_digits++;
+        (*s)++;
+    }
+    return nb_digits > 0;
+}
+
+static bool is_field_end(char c) {
+    return c == '\0' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Lit le champ du mouvement : "-", "#S", "#N" ou la pièce en main
+static bool read_movement(const char **s, parsed_position *pos) {
+    const char *p = *s;
+    int value;
+
+    if (*p == '-')
+    {
+        *s = p + 1;
+        return true;
+    }
+    if (*p == '#')
+    {
+        p++;
+        if (!read_player(*p, &pos->winner) || pos->winner == NO_PLAYER)
+        {
+            return false;
+        }
+        *s = p + 1;
+        return true;
+    }
+
+    if (pos->to_move == NO_PLAYER || !read_digit(&p, THREE, &value) || value < ONE || *p++ != '@')
+    {
+        return false;
+    }
+    pos->picked = (size)value;
+    if (!read_square(&p, &pos->line, &pos->column) || *p++ != ':'
+        || !read_digit(&p, THREE, &pos->moves) || *p++ != ':'
+        || !read_square(&p, &pos->start_line, &pos->start_column) || *p++ != ':'
+        || !read_hex(&p, &pos->used_edges))
+    {
+        return false;
+    }
+    *s = p;
+    return true;
+}
+
+// Vérifie que la position lue peut être mise sur un plateau : autant de pièces de chaque taille
+// dans la grille (et en main) que de pièces posées, sauf celle qui a atteint le but, et un mouvement possible pour la pièce en main
+static bool is_consistent(const parsed_position *pos) {
+    int on_board[NB_SIZE + 1] = {0};
+    int nb_pieces = 0;
+
+    for (int line = 0; line < DIMENSION; line++) {
+        for (int column = 0; column < DIMENSION; column++) {
+            on_board[pos->grid[line][column]]++;
+        }
+    }
+    if (pos->picked != NONE)
+    {
+        on_board[pos->picked]++;
+    }
+    //la pièce qui a atteint le but a quitté le plateau
+    int nb_missing = 0;
+    for (int size = ONE; size <= THREE; size++) {
+        int placed = 2 * NB_INITIAL_PIECES - pos->available[SOUTH_P][size] - pos->available[NORTH_P][size];
+        if (on_board[size] > placed)
+        {
+            return false;
+        }
+        nb_missing += placed - on_board[size];
+        nb_pieces += on_board[size];
+    }
+    if (nb_missing > (pos->winner != NO_PLAYER ? 1 : 0) || nb_pieces > NB_PIECES)
+    {
+        return false;
+    }
+
+    if (pos->picked == NONE)
+    {
+        return true;
+    }
+    //après un rebond, les pas restants viennent de la pièce rencontrée (au plus sa taille moins un)
+    int max_moves = pos->picked > THREE - 1 ? pos->picked : THREE - 1;
+    if (pos->moves > max_moves)
+    {
+        return false;
+    }
+    if ((pos->used_edges >> NB_EDGES) != 0)
+    {
+        return false;
+    }
+    //la pièce s'arrête sur une pièce (rebond ou échange) exactement quand elle n'a plus de pas
+    if ((pos->grid[pos->line][pos->column] != NONE) != (pos->moves == 0))
+    {
+        return false;
+    }
+    //il faut au moins un segment par case d'écart avec la case de départ ; revenue à sa case
+    //de départ après avoir bougé, la pièce a fait un tour d'au moins quatre segments
+    int nb_edges = __builtin_popcountll(pos->used_edges);
+    int distance = abs(pos->line - pos->start_line) + abs(pos->column - pos->start_column);
+    if (nb_edges < distance || (distance == 0 && nb_edges > 0 && nb_edges < 4))
+    {
+        return false;
+    }
+    //la case de départ est restée vide : cancel_movement y reposera la pièce
+    return pos->grid[pos->start_line][pos->start_column] == NONE;
+}
+
+bool notation_read(board game, const char *text, player *to_move, const char **end) {
+    parsed_position pos = {.winner = NO_PLAYER, .picked = NONE};
+    const char *s = text;
+
+    //la grille, du nord au sud
+    for (int line = DIMENSION - 1; line >= 0; line--) {
+        for (int column = 0; column < DIMENSION; column++) {
+            char c = *s++;
+            if (c == '.')
+            {
+                pos.grid[line][column] = NONE;
+            }
+            else if (c >= '1' && c <= '3')
+            {
+                pos.grid[line][column] = (size)(c - '0');
+            }
+            else
+            {
+                return false;
+            }
+        }
+        if (*s++ != (line > 0 ? '/' : ' '))
+        {
+            return false;
+        }
+    }
+
+    if (!read_player(*s++, &pos.to_move) || *s++ != ' ')
+    {
+        return false;
+    }
+
+    for (int p = SOUTH_P; p <= NORTH_P; p++) {
+        for (int size = ONE; size <= THREE; size++) {
+            if (!read_digit(&s, NB_INITIAL_PIECES, &pos.available[p][size]))
+            {
+                return false;
+            }
+        }
+        if (p == SOUTH_P && *s++ != '/')
+        {
+            return false;
+        }
+    }
+
+    //le champ du mouvement est facultatif
+    if (*s == ' ' && !is_field_end(s[1]))
+    {
+        s++;
+        if (!read_movement(&s, &pos))
+        {
+            return false;
+        }
+    }
+    if (!is_field_end(*s) || !is_consistent(&pos))
+    {
+        return false;
+    }
+
+    clear_grid(game);
+    for (int line = 0; line < DIMENSION; line++) {
+        for (int column = 0; column < DIMENSION; column++) {
+            if (pos.grid[line][column] != NONE)
+            {
+                put_piece(game, line, column, pos.grid[line][column]);
+            }
+        }
+    }
+    for (int p = NO_PLAYER; p <= NB_PLAYERS; p++) {
+        for (int size = NONE; size <= NB_SIZE; size++) {
+            game->setup_counts[p][size] = p == NO_PLAYER || size == NONE ? 0 : NB_INITIAL_PIECES - pos.available[p][size];
+        }
+    }
+    game->winner = pos.winner;
+    game->picked_piece = pos.picked;
+    game->history_index = 0;
+    if (pos.picked != NONE)
+    {
+        game->current_player = pos.to_move;
+        game->p_line = pos.line;
+        game->p_col = pos.column;
+        game->moves_remaining = pos.moves;
+        game->start_line = pos.start_line;
+        game->start_col = pos.start_column;
+        game->used_edges = pos.used_edges;
+    }
+    else
+    {
+        game->current_player = NO_PLAYER;
+        game->p_line = -1;
+        game->p_col = -1;
+        game->moves_remaining = 0;
+        game->used_edges = 0;
+    }
+
+    if (to_move != NULL)
+    {
+        *to_move = pos.to_move;
+    }
+    if (end != NULL)
+    {
+        *end = s;
+    }
+    return true;
+}
+
+int notation_write(board game, player to_move, char *out, size_t max) {
+    char buffer[NOTATION_MAX];
+    char *s = buffer;
+
+    for (int line = DIMENSION - 1; line >= 0; line--) {
+        for (int column = 0; column < DIMENSION; column++) {
+            size piece = game->grid[line][column];
+            *s++ = piece == NONE ? '.' : (char)('0' + piece);
+        }
+        *s++ = line > 0 ? '/' : ' ';
+    }
+
+    *s++ = player_chars[to_move];
+    *s++ = ' ';
+
+    for (int p = SOUTH_P; p <= NORTH_P; p++) {
+        for (int size = ONE; size <= THREE; size++) {
+            *s++ = (char)('0' + NB_INITIAL_PIECES - game->setup_counts[p][size]);
+        }
+        if (p == SOUTH_P)
+        {
+            *s++ = '/';
+        }
+    }
+
+    *s++ = ' ';
+    if (game->winner != NO_PLAYER)
+    {
+        *s++ = '#';
+        *s++ = player_chars[game->winner];
+    }
+    else if (game->picked_piece != NONE)
+    {
+        *s++ = (char)('0' + game->picked_piece);
+        *s++ = '@';
+        *s++ = (char)('0' + game->p_line);
+        *s++ = (char)('0' + game->p_col);
+        *s++ = ':';
+        *s++ = (char)('0' + game->moves_remaining);
+        *s++ = ':';
+        *s++ = (char)('0' + game->start_line);
+        *s++ = (char)('0' + game->start_col);
+        *s++ = ':';
+        int shift = 60;
+        while (shift > 0 && (game->used_edges >> shift) == 0) {
+            shift -= 4;
+        }
+        for (; shift >= 0; shift -= 4) {
+            *s++ = "0123456789abcdef"[(game->used_edges >> shift) & 0xf];
+        }
+    }
+    else
+    {
+        *s++ = '-';
+    }
+
+    size_t length = s - buffer;
+    if (length + 1 > max)
+    {
+        return -1;
+    }
+    memcpy(out, buffer, length);
+    out[length] = '\0';
+    return (int)length;
+}
@@ -0,0 +1,65 @@
+#ifndef _NOTATION_H_
+#define _NOTATION_H_
+
+#include <stddef.h>
+#include "board.h"
+
+/**
+ * \file notation.h
+ *
+ * \brief Notation d'une position sur une ligne de texte, dans l'esprit de FEN.
+ *
+ * Quatre champs séparés par une espace, le dernier facultatif :
+ * \code
+ * 1.2.3./....../....../....../....../3.2.1. S 110/011 -
+ * \endcode
+ * - la grille : les lignes du nord (::DIMENSION - 1) au sud (0), séparées par '/',
+ *   chaque case valant '.' (vide), '1', '2' ou '3', de la colonne 0 à la dernière ;
+ * - le joueur qui a le trait : 'S', 'N', ou '-' s'il n'est pas connu ;
+ * - les pièces encore à placer (nb_pieces_available) : tailles 1, 2 et 3 du SUD, '/', puis du NORD ;
+ * - l'état du mouvement : '-' entre deux tours, "#S" ou "#N" si la partie est gagnée, ou la pièce
+ *   en main sous la forme taille\@lc:pas:lc:segments — sa taille, la case où elle est (ligne puis colonne,
+ *   un chiffre chacune), les pas qui lui restent (movement_left), sa case de départ, et les segments
+ *   déjà empruntés en hexadécimal. Le joueur qui la tient est celui qui a le trait.
+ *
+ * La lecture et l'écriture n'allouent rien : elles travaillent sur un plateau et un tampon
+ * fournis par l'appelant, ce qui permet de charger de gros corpus avec un seul plateau.
+ * Elles lisent et écrivent la structure du plateau (board_s.h) : l'implémentation board.c est supposée.
+ */
+
+/**
+ * @brief taille suffisante pour le texte d'une position, zéro final compris.
+ */
+#define NOTATION_MAX (DIMENSION * (DIMENSION + 1) + 48)
+
+/**
+ * @brief Écrit la notation d'une position.
+ * @param game le plateau.
+ * @param to_move le joueur qui a le trait, ::NO_PLAYER s'il n'est pas connu.
+ * @param out le tampon, terminé par un zéro.
+ * @param max la taille du tampon (::NOTATION_MAX suffit toujours).
+ * @return la longueur écrite sans le zéro final, -1 si le tampon est trop petit.
+ */
+int notation_write(board game, player to_move, char *out, size_t max);
+
+/**
+ * @brief Lit une notation et y met le plateau.
+ *
+ * Le texte est entièrement vérifié avant que le plateau soit modifié : en cas d'erreur,
+ * le plateau ne change pas. Outre la syntaxe, chaque taille doit compter autant de pièces
+ * dans la grille (pièce en main comprise) que de pièces posées d'après les pièces à placer
+ * (une de moins si la partie est gagnée),
+ * les pas restants doivent être possibles pour la pièce en main, les segments exister,
+ * la pièce ne doit s'arrêter sur une pièce que sans pas restants, avoir emprunté assez
+ * de segments pour s'être éloignée de sa case de départ, et cette case doit être vide. Après une pièce en main, cancel_movement ramène la pièce
+ * à sa case de départ ; l'historique des pas n'étant pas noté, cancel_step fait de même.
+ *
+ * @param game le plateau à remplacer.
+ * @param text le texte ; la lecture s'arrête à la fin de la notation (espace, fin de ligne ou zéro).
+ * @param to_move si non NULL, reçoit le joueur qui a le trait.
+ * @param end si non NULL, reçoit l'adresse du premier caractère après la notation.
+ * @return false si le texte n'est pas une notation valide.
+ */
+bool notation_read(board game, const char *text, player *to_move, const char **end);
+
+#endif /*_NOTATION_H_*/
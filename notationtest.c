@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "board_s.h"
+#include "notation.h"
+
+// Tests de la notation (voir notation.h) : aller-retour sur des parties au hasard, textes invalides
+// Compilation : gcc -O2 notationtest.c notation.c board.c eval.c board_tables.c -o notationtest
+// Usage : ./notationtest [actions]    renvoie 0 si tous les tests passent
+
+#define DEFAULT_ACTIONS 1000000
+
+// Textes que notation_read doit refuser sans toucher au plateau
+static const char *invalid[] = {
+    "",
+    "....../....../....../....../....../...... S 222/22",
+    "....../....../....../....../....../.....4 S 222/222",
+    "....../....../....../....../....../...... X 222/222",
+    "....../....../....../....../....../...... S 222/222 -x",
+    //pièce en main sans joueur qui a le trait
+    "....../....../....../....../....../...... - 221/222 1@00:1:00:0",
+    //plus de pièces que le jeu n'en a
+    "111111/111111/111111/....../....../...... S 222/222",
+    //pièces de la grille qui ne correspondent pas aux pièces posées
+    "1...../....../....../....../....../...... S 222/222",
+    "....../....../....../....../....../...... S 122/222",
+    "2...../....../....../....../....../...... S 122/222",
+    //pièce en main qui n'a pas été posée
+    "....../....../....../....../....../...... S 222/222 1@00:1:00:0",
+    //deux pièces manquent alors que la partie est gagnée
+    "....../....../....../....../....../...... S 022/222 #S",
+    //plus de pas que la pièce en main n'en permet
+    "....../....../....../....../....../...... S 122/222 1@00:3:00:0",
+    //segment inexistant
+    "....../....../....../....../....../...... S 122/222 1@00:1:00:1000000000000000",
+    //pièce en main sur une case vide sans pas restants : elle ne se poserait jamais
+    "....../....../....../....../....../...... S 122/222 1@01:0:00:0",
+    //pièce loin de sa case de départ sans segment emprunté
+    "....../....../....../....../....../...... S 122/222 1@33:1:00:0",
+    //pièce revenue à sa case de départ par deux segments seulement
+    "....../....../....../....../....../...... S 221/222 3@00:1:00:3",
+    //case de départ occupée
+    ".1..../....../....../....../....../...... S 022/222 1@00:1:51:0",
+};
+
+static bool same_board(board a, board b) {
+    return memcmp(a->grid, b->grid, sizeof(a->grid)) == 0
+        && memcmp(a->setup_counts, b->setup_counts, sizeof(a->setup_counts)) == 0
+        && a->winner == b->winner && a->picked_piece == b->picked_piece
+        && a->key == b->key && a->occupied == b->occupied && a->nb_pieces == b->nb_pieces
+        && memcmp(&a->features, &b->features, sizeof(a->features)) == 0;
+}
+
+// Joue des actions au hasard et vérifie que chaque position relue redonne le même plateau et le même texte
+static int round_trip(long nb_actions) {
+    board game = new_game();
+    board read = new_game();
+    char text[NOTATION_MAX];
+    char again[NOTATION_MAX];
+    int failures = 0;
+
+    srand(1);
+    for (long i = 0; i < nb_actions; i++) {
+        int action = rand() % 100;
+        if (action == 0)
+        {
+            destroy_game(game);
+            game = new_game();
+        }
+        else if (action < 15 && game->picked_piece == NONE)
+        {
+            place_piece(game, (size)(ONE + rand() % NB_SIZE), (player)(SOUTH_P + rand() % NB_PLAYERS), rand() % DIMENSION);
+        }
+        else if (action < 35 && game->picked_piece == NONE)
+        {
+            pick_piece(game, (player)(SOUTH_P + rand() % NB_PLAYERS), rand() % DIMENSION, rand() % DIMENSION);
+        }
+        else if (action < 80)
+        {
+            move_piece(game, (direction)(rand() % 5));
+        }
+        else if (action < 88)
+        {
+            swap_piece(game, rand() % DIMENSION, rand() % DIMENSION);
+        }
+        else
+        {
+            cancel_movement(game);
+        }
+
+        player to_move = game->picked_piece != NONE ? game->current_player : (player)(rand() % (NB_PLAYERS + 1));
+        player back;
+        const char *end;
+        int length = notation_write(game, to_move, text, sizeof(text));
+        if (length < 0 || !notation_read(read, text, &back, &end) || back != to_move || end != text + length
+            || !same_board(game, read) || notation_write(read, to_move, again, sizeof(again)) != length
+            || strcmp(text, again) != 0)
+        {
+            if (failures < 5)
+            {
+                fprintf(stderr, "aller-retour : %s\n", text);
+            }
+            failures++;
+        }
+    }
+    destroy_game(game);
+    destroy_game(read);
+    return failures;
+}
+
+static int invalid_texts(void) {
+    board game = new_game();
+    char before[NOTATION_MAX];
+    char after[NOTATION_MAX];
+    int failures = 0;
+
+    place_piece(game, TWO, SOUTH_P, 3);
+    notation_write(game, NORTH_P, before, sizeof(before));
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        bool accepted = notation_read(game, invalid[i], NULL, NULL);
+        notation_write(game, NORTH_P, after, sizeof(after));
+        if (accepted || strcmp(before, after) != 0)
+        {
+            fprintf(stderr, "texte invalide %s : \"%s\"\n", accepted ? "accepté" : "a modifié le plateau", invalid[i]);
+            failures++;
+        }
+    }
+    destroy_game(game);
+    return failures;
+}
+
+int main(int argc, char *argv[]) {
+    long nb_actions = argc > 1 ? atol(argv[1]) : DEFAULT_ACTIONS;
+
+    int failures = invalid_texts() + round_trip(nb_actions);
+    printf("%d échec(s)\n", failures);
+    return failures == 0 ? 0 : 1;
+}
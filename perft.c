@@ -0,0 +1,616 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include "board.h"
+#include "board_backend.h"
+#include "scheduler.h"
+
+// Perft : nombre de suites de tours complets de profondeur donnée, pour vérifier les implémentations de board.h
+// Seul board.h est utilisé : le même fichier se compile avec chacune des implémentations.
+// Compilation :
+//   gcc -O2 -pthread perft.c scheduler.c board.c eval.c board_tables.c -o perft
+//   gcc -O2 -pthread perft.c scheduler.c board_V.c -o perft_V        (de même avec board_W.c et board_Wendy.c)
+//   gcc -O2 -pthread -DBOARD_BACKEND_DYNAMIC perft.c scheduler.c board_backend*.c eval.c board_tables.c -o perft_all
+// Usage : ./perft [-d profondeur] [-t threads] [-m Mo] [-s placement] [-j S|N] [-b implémentation|all]
+// (-b seulement avec BOARD_BACKEND_DYNAMIC : all compte avec chaque implémentation et compare les nombres)
+//
+// Le placement donne la ligne du SUD puis celle du NORD, de la colonne 0 à la dernière :
+// un chiffre par case ('.' pour une case vide), par exemple 123123/321321 (le placement par défaut).
+// Tant que le joueur qui a le trait a des pièces à placer, un tour est un appel de place_piece ;
+// les deux joueurs placent donc à tour de rôle depuis ....../....... Ensuite, un tour est une pièce prise,
+// ses pas et éventuellement un échange, comptés comme generate_turns (turn.h) : un tour par arrivée
+// sur une case vide, un par couple (pièce rencontrée, case de l'échange) et un pour le but.
+//
+// Les sous-arbres sont répartis entre les threads par le scheduler (scheduler.h) : à partir de
+// SPLIT_DEPTH tours restants, chaque position qui suit un tour devient une tâche, qu'un thread libre peut voler.
+// Les nombres des sous-arbres sont gardés dans une table partagée, indexée par la clé de la position
+// (calculée avec board.h) et la profondeur restante.
+
+// Profondeur maximale, taille par défaut de la table en Mo
+#define MAX_DEPTH 32
+#define DEFAULT_TABLE_MB 256
+
+// Tours restants à partir desquels les sous-arbres deviennent des tâches
+#define SPLIT_DEPTH 3
+
+// Une entrée de la table ; check vaut clé ^ count, ce qui écarte une entrée lue pendant qu'un autre thread l'écrit
+typedef struct {
+    uint64_t check;
+    uint64_t count;
+} memo_entry;
+
+// Statistiques de la table d'un thread du scheduler
+typedef struct {
+    uint64_t probes;
+    uint64_t hits;
+} __attribute__((aligned(64))) perft_stats;
+
+// Sous-arbre compté par une tâche du scheduler, dont le plateau est la position
+typedef struct {
+    player p;               // joueur qui a le trait
+    int depth;
+    uint64_t count;
+} perft_job;
+
+// Énumération des tours d'une position ; les tours d'une même pièce prise sont dédoublonnés
+typedef struct {
+    sched s;
+    board game;
+    player p;
+    int depth;              // profondeur restante avant le tour
+    uint64_t count;
+    board *children;        // si non NULL, les positions après chaque tour y sont gardées au lieu d'être comptées
+    int nb_children;
+    int max_children;
+    uint64_t land;          // cases d'arrivée déjà vues pour la pièce prise
+    uint64_t met;           // pièces rencontrées déjà vues pour la pièce prise
+    uint64_t used_edges;    // segments empruntés par la pièce prise
+    bool goal;
+    int nb_empty;           // cases où un échange peut envoyer la pièce rencontrée, -1 tant qu'elles ne sont pas comptées
+} explorer;
+
+static memo_entry *table;
+static uint64_t table_mask;
+static perft_stats *stats;
+
+static uint64_t zobrist_square[DIMENSION * DIMENSION][NB_SIZE + 1];
+static uint64_t zobrist_available[NB_PLAYERS + 1][NB_SIZE + 1][NB_INITIAL_PIECES + 1];
+static uint64_t zobrist_player[NB_PLAYERS + 1];
+static uint64_t zobrist_depth[MAX_DEPTH + 1];
+
+// Déplacement de chaque direction (GOAL n'en a pas)
+static const int delta_line[5] = {0, -1, 1, 0, 0};
+static const int delta_col[5] = {0, 0, 0, 1, -1};
+
+static uint64_t perft(sched s, board game, player p, int depth);
+
+// Numéro du segment entre une case et sa voisine : les segments horizontaux puis les verticaux
+static int edge_index(int line, int col, direction d) {
+    switch (d)
+    {
+        case EAST:
+            return line * (DIMENSION - 1) + col;
+        case WEST:
+            return line * (DIMENSION - 1) + col - 1;
+        case NORTH:
+            return DIMENSION * (DIMENSION - 1) + line * DIMENSION + col;
+        default:
+            return DIMENSION * (DIMENSION - 1) + (line - 1) * DIMENSION + col;
+    }
+}
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void init_zobrist(void) {
+    uint64_t state = 0x5045524654ULL;
+    for (int sq = 0; sq < DIMENSION * DIMENSION; sq++) {
+        for (int s = 0; s <= NB_SIZE; s++) {
+            zobrist_square[sq][s] = splitmix64(&state);
+        }
+    }
+    for (int p = 0; p <= NB_PLAYERS; p++) {
+        for (int s = 0; s <= NB_SIZE; s++) {
+            for (int n = 0; n <= NB_INITIAL_PIECES; n++) {
+                zobrist_available[p][s][n] = splitmix64(&state);
+            }
+        }
+        zobrist_player[p] = splitmix64(&state);
+    }
+    for (int d = 0; d <= MAX_DEPTH; d++) {
+        zobrist_depth[d] = splitmix64(&state);
+    }
+}
+
+// Clé de la position, lue avec les fonctions de board.h pour ne dépendre d'aucune implémentation
+static uint64_t position_hash(board game, player p) {
+    uint64_t key = zobrist_player[p];
+    for (int line = 0; line < DIMENSION; line++) {
+        for (int col = 0; col < DIMENSION; col++) {
+            key ^= zobrist_square[line * DIMENSION + col][get_piece_size(game, line, col)];
+        }
+    }
+    for (int q = SOUTH_P; q <= NORTH_P; q++) {
+        for (int s = ONE; s <= THREE; s++) {
+            key ^= zobrist_available[q][s][nb_pieces_available(game, s, q)];
+        }
+    }
+    return key;
+}
+
+static bool probe(uint64_t key, uint64_t *count) {
+    memo_entry *e = &table[key & table_mask];
+    perft_stats *st = &stats[sched_worker_id()];
+    uint64_t check = __atomic_load_n(&e->check, __ATOMIC_RELAXED);
+    uint64_t value = __atomic_load_n(&e->count, __ATOMIC_RELAXED);
+    st->probes++;
+    if ((check ^ value) != key)
+    {
+        return false;
+    }
+    st->hits++;
+    *count = value;
+    return true;
+}
+
+static void store(uint64_t key, uint64_t count) {
+    memo_entry *e = &table[key & table_mask];
+    __atomic_store_n(&e->check, key ^ count, __ATOMIC_RELAXED);
+    __atomic_store_n(&e->count, count, __ATOMIC_RELAXED);
+}
+
+// Compte la position qui suit un tour, ou la garde pour en faire une tâche
+static void add_child(explorer *e, board child) {
+    if (e->children != NULL && e->nb_children == e->max_children)
+    {
+        board *bigger = realloc(e->children, 2 * e->max_children * sizeof(board));
+        if (bigger != NULL)
+        {
+            e->children = bigger;
+            e->max_children *= 2;
+        }
+    }
+    if (e->children != NULL && e->nb_children < e->max_children)
+    {
+        e->children[e->nb_children++] = child;
+        return;
+    }
+    e->count += perft(e->s, child, next_player(e->p), e->depth - 1);
+    destroy_game(child);
+}
+
+// Tour qui se termine par le pas d : arrivée sur une case vide ou but
+static void add_move(explorer *e, direction d) {
+    if (e->depth == 1)
+    {
+        e->count++;
+        return;
+    }
+    board child = copy_game(e->game);
+    move_piece(child, d);
+    add_child(e, child);
+}
+
+// Tours d'échange avec la pièce rencontrée : un par case vide
+static void add_swaps(explorer *e) {
+    if (e->depth == 1)
+    {
+        //compté à la première pièce rencontrée : la pièce en main est alors sur une case occupée
+        if (e->nb_empty < 0)
+        {
+            e->nb_empty = 0;
+            for (int line = 0; line < DIMENSION; line++) {
+                for (int col = 0; col < DIMENSION; col++) {
+                    e->nb_empty += get_piece_size(e->game, line, col) == NONE;
+                }
+            }
+        }
+        e->count += e->nb_empty;
+        return;
+    }
+    for (int line = 0; line < DIMENSION; line++) {
+        for (int col = 0; col < DIMENSION; col++) {
+            if (get_piece_size(e->game, line, col) == NONE)
+            {
+                board child = copy_game(e->game);
+                swap_piece(child, line, col);
+                add_child(e, child);
+            }
+        }
+    }
+}
+
+// Parcourt les pas possibles de la pièce en main ; les pas qui ne terminent pas le tour sont annulés ensuite.
+// under est la pièce sur laquelle la pièce en main est arrivée (get_piece_size donnerait la pièce en main)
+static void explore_steps(explorer *e, size under) {
+    board game = e->game;
+    int line = picked_piece_line(game);
+    int col = picked_piece_column(game);
+    int left = movement_left(game);
+    //sur une autre pièce, le rebond repart avec la taille de cette pièce
+    int steps = (left == 0) ? (int)under : left;
+
+    for (direction d = GOAL; d <= WEST; d++) {
+        if (!is_move_possible(game, d))
+        {
+            continue;
+        }
+        if (d == GOAL)
+        {
+            if (!e->goal)
+            {
+                e->goal = true;
+                add_move(e, d);
+            }
+            continue;
+        }
+
+        //la règle du segment emprunté une seule fois est appliquée ici aussi :
+        //une implémentation qui l'oublie ferait boucler les rebonds sans fin
+        uint64_t edge = (uint64_t)1 << edge_index(line, col, d);
+        if (e->used_edges & edge)
+        {
+            continue;
+        }
+
+        int target_line = line + delta_line[d];
+        int target_col = col + delta_col[d];
+        uint64_t bit = (uint64_t)1 << (target_line * DIMENSION + target_col);
+        size target = get_piece_size(game, target_line, target_col);
+        if (steps == 1 && target == NONE)
+        {
+            //le dernier pas pose la pièce : le tour est fini
+            if (!(e->land & bit))
+            {
+                e->land |= bit;
+                add_move(e, d);
+            }
+            continue;
+        }
+
+        move_piece(game, d);
+        if (movement_left(game) == 0 && !(e->met & bit))
+        {
+            e->met |= bit;
+            add_swaps(e);
+        }
+        e->used_edges |= edge;
+        explore_steps(e, target);
+        e->used_edges &= ~edge;
+        cancel_step(game);
+    }
+}
+
+// Tours de placement : une taille qui reste à placer, une case vide de la ligne du joueur
+static void explore_placements(explorer *e) {
+    int line = (e->p == SOUTH_P) ? 0 : DIMENSION - 1;
+    for (size s = ONE; s <= THREE; s++) {
+        if (nb_pieces_available(e->game, s, e->p) <= 0)
+        {
+            continue;
+        }
+        for (int col = 0; col < DIMENSION; col++) {
+            if (get_piece_size(e->game, line, col) != NONE)
+            {
+                continue;
+            }
+            if (e->depth == 1)
+            {
+                e->count++;
+                continue;
+            }
+            board child = copy_game(e->game);
+            place_piece(child, s, e->p, col);
+            add_child(e, child);
+        }
+    }
+}
+
+static bool is_setup(board game, player p) {
+    for (size s = ONE; s <= THREE; s++) {
+        if (nb_pieces_available(game, s, p) > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Tous les tours du joueur
+static void explore_turns(explorer *e) {
+    board game = e->game;
+    if (is_setup(game, e->p))
+    {
+        explore_placements(e);
+        return;
+    }
+
+    int line = (e->p == SOUTH_P) ? southmost_occupied_line(game) : northmost_occupied_line(game);
+    if (line < 0)
+    {
+        return;
+    }
+    for (int col = 0; col < DIMENSION; col++) {
+        if (pick_piece(game, e->p, line, col) != OK)
+        {
+            continue;
+        }
+        e->land = 0;
+        e->met = 0;
+        e->goal = false;
+        e->used_edges = 0;
+        e->nb_empty = -1;
+        explore_steps(e, NONE);
+        cancel_movement(game);
+    }
+}
+
+static void perft_task(sched s, sched_task *task) {
+    perft_job *job = task->arg;
+    job->count = perft(s, task->game, job->p, job->depth);
+}
+
+// Compte les sous-arbres des tours de la position en parallèle : une tâche par tour
+static uint64_t split_turns(sched s, board game, player p, int depth) {
+    explorer e = {.s = s, .game = game, .p = p, .depth = depth, .max_children = 64};
+    e.children = malloc(e.max_children * sizeof(board));
+    explore_turns(&e);
+
+    sched_task *tasks = malloc(e.nb_children * sizeof(sched_task));
+    perft_job *jobs = malloc(e.nb_children * sizeof(perft_job));
+    if (tasks == NULL || jobs == NULL)
+    {
+        //sans mémoire pour les tâches, les sous-arbres sont comptés ici
+        for (int i = 0; i < e.nb_children; i++) {
+            e.count += perft(s, e.children[i], next_player(p), depth - 1);
+            destroy_game(e.children[i]);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < e.nb_children; i++) {
+            jobs[i] = (perft_job){.p = next_player(p), .depth = depth - 1};
+            sched_task_init(&tasks[i], perft_task, &jobs[i], e.children[i]);
+            sched_fork(s, &tasks[i]);
+        }
+        for (int i = e.nb_children - 1; i >= 0; i--) {
+            sched_join(s, &tasks[i]);
+            e.count += jobs[i].count;
+        }
+    }
+    free(tasks);
+    free(jobs);
+    free(e.children);
+    return e.count;
+}
+
+static uint64_t perft(sched s, board game, player p, int depth) {
+    if (depth == 0)
+    {
+        return 1;
+    }
+    if (get_winner(game) != NO_PLAYER)
+    {
+        return 0;
+    }
+
+    //au dernier niveau les tours sont comptés sans être joués : la table n'y gagnerait rien
+    uint64_t key = 0;
+    uint64_t count;
+    if (depth > 1)
+    {
+        key = position_hash(game, p) ^ zobrist_depth[depth];
+        if (probe(key, &count))
+        {
+            return count;
+        }
+    }
+
+    if (depth >= SPLIT_DEPTH)
+    {
+        count = split_turns(s, game, p, depth);
+    }
+    else
+    {
+        explorer e = {.s = s, .game = game, .p = p, .depth = depth};
+        explore_turns(&e);
+        count = e.count;
+    }
+    if (depth > 1)
+    {
+        store(key, count);
+    }
+    return count;
+}
+
+static double elapsed(struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// Perft de la position à chaque profondeur de 1 à max_depth ; counts reçoit les nombres
+static void run_perft(sched s, int nb_threads, const char *label, board start, player p, int max_depth, uint64_t *counts) {
+    memset(table, 0, (table_mask + 1) * sizeof(memo_entry));
+
+    printf("%s\n", label);
+    for (int depth = 1; depth <= max_depth; depth++) {
+        struct timespec t0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        memset(stats, 0, nb_threads * sizeof(perft_stats));
+        uint64_t steals = sched_steals(s);
+
+        perft_job job = {.p = p, .depth = depth};
+        sched_task root;
+        sched_task_init(&root, perft_task, &job, copy_game(start));
+        sched_run(s, &root);
+
+        uint64_t probes = 0, hits = 0;
+        for (int i = 0; i < nb_threads; i++) {
+            probes += stats[i].probes;
+            hits += stats[i].hits;
+        }
+        double time = elapsed(&t0);
+        counts[depth] = job.count;
+        printf("  profondeur %2d : %20llu   %9.3f s   table %5.1f %%   vols %llu\n", depth,
+               (unsigned long long)job.count, time, probes > 0 ? 100.0 * hits / probes : 0.0,
+               (unsigned long long)(sched_steals(s) - steals));
+        fflush(stdout);
+    }
+}
+
+// Pose le placement "SSSSSS/NNNNNN" sur un plateau neuf ; NULL si le texte n'est pas valide
+static board setup_game(const char *text) {
+    board game = new_game();
+    for (int i = 0; i < NB_PLAYERS; i++) {
+        player p = (i == 0) ? SOUTH_P : NORTH_P;
+        for (int col = 0; col < DIMENSION; col++) {
+            char c = *text++;
+            if (c != '.' && (c < '1' || c > '0' + NB_SIZE || place_piece(game, (size)(c - '0'), p, col) != OK))
+            {
+                destroy_game(game);
+                return NULL;
+            }
+        }
+        if (*text++ != (i == 0 ? '/' : '\0'))
+        {
+            destroy_game(game);
+            return NULL;
+        }
+    }
+    return game;
+}
+
+// Placement par défaut : les tailles 1, 2, 3 à la suite au sud, dans l'ordre inverse au nord
+static void default_setup(char *text) {
+    int available[NB_SIZE + 1];
+    for (int i = 0; i < NB_PLAYERS; i++) {
+        for (int s = ONE; s <= THREE; s++) {
+            available[s] = NB_INITIAL_PIECES;
+        }
+        for (int col = 0; col < DIMENSION; col++) {
+            int s = (i == 0) ? ONE + col % NB_SIZE : THREE - col % NB_SIZE;
+            *text++ = available[s]-- > 0 ? (char)('0' + s) : '.';
+        }
+        *text++ = (i == 0) ? '/' : '\0';
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int max_depth = 4;
+    int nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int table_mb = DEFAULT_TABLE_MB;
+    char default_text[2 * DIMENSION + 2];
+    const char *setup = NULL;
+    const char *first = "S";
+    const char *backend = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-d") == 0) max_depth = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-t") == 0) nb_threads = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-m") == 0) table_mb = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-s") == 0) setup = argv[i + 1];
+        else if (strcmp(argv[i], "-j") == 0) first = argv[i + 1];
+        else if (strcmp(argv[i], "-b") == 0) backend = argv[i + 1];
+    }
+    if (max_depth < 1 || max_depth > MAX_DEPTH || nb_threads < 1 || table_mb < 1 || argc % 2 == 0
+        || (strcmp(first, "S") != 0 && strcmp(first, "N") != 0))
+    {
+        fprintf(stderr, "usage : %s [-d profondeur] [-t threads] [-m Mo] [-s placement] [-j S|N] [-b implémentation|all]\n", argv[0]);
+        return 1;
+    }
+    player p = (first[0] == 'S') ? SOUTH_P : NORTH_P;
+    if (setup == NULL)
+    {
+        default_setup(default_text);
+        setup = default_text;
+    }
+
+    //la table a une puissance de deux d'entrées
+    size_t nb_entries = 1;
+    while (nb_entries * 2 * sizeof(memo_entry) <= (size_t)table_mb << 20) {
+        nb_entries *= 2;
+    }
+    table = malloc(nb_entries * sizeof(memo_entry));
+    if (table == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+    table_mask = nb_entries - 1;
+    init_zobrist();
+
+    sched s = sched_create(nb_threads);
+    if (s == NULL || posix_memalign((void **)&stats, 64, nb_threads * sizeof(perft_stats)) != 0)
+    {
+        fprintf(stderr, "impossible de créer les threads\n");
+        return 1;
+    }
+
+    uint64_t counts[MAX_DEPTH + 1];
+#ifdef BOARD_BACKEND_DYNAMIC
+    //toutes les implémentations l'une après l'autre, comparées à la première
+    if (backend != NULL && strcmp(backend, "all") == 0)
+    {
+        uint64_t reference[MAX_DEPTH + 1];
+        bool same = true;
+        for (int i = 0; board_backend_get(i) != NULL; i++) {
+            board_backend_select(board_backend_get(i)->name);
+            board start = setup_game(setup);
+            if (start == NULL)
+            {
+                fprintf(stderr, "%s : placement refusé : %s\n", board_backend_get(i)->name, setup);
+                return 1;
+            }
+            run_perft(s, nb_threads, board_backend_get(i)->name, start, p, max_depth, i == 0 ? reference : counts);
+            destroy_game(start);
+            for (int d = 1; i > 0 && d <= max_depth; d++) {
+                if (counts[d] != reference[d])
+                {
+                    printf("  différent de %s à la profondeur %d\n", board_backend_get(0)->name, d);
+                    same = false;
+                    break;
+                }
+            }
+        }
+        sched_destroy(s);
+        free(stats);
+        free(table);
+        printf(same ? "nombres identiques\n" : "nombres différents\n");
+        return same ? 0 : 2;
+    }
+    else if (backend != NULL && !board_backend_select(backend))
+    {
+        fprintf(stderr, "implémentation inconnue : %s\n", backend);
+        return 1;
+    }
+    const char *label = board_backend_current()->name;
+#else
+    if (backend != NULL)
+    {
+        fprintf(stderr, "-b demande une compilation avec -DBOARD_BACKEND_DYNAMIC (voir board_backend.h)\n");
+        return 1;
+    }
+    const char *label = "board";
+#endif
+
+    board start = setup_game(setup);
+    if (start == NULL)
+    {
+        fprintf(stderr, "placement refusé : %s\n", setup);
+        return 1;
+    }
+    run_perft(s, nb_threads, label, start, p, max_depth, counts);
+    destroy_game(start);
+    sched_destroy(s);
+    free(stats);
+    free(table);
+    return 0;
+}
@@ -0,0 +1,426 @@
+#include <stdlib.h>
+#include "board_s.h"
+#include "pnsearch.h"
+
+
+// Valeur infinie des nombres de preuve et de réfutation
+#define PN_INF 0x3fffffffu
+
+// Profondeur maximale de la recherche : au-delà, le nœud compte comme une répétition
+#define PN_MAX_DEPTH 128
+
+// Nombre d'entrées par case de la table
+#define PN_BUCKET 4
+
+// Entrée de la table : nombres du point de vue du joueur qui a le trait
+typedef struct {
+    uint64_t key;
+    uint32_t pn;
+    uint32_t dn;
+    uint32_t work;     // taille du sous-arbre développé, pour choisir quoi effacer
+} pn_entry;
+
+// Fils d'un nœud en cours de développement
+typedef struct {
+    signed char from;
+    signed char to;
+    signed char swap_to;
+    uint32_t pn;
+    uint32_t dn;
+} pn_child;
+
+// État du solveur
+typedef struct {
+    board game;
+    player attacker;
+    pn_entry *table;
+    size_t nb_buckets;
+    size_t nb_entries;
+    long nodes;
+    long max_nodes;
+    long gc_runs;
+    uint64_t path[PN_MAX_DEPTH];
+    int depth;
+    turn root_proof;   // tour de la racine qui mène à une position réfutée
+    turn *scratch;     // tours générés, recopiés ensuite dans les fils
+    bool out_of_memory;
+} pn_solver;
+
+// Base de positions consultée avant la recherche (NULL si aucune)
+static const posdb *pn_database = NULL;
+
+// Addition bornée à l'infini
+static uint32_t add_sat(uint32_t a, uint32_t b) {
+    uint32_t sum = a + b;
+    return sum >= PN_INF ? PN_INF : sum;
+}
+
+static pn_entry *lookup(pn_solver *s, uint64_t key) {
+    pn_entry *bucket = &s->table[(key & (s->nb_buckets - 1)) * PN_BUCKET];
+    for (int i = 0; i < PN_BUCKET; i++) {
+        if (bucket[i].key == key)
+        {
+            return &bucket[i];
+        }
+    }
+    return NULL;
+}
+
+// Efface les entrées des petits sous-arbres jusqu'à libérer la moitié de la table
+static void collect_garbage(pn_solver *s) {
+    size_t capacity = s->nb_buckets * PN_BUCKET;
+    uint32_t threshold = 1;
+
+    s->gc_runs++;
+    while (s->nb_entries > capacity / 2 && threshold < PN_INF) {
+        for (size_t i = 0; i < capacity; i++) {
+            if (s->table[i].key != 0 && s->table[i].work <= threshold)
+            {
+                s->table[i].key = 0;
+                s->nb_entries--;
+            }
+        }
+        threshold *= 2;
+    }
+}
+
+static void store(pn_solver *s, uint64_t key, uint32_t pn, uint32_t dn, uint32_t work) {
+    pn_entry *e = lookup(s, key);
+
+    if (e == NULL)
+    {
+        //table trop pleine : on fait de la place avant d'ajouter
+        if (s->nb_entries * 10 >= s->nb_buckets * PN_BUCKET * 9)
+        {
+            collect_garbage(s);
+        }
+
+        //une place libre, sinon l'entrée du plus petit sous-arbre
+        pn_entry *bucket = &s->table[(key & (s->nb_buckets - 1)) * PN_BUCKET];
+        e = &bucket[0];
+        for (int i = 0; i < PN_BUCKET; i++) {
+            if (bucket[i].key == 0)
+            {
+                e = &bucket[i];
+                break;
+            }
+            if (bucket[i].work < e->work)
+            {
+                e = &bucket[i];
+            }
+        }
+        if (e->key == 0)
+        {
+            s->nb_entries++;
+        }
+    }
+
+    e->key = key;
+    e->pn = pn;
+    e->dn = dn;
+    e->work = work;
+}
+
+// Valeur d'une position répétée (ou trop profonde) : un échec pour l'attaquant
+static void repetition_value(pn_solver *s, player to_move, uint32_t *pn, uint32_t *dn) {
+    if (to_move == s->attacker)
+    {
+        *pn = PN_INF;
+        *dn = 0;
+    }
+    else
+    {
+        *pn = 0;
+        *dn = PN_INF;
+    }
+}
+
+static bool on_path(pn_solver *s, uint64_t key) {
+    for (int i = 0; i < s->depth; i++) {
+        if (s->path[i] == key) return true;
+    }
+    return false;
+}
+
+// Valeurs de départ d'un fils : celles de la table, sinon gain immédiat ou 1 / 1
+static void child_value(pn_solver *s, player child_player, pn_child *c) {
+    uint64_t key = position_key(s->game, child_player);
+    pn_entry *e;
+
+    if (on_path(s, key) || s->depth + 1 >= PN_MAX_DEPTH)
+    {
+        repetition_value(s, child_player, &c->pn, &c->dn);
+    }
+    else if ((e = lookup(s, key)) != NULL)
+    {
+        c->pn = e->pn;
+        c->dn = e->dn;
+    }
+    else if (find_winning_turn(s->game, child_player, NULL))
+    {
+        //le fils est résolu sans être développé
+        c->pn = 0;
+        c->dn = PN_INF;
+        store(s, key, c->pn, c->dn, 1);
+    }
+    else
+    {
+        c->pn = 1;
+        c->dn = 1;
+    }
+}
+
+// Développe le nœud courant jusqu'à dépasser l'un des seuils (df-pn en forme negamax)
+static void mid(pn_solver *s, player to_move, uint32_t th_pn, uint32_t th_dn, uint32_t *out_pn, uint32_t *out_dn) {
+    uint64_t key = position_key(s->game, to_move);
+    long start_nodes = s->nodes;
+    player opponent = next_player(to_move);
+
+    s->nodes++;
+
+    //gain immédiat
+    if (find_winning_turn(s->game, to_move, NULL))
+    {
+        *out_pn = 0;
+        *out_dn = PN_INF;
+        store(s, key, *out_pn, *out_dn, 1);
+        return;
+    }
+
+    int nb = generate_turns(s->game, to_move, s->scratch, MAX_TURNS);
+    if (nb == 0)
+    {
+        //aucun tour possible : le joueur a perdu
+        *out_pn = PN_INF;
+        *out_dn = 0;
+        store(s, key, *out_pn, *out_dn, 1);
+        return;
+    }
+
+    pn_child *children = malloc(nb * sizeof(pn_child));
+    if (children == NULL)
+    {
+        //mémoire épuisée : la recherche s'arrête, sans rien ranger dans la table
+        s->out_of_memory = true;
+        s->max_nodes = s->nodes;
+        *out_pn = 1;
+        *out_dn = 1;
+        return;
+    }
+    turn t;
+    t.nb_steps = 0;
+    for (int i = 0; i < nb; i++) {
+        children[i].from = s->scratch[i].from;
+        children[i].to = s->scratch[i].to;
+        children[i].swap_to = s->scratch[i].swap_to;
+    }
+    for (int i = 0; i < nb; i++) {
+        t.from = children[i].from;
+        t.to = children[i].to;
+        t.swap_to = children[i].swap_to;
+        size moved = apply_turn(s->game, to_move, &t);
+        child_value(s, opponent, &children[i]);
+        undo_turn(s->game, &t, moved);
+    }
+
+    s->path[s->depth++] = key;
+
+    uint32_t pn = 0;
+    uint32_t dn = 0;
+    while (true) {
+        //pn = plus petit dn des fils, dn = somme des pn des fils
+        int best = 0;
+        uint32_t second = PN_INF;
+        pn = PN_INF;
+        dn = 0;
+        for (int i = 0; i < nb; i++) {
+            dn = add_sat(dn, children[i].pn);
+            if (children[i].dn < pn)
+            {
+                second = pn;
+                pn = children[i].dn;
+                best = i;
+            }
+            else if (children[i].dn < second)
+            {
+                second = children[i].dn;
+            }
+        }
+
+        if (pn >= th_pn || dn >= th_dn || s->nodes >= s->max_nodes)
+        {
+            break;
+        }
+
+        //seuils du fils le plus prometteur
+        uint32_t child_th_pn = (th_dn >= PN_INF) ? PN_INF : add_sat(th_dn - dn, children[best].pn);
+        uint32_t child_th_dn = (second >= PN_INF) ? th_pn : (th_pn < second + 1 ? th_pn : second + 1);
+
+        t.from = children[best].from;
+        t.to = children[best].to;
+        t.swap_to = children[best].swap_to;
+        size moved = apply_turn(s->game, to_move, &t);
+        mid(s, opponent, child_th_pn, child_th_dn, &children[best].pn, &children[best].dn);
+        undo_turn(s->game, &t, moved);
+    }
+
+    s->depth--;
+
+    //à la racine, le fils de plus petit dn est celui de la preuve
+    if (s->depth == 0 && pn == 0)
+    {
+        for (int i = 0; i < nb; i++) {
+            if (children[i].dn == 0)
+            {
+                s->root_proof.from = children[i].from;
+                s->root_proof.to = children[i].to;
+                s->root_proof.swap_to = children[i].swap_to;
+                break;
+            }
+        }
+    }
+    free(children);
+
+    long work = s->nodes - start_nodes;
+    store(s, key, pn, dn, work >= PN_INF ? PN_INF : (uint32_t)work);
+    *out_pn = pn;
+    *out_dn = dn;
+}
+
+// Retrouve le tour complet (avec son chemin) qui correspond au tour de la preuve
+static void find_proof_turn(pn_solver *s, player p, turn *best) {
+    if (find_winning_turn(s->game, p, best))
+    {
+        return;
+    }
+
+    int nb = generate_turns(s->game, p, s->scratch, MAX_TURNS);
+    for (int i = 0; i < nb; i++) {
+        turn *t = &s->scratch[i];
+        if (t->from == s->root_proof.from && t->to == s->root_proof.to && t->swap_to == s->root_proof.swap_to)
+        {
+            *best = *t;
+            return;
+        }
+    }
+}
+
+void pn_set_database(const posdb *db) {
+    pn_database = db;
+}
+
+// Résultat connu dans la base de positions, PN_UNKNOWN sinon
+static pn_result probe_database(board game, player p, turn *best) {
+    posdb_entry e;
+
+    if (pn_database == NULL || !posdb_probe(pn_database, position_key(game, p), &e))
+    {
+        return PN_UNKNOWN;
+    }
+    if (e.score <= -EVAL_WIN)
+    {
+        return PN_DISPROVEN;
+    }
+    if (e.score < EVAL_WIN)
+    {
+        return PN_UNKNOWN;
+    }
+
+    //le tour de la base est retrouvé parmi les tours de la position
+    if (best != NULL)
+    {
+        turn *list = malloc(MAX_TURNS * sizeof(turn));
+        int nb = (list == NULL) ? 0 : generate_turns(game, p, list, MAX_TURNS);
+        bool found = false;
+        for (int i = 0; i < nb && !found; i++) {
+            if (list[i].from == e.from && list[i].to == e.to && list[i].swap_to == e.swap_to)
+            {
+                *best = list[i];
+                found = true;
+            }
+        }
+        free(list);
+        if (!found)
+        {
+            return PN_UNKNOWN;
+        }
+    }
+    return PN_PROVEN;
+}
+
+pn_result pn_solve(board game, player p, long max_nodes, size_t max_memory, turn *best, pn_stats *stats) {
+    pn_solver s;
+    pn_result result = PN_UNKNOWN;
+
+    if (game->picked_piece != NONE || game->winner != NO_PLAYER)
+    {
+        return PN_UNKNOWN;
+    }
+
+    result = probe_database(game, p, best);
+    if (result != PN_UNKNOWN)
+    {
+        if (stats != NULL)
+        {
+            stats->nodes = 0;
+            stats->gc_runs = 0;
+            stats->entries = 0;
+        }
+        return result;
+    }
+
+    //nombre de cases de la table : la plus grande puissance de 2 qui tient en mémoire
+    s.nb_buckets = 1;
+    while (s.nb_buckets * 2 * PN_BUCKET * sizeof(pn_entry) <= max_memory) {
+        s.nb_buckets *= 2;
+    }
+
+    s.game = game;
+    s.attacker = p;
+    s.table = calloc(s.nb_buckets * PN_BUCKET, sizeof(pn_entry));
+    s.scratch = malloc(MAX_TURNS * sizeof(turn));
+    s.nb_entries = 0;
+    s.nodes = 0;
+    s.max_nodes = max_nodes;
+    s.gc_runs = 0;
+    s.depth = 0;
+    s.out_of_memory = false;
+
+    if (s.table == NULL || s.scratch == NULL)
+    {
+        free(s.table);
+        free(s.scratch);
+        return PN_UNKNOWN;
+    }
+
+    uint32_t pn, dn;
+    mid(&s, p, PN_INF, PN_INF, &pn, &dn);
+
+    if (s.out_of_memory)
+    {
+        result = PN_UNKNOWN;
+    }
+    else if (pn == 0)
+    {
+        result = PN_PROVEN;
+        if (best != NULL)
+        {
+            find_proof_turn(&s, p, best);
+        }
+    }
+    else if (dn == 0)
+    {
+        result = PN_DISPROVEN;
+    }
+
+    if (stats != NULL)
+    {
+        stats->nodes = s.nodes;
+        stats->gc_runs = s.gc_runs;
+        stats->entries = (long)s.nb_entries;
+    }
+
+    free(s.table);
+    free(s.scratch);
+    return result;
+}
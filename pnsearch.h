@@ -0,0 +1,73 @@
+#ifndef _PNSEARCH_H_
+#define _PNSEARCH_H_
+
+#include <stddef.h>
+#include "board.h"
+#include "turn.h"
+#include "posdb.h"
+
+/**
+ * \file pnsearch.h
+ *
+ * \brief Résolution des gains forcés par recherche de nombres de preuve (df-pn).
+ *
+ * Le solveur cherche si le joueur qui a le trait peut forcer la victoire,
+ * quoi que fasse l'adversaire. Près du but l'arbre est très étroit
+ * (un tour gagnant termine la partie), ce qui convient bien mieux à une
+ * recherche en nombres de preuve qu'à un alpha-bêta à profondeur fixe.
+ *
+ * Les nœuds sont rangés dans une table de hachage de taille bornée ;
+ * quand elle se remplit, les entrées des plus petits sous-arbres sont effacées.
+ *
+ * Une position répétée sur le chemin courant, ou plus profonde que PN_MAX_DEPTH (pnsearch.c),
+ * compte comme un échec pour le joueur qui cherche à gagner : une preuve est donc toujours sûre,
+ * alors qu'une réfutation signifie seulement que le gain n'a pas été trouvé sans répétition
+ * ni au-delà de PN_MAX_DEPTH. Ces valeurs dépendent du chemin et sont pourtant rangées dans la table.
+ *
+ * L'outil pnsolve.c résout les positions données en notation (notation.h).
+ */
+
+/**
+ * @brief résultat de la résolution.
+ */
+typedef enum pn_result_e {
+	PN_UNKNOWN, /**< budget ou mémoire épuisés avant la fin */
+	PN_PROVEN, /**< le joueur qui a le trait gagne à coup sûr */
+	PN_DISPROVEN, /**< aucun gain trouvé sans répétition ni au-delà de PN_MAX_DEPTH */
+	} pn_result;
+
+/**
+ * @brief statistiques d'une résolution.
+ */
+typedef struct {
+	long nodes; /**< nœuds développés */
+	long gc_runs; /**< nettoyages de la table */
+	long entries; /**< entrées dans la table à la fin */
+} pn_stats;
+
+/**
+ * @brief Indique la base de positions consultée avant chaque recherche.
+ *
+ * Une position de la base dont le score est un gain (ou une perte) prouvé
+ * est résolue sans recherche.
+ *
+ * @param db la base, ouverte par ::posdb_open, ou NULL pour ne plus en consulter.
+ */
+void pn_set_database(const posdb *db);
+
+/**
+ * @brief Cherche un gain forcé pour le joueur qui a le trait.
+ *
+ * Le plateau est utilisé pour la recherche mais rendu dans son état initial.
+ *
+ * @param game le plateau, entre deux tours.
+ * @param p le joueur qui a le trait.
+ * @param max_nodes nombre maximal de nœuds développés.
+ * @param max_memory taille maximale de la table, en octets.
+ * @param best si non NULL et si le gain est prouvé, reçoit un tour gagnant.
+ * @param stats si non NULL, reçoit les statistiques de la recherche.
+ * @return le résultat de la résolution.
+ */
+pn_result pn_solve(board game, player p, long max_nodes, size_t max_memory, turn *best, pn_stats *stats);
+
+#endif /*_PNSEARCH_H_*/
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "board_s.h"
+#include "notation.h"
+#include "pnsearch.h"
+
+// Outil de résolution des gains forcés (voir pnsearch.h) sur des positions en notation (voir notation.h)
+// Compilation : gcc -O2 pnsolve.c pnsearch.c notation.c posdb.c board.c eval.c board_tables.c turn.c walks_table.c -o pnsolve
+// Usage : ./pnsolve [-n nœuds] [-m Mo] [-b base.db] [fichier]
+//
+// Une position par ligne, lue dans le fichier ou sur l'entrée standard ; le joueur qui a le trait
+// doit être donné, entre deux tours. Pour chaque position, une ligne :
+// "position résultat tour nœuds nettoyages entrées ms", le tour sous la forme l,c-l,c[/l,c]
+// (départ, arrivée ou "but", case de l'échange), "-" si le gain n'est pas prouvé.
+
+#define DEFAULT_NODES 10000000
+#define DEFAULT_TABLE_MB 256
+
+static const char *result_names[] = {"inconnu", "gagné", "non_prouvé"};
+
+static long now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000 + t.tv_nsec / 1000000;
+}
+
+static void print_square(int square) {
+    printf("%d,%d", SQUARE_LINE(square), SQUARE_COL(square));
+}
+
+static void print_turn(const turn *t) {
+    print_square(t->from);
+    printf("-");
+    if (t->to == NO_SQUARE)
+    {
+        printf("but");
+    }
+    else
+    {
+        print_square(t->to);
+    }
+    if (t->swap_to != NO_SQUARE)
+    {
+        printf("/");
+        print_square(t->swap_to);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    long max_nodes = DEFAULT_NODES;
+    long table_mb = DEFAULT_TABLE_MB;
+    const char *db_path = NULL;
+    const char *input = NULL;
+    bool usage = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) max_nodes = atol(argv[++i]);
+        else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) table_mb = atol(argv[++i]);
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) db_path = argv[++i];
+        else if (input == NULL) input = argv[i];
+        else usage = true;
+    }
+    if (usage || max_nodes < 1 || table_mb < 1)
+    {
+        fprintf(stderr, "usage : %s [-n nœuds] [-m Mo] [-b base.db] [fichier]\n", argv[0]);
+        return 1;
+    }
+
+    posdb db;
+    if (db_path != NULL)
+    {
+        if (!posdb_open(&db, db_path))
+        {
+            fprintf(stderr, "impossible d'ouvrir %s\n", db_path);
+            return 1;
+        }
+        pn_set_database(&db);
+    }
+    FILE *f = input == NULL ? stdin : fopen(input, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "impossible d'ouvrir %s\n", input);
+        return 1;
+    }
+
+    board game = new_game();
+    char line[256];
+    int status = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0')
+        {
+            continue;
+        }
+
+        player p;
+        if (!notation_read(game, line, &p, NULL) || p == NO_PLAYER || game->picked_piece != NONE || game->winner != NO_PLAYER)
+        {
+            fprintf(stderr, "position invalide (le trait doit être donné, entre deux tours) : %s\n", line);
+            status = 1;
+            continue;
+        }
+
+        turn best;
+        pn_stats stats;
+        long start = now_ms();
+        pn_result result = pn_solve(game, p, max_nodes, (size_t)table_mb << 20, &best, &stats);
+        printf("%s %s ", line, result_names[result]);
+        if (result == PN_PROVEN)
+        {
+            print_turn(&best);
+        }
+        else
+        {
+            printf("-");
+        }
+        printf(" %ld %ld %ld %ld\n", stats.nodes, stats.gc_runs, stats.entries, now_ms() - start);
+        fflush(stdout);
+    }
+
+    destroy_game(game);
+    if (f != stdin)
+    {
+        fclose(f);
+    }
+    if (db_path != NULL)
+    {
+        pn_set_database(NULL);
+        posdb_close(&db);
+    }
+    return status;
+}
@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "posdb.h"
+
+
+#define POSDB_MAGIC "GYGESDB"
+#define POSDB_VERSION 1
+
+// Nombre de relectures d'une entrée en cours d'écriture avant d'abandonner
+#define POSDB_RETRIES 64
+
+// En-tête du fichier (32 octets), suivi des cases
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t dimension;
+    uint64_t nb_slots;
+    uint64_t nb_entries;
+} posdb_header;
+
+_Static_assert(sizeof(posdb_entry) == 32, "une entrée de la base fait 32 octets");
+_Static_assert(sizeof(posdb_header) == 32, "l'en-tête de la base fait 32 octets");
+
+static posdb_header *header_of(const posdb *db) {
+    return (posdb_header *)db->map;
+}
+
+// Projette le fichier ouvert et vérifie son en-tête
+static bool map_file(posdb *db, int fd, bool writable) {
+    struct stat st;
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(posdb_header))
+    {
+        return false;
+    }
+
+    void *map = mmap(NULL, st.st_size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const posdb_header *header = map;
+    uint64_t nb_slots = header->nb_slots;
+    if (memcmp(header->magic, POSDB_MAGIC, sizeof(POSDB_MAGIC)) != 0 || header->version != POSDB_VERSION
+        || header->dimension != DIMENSION || nb_slots == 0 || (nb_slots & (nb_slots - 1)) != 0
+        || sizeof(posdb_header) + nb_slots * sizeof(posdb_entry) > (uint64_t)st.st_size)
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    db->map = map;
+    db->map_size = st.st_size;
+    db->nb_slots = nb_slots;
+    db->slots = (posdb_entry *)((char *)map + sizeof(posdb_header));
+    return true;
+}
+
+bool posdb_open(posdb *db, const char *path) {
+    db->map = NULL;
+    db->fd = -1;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    //la projection reste valide après la fermeture du descripteur
+    bool ok = map_file(db, fd, false);
+    close(fd);
+    return ok;
+}
+
+void posdb_close(posdb *db) {
+    if (db->map != NULL)
+    {
+        munmap(db->map, db->map_size);
+        db->map = NULL;
+    }
+    if (db->fd >= 0)
+    {
+        close(db->fd);
+        db->fd = -1;
+    }
+}
+
+bool posdb_probe(const posdb *db, uint64_t key, posdb_entry *out) {
+    if (db->map == NULL || key == 0)
+    {
+        return false;
+    }
+
+    uint64_t mask = db->nb_slots - 1;
+    for (uint64_t i = key & mask, n = 0; n < db->nb_slots; i = (i + 1) & mask, n++) {
+        const posdb_entry *slot = &db->slots[i];
+        posdb_entry copy;
+        int tries = 0;
+
+        //lecture de type seqlock : on recopie l'entrée tant qu'elle change pendant la copie
+        while (true) {
+            uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+            if ((seq & 1) == 0)
+            {
+                memcpy(&copy, slot, sizeof(copy));
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+                if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq)
+                {
+                    break;
+                }
+            }
+            if (++tries >= POSDB_RETRIES)
+            {
+                return false;
+            }
+        }
+
+        if (copy.key == 0)
+        {
+            return false;
+        }
+        if (copy.key == key)
+        {
+            *out = copy;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool posdb_create(const char *path, uint64_t nb_slots) {
+    posdb_header header;
+    posdb_entry empty;
+    uint64_t size = 1;
+
+    while (size < nb_slots) {
+        size *= 2;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, POSDB_MAGIC, sizeof(POSDB_MAGIC));
+    header.version = POSDB_VERSION;
+    header.dimension = DIMENSION;
+    header.nb_slots = size;
+    memset(&empty, 0, sizeof(empty));
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    for (uint64_t i = 0; ok && i < size; i++) {
+        ok = fwrite(&empty, sizeof(empty), 1, f) == 1;
+    }
+    if (fclose(f) != 0)
+    {
+        ok = false;
+    }
+    return ok;
+}
+
+bool posdb_open_writer(posdb *db, const char *path) {
+    db->map = NULL;
+    db->fd = -1;
+
+    int fd = open(path, O_RDWR);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    //un seul écrivain à la fois
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0 || !map_file(db, fd, true))
+    {
+        close(fd);
+        return false;
+    }
+    db->fd = fd;
+    return true;
+}
+
+// Écrit le contenu d'une entrée entre deux incréments du compteur de séquence
+static void write_slot(posdb_entry *slot, const posdb_entry *e) {
+    uint32_t seq = slot->seq;
+
+    __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->score = e->score;
+    slot->visits = e->visits;
+    slot->depth = e->depth;
+    slot->from = e->from;
+    slot->to = e->to;
+    slot->swap_to = e->swap_to;
+    slot->key = e->key;
+    __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+bool posdb_store(posdb *db, const posdb_entry *e) {
+    posdb_header *header = header_of(db);
+    uint64_t mask = db->nb_slots - 1;
+
+    if (e->key == 0)
+    {
+        return true;
+    }
+
+    for (uint64_t i = e->key & mask;; i = (i + 1) & mask) {
+        posdb_entry *slot = &db->slots[i];
+
+        if (slot->key == e->key)
+        {
+            //fusion : on garde l'analyse la plus profonde et on cumule les visites
+            posdb_entry merged = (e->depth >= slot->depth) ? *e : *slot;
+            merged.visits = slot->visits + e->visits;
+            write_slot(slot, &merged);
+            return true;
+        }
+
+        if (slot->key == 0)
+        {
+            //au-delà des trois quarts, les sondages deviennent trop longs
+            if ((header->nb_entries + 1) * 4 > db->nb_slots * 3)
+            {
+                return false;
+            }
+            write_slot(slot, e);
+            header->nb_entries++;
+            return true;
+        }
+    }
+}
+
+bool posdb_grow(posdb *db, const char *path) {
+    char tmp_path[4096];
+    posdb bigger;
+
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >= (int)sizeof(tmp_path)
+        || !posdb_create(tmp_path, db->nb_slots * 2))
+    {
+        return false;
+    }
+    if (!posdb_open_writer(&bigger, tmp_path))
+    {
+        unlink(tmp_path);
+        return false;
+    }
+
+    for (uint64_t i = 0; i < db->nb_slots; i++) {
+        if (db->slots[i].key != 0)
+        {
+            posdb_store(&bigger, &db->slots[i]);
+        }
+    }
+
+    if (msync(bigger.map, bigger.map_size, MS_SYNC) != 0 || rename(tmp_path, path) != 0)
+    {
+        posdb_close(&bigger);
+        unlink(tmp_path);
+        return false;
+    }
+
+    //la nouvelle table, déjà verrouillée, remplace l'ancienne
+    posdb_close(db);
+    *db = bigger;
+    return true;
+}
+
+uint64_t posdb_count(const posdb *db) {
+    return header_of(db)->nb_entries;
+}
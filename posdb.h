@@ -0,0 +1,120 @@
+#ifndef _POSDB_H_
+#define _POSDB_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "board.h"
+
+/**
+ * \file posdb.h
+ *
+ * \brief Base de positions analysées, dans un fichier projeté en mémoire.
+ *
+ * Le fichier est une table de hachage à adressage ouvert (sondage linéaire),
+ * indexée par la clé de Zobrist de la position et du joueur qui a le trait
+ * (::position_key). Chaque entrée garde le meilleur tour trouvé, son score,
+ * la profondeur de l'analyse et le nombre de visites.
+ *
+ * Le moteur projette le fichier en lecture seule avec ::posdb_open :
+ * il n'y a rien à charger ni à décoder. Les lecteurs ne prennent aucun verrou ;
+ * chaque entrée porte un compteur de séquence, impair pendant une écriture,
+ * qui leur permet de relire une entrée modifiée pendant leur lecture.
+ *
+ * Un seul écrivain à la fois (l'outil posdbtool.c) modifie le fichier,
+ * sous un verrou exclusif (flock) pris par ::posdb_open_writer.
+ */
+
+/**
+ * @brief Une position analysée (32 octets).
+ */
+typedef struct {
+	uint64_t key; /**< clé de la position, 0 pour une case vide */
+	uint32_t seq; /**< compteur de séquence, impair pendant une écriture */
+	int32_t score; /**< score pour le joueur qui a le trait (::EVAL_WIN pour un gain prouvé) */
+	uint32_t visits; /**< nombre de fois où la position a été analysée */
+	uint16_t depth; /**< profondeur de l'analyse */
+	signed char from; /**< meilleur tour : case de départ (voir ::turn) */
+	signed char to; /**< meilleur tour : case d'arrivée */
+	signed char swap_to; /**< meilleur tour : case de l'échange */
+	unsigned char reserved[7];
+} posdb_entry;
+
+/**
+ * @brief Une base ouverte.
+ */
+typedef struct {
+	posdb_entry *slots; /**< les cases de la table */
+	uint64_t nb_slots; /**< nombre de cases, une puissance de 2 */
+	void *map; /**< début de la projection */
+	size_t map_size; /**< taille de la projection */
+	int fd; /**< descripteur gardé par l'écrivain pour son verrou, -1 sinon */
+} posdb;
+
+/**
+ * @brief Ouvre une base en lecture seule.
+ * @param db reçoit la base.
+ * @param path le chemin du fichier.
+ * @return false si le fichier est absent ou invalide.
+ */
+bool posdb_open(posdb *db, const char *path);
+
+/**
+ * @brief Ferme une base ouverte par ::posdb_open ou ::posdb_open_writer.
+ */
+void posdb_close(posdb *db);
+
+/**
+ * @brief Cherche une position, sans verrou.
+ * @param db la base.
+ * @param key la clé de la position (::position_key).
+ * @param out reçoit une copie cohérente de l'entrée.
+ * @return true si la position est dans la base.
+ */
+bool posdb_probe(const posdb *db, uint64_t key, posdb_entry *out);
+
+/**
+ * @brief Crée une base vide.
+ * @param path le chemin du fichier (remplacé s'il existe).
+ * @param nb_slots nombre de cases, arrondi à la puissance de 2 supérieure.
+ * @return false en cas d'erreur d'écriture.
+ */
+bool posdb_create(const char *path, uint64_t nb_slots);
+
+/**
+ * @brief Ouvre une base en écriture, sous verrou exclusif.
+ * @param db reçoit la base.
+ * @param path le chemin du fichier.
+ * @return false si le fichier est invalide ou déjà ouvert par un autre écrivain.
+ */
+bool posdb_open_writer(posdb *db, const char *path);
+
+/**
+ * @brief Ajoute une position, ou la fusionne avec celle déjà présente.
+ *
+ * Lors d'une fusion, les visites s'additionnent et l'analyse la plus profonde
+ * est gardée (la nouvelle à profondeur égale).
+ *
+ * @param db la base, ouverte par ::posdb_open_writer.
+ * @param e l'entrée (seq est ignoré).
+ * @return false si la table est remplie aux trois quarts : il faut l'agrandir avec ::posdb_grow.
+ */
+bool posdb_store(posdb *db, const posdb_entry *e);
+
+/**
+ * @brief Double la taille d'une base ouverte en écriture.
+ *
+ * La nouvelle table est écrite à côté puis remplace l'ancienne par un renommage :
+ * les lecteurs déjà ouverts gardent l'ancienne projection jusqu'à leur réouverture.
+ *
+ * @param db la base, ouverte par ::posdb_open_writer ; elle est rouverte sur la nouvelle table.
+ * @param path le chemin du fichier.
+ * @return false en cas d'erreur, la base restant alors ouverte sur l'ancienne table.
+ */
+bool posdb_grow(posdb *db, const char *path);
+
+/**
+ * @brief Nombre de positions de la base.
+ */
+uint64_t posdb_count(const posdb *db);
+
+#endif /*_POSDB_H_*/
@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "posdb.h"
+
+// Outil d'écriture de la base de positions (voir posdb.h), le seul écrivain du fichier
+// Compilation : gcc posdbtool.c posdb.c -o posdbtool
+// Usage :
+//   ./posdbtool create base.db [cases]        crée une base vide
+//   ./posdbtool append base.db fichier.txt    ajoute des positions au format texte ("-" : entrée standard)
+//   ./posdbtool merge base.db autre.db...     fusionne d'autres bases (par exemple d'autres machines)
+//   ./posdbtool stats base.db                 affiche le remplissage
+//
+// Format texte : une position par ligne, "clé score profondeur visites from to swap_to",
+// la clé en hexadécimal.
+
+#define DEFAULT_SLOTS (1 << 20)
+
+// Ajoute une entrée, en agrandissant la table si elle est trop pleine
+static bool store(posdb *db, const char *path, const posdb_entry *e) {
+    while (!posdb_store(db, e)) {
+        if (!posdb_grow(db, path))
+        {
+            fprintf(stderr, "impossible d'agrandir %s\n", path);
+            return false;
+        }
+    }
+    return true;
+}
+
+static int append(posdb *db, const char *path, const char *input) {
+    FILE *f = strcmp(input, "-") == 0 ? stdin : fopen(input, "r");
+    char line[256];
+    long nb = 0;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "impossible d'ouvrir %s\n", input);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        posdb_entry e;
+        int score, depth, from, to, swap_to;
+        unsigned visits;
+
+        memset(&e, 0, sizeof(e));
+        if (sscanf(line, "%" SCNx64 " %d %d %u %d %d %d", &e.key, &score, &depth, &visits, &from, &to, &swap_to) != 7)
+        {
+            continue;
+        }
+        e.score = score;
+        e.depth = depth;
+        e.visits = visits;
+        e.from = from;
+        e.to = to;
+        e.swap_to = swap_to;
+        if (!store(db, path, &e))
+        {
+            break;
+        }
+        nb++;
+    }
+
+    if (f != stdin)
+    {
+        fclose(f);
+    }
+    fprintf(stderr, "%ld positions ajoutées\n", nb);
+    return 0;
+}
+
+static int merge(posdb *db, const char *path, const char *other_path) {
+    posdb other;
+    long nb = 0;
+
+    if (!posdb_open(&other, other_path))
+    {
+        fprintf(stderr, "impossible d'ouvrir %s\n", other_path);
+        return 1;
+    }
+    for (uint64_t i = 0; i < other.nb_slots; i++) {
+        posdb_entry e;
+        if (other.slots[i].key != 0 && posdb_probe(&other, other.slots[i].key, &e))
+        {
+            if (!store(db, path, &e))
+            {
+                break;
+            }
+            nb++;
+        }
+    }
+    posdb_close(&other);
+    fprintf(stderr, "%s : %ld positions fusionnées\n", other_path, nb);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage : %s create|append|merge|stats base.db [arguments]\n", argv[0]);
+        return 1;
+    }
+    const char *command = argv[1];
+    const char *path = argv[2];
+
+    if (strcmp(command, "create") == 0)
+    {
+        uint64_t slots = argc > 3 ? strtoull(argv[3], NULL, 10) : DEFAULT_SLOTS;
+        if (!posdb_create(path, slots))
+        {
+            fprintf(stderr, "impossible de créer %s\n", path);
+            return 1;
+        }
+        return 0;
+    }
+
+    posdb db;
+    if (strcmp(command, "stats") == 0)
+    {
+        if (!posdb_open(&db, path))
+        {
+            fprintf(stderr, "impossible d'ouvrir %s\n", path);
+            return 1;
+        }
+        printf("%" PRIu64 " positions, %" PRIu64 " cases\n", posdb_count(&db), db.nb_slots);
+        posdb_close(&db);
+        return 0;
+    }
+
+    if (!posdb_open_writer(&db, path))
+    {
+        fprintf(stderr, "impossible d'ouvrir %s en écriture (déjà ouverte par un autre écrivain ?)\n", path);
+        return 1;
+    }
+    int status = 0;
+    if (strcmp(command, "append") == 0 && argc == 4)
+    {
+        status = append(&db, path, argv[3]);
+    }
+    else if (strcmp(command, "merge") == 0)
+    {
+        for (int i = 3; i < argc && status == 0; i++) {
+            status = merge(&db, path, argv[i]);
+        }
+    }
+    else
+    {
+        fprintf(stderr, "commande inconnue : %s\n", command);
+        status = 1;
+    }
+    posdb_close(&db);
+    return status;
+}
@@ -0,0 +1,116 @@
+#include "board_s.h"
+#include "rank.h"
+
+
+// Le joueur qui a le trait est le bit de poids faible du numéro
+_Static_assert(NB_PLAYERS == 2, "un seul bit pour le joueur qui a le trait");
+
+// Nombre de pièces de chaque taille sur la grille
+#define PIECES_PER_SIZE (NB_PLAYERS * NB_INITIAL_PIECES)
+
+// Répartitions des tailles sur les cases occupées : les ONE parmi toutes, puis les TWO parmi les autres
+#define NB_TWO_PLACES binomial_table[NB_PIECES - PIECES_PER_SIZE][PIECES_PER_SIZE]
+#define NB_ARRANGEMENTS (binomial_table[NB_PIECES][PIECES_PER_SIZE] * NB_TWO_PLACES)
+
+uint64_t rank_count(void) {
+    return binomial_table[NB_SQUARES][NB_PIECES] * NB_ARRANGEMENTS * 2;
+}
+
+uint64_t rank_position(board game, player to_move) {
+    uint64_t set_rank = 0;
+    uint64_t one_rank = 0;
+    uint64_t two_rank = 0;
+    int nb = 0;
+    int ones = 0;
+    int others = 0;
+    int twos = 0;
+
+    //les cases occupées dans l'ordre croissant, bit par bit
+    for (uint64_t occupied = game->occupied; occupied != 0; occupied &= occupied - 1) {
+        int sq = __builtin_ctzll(occupied);
+        size piece = game->grid[SQUARE_LINE(sq)][SQUARE_COL(sq)];
+
+        set_rank += binomial_table[sq][nb + 1];
+        if (piece == ONE)
+        {
+            one_rank += binomial_table[nb][ones + 1];
+            ones++;
+        }
+        else
+        {
+            if (piece == TWO)
+            {
+                two_rank += binomial_table[others][twos + 1];
+                twos++;
+            }
+            others++;
+        }
+        nb++;
+    }
+
+    uint64_t arrangement = one_rank * NB_TWO_PLACES + two_rank;
+    return ((set_rank * NB_ARRANGEMENTS + arrangement) << 1) | (to_move == NORTH_P);
+}
+
+// Retrouve les k éléments (croissants) de rang colexicographique rank parmi n
+static void unrank_set(uint64_t rank, int n, int k, int *elements) {
+    int candidate = n - 1;
+    for (int i = k; i >= 1; i--) {
+        while (binomial_table[candidate][i] > rank) {
+            candidate--;
+        }
+        rank -= binomial_table[candidate][i];
+        elements[i - 1] = candidate;
+        candidate--;
+    }
+}
+
+void unrank_position(uint64_t index, board game, player *to_move) {
+    int squares[NB_PIECES];
+    int one_places[PIECES_PER_SIZE];
+    int two_places[PIECES_PER_SIZE];
+
+    uint64_t nb_arrangements = NB_ARRANGEMENTS;
+    uint64_t nb_two_places = NB_TWO_PLACES;
+
+    *to_move = (index & 1) ? NORTH_P : SOUTH_P;
+    index >>= 1;
+    uint64_t set_rank = index / nb_arrangements;
+    uint64_t arrangement = index - set_rank * nb_arrangements;
+    uint64_t one_rank = arrangement / nb_two_places;
+    unrank_set(set_rank, NB_SQUARES, NB_PIECES, squares);
+    unrank_set(one_rank, NB_PIECES, PIECES_PER_SIZE, one_places);
+    unrank_set(arrangement - one_rank * nb_two_places, NB_PIECES - PIECES_PER_SIZE, PIECES_PER_SIZE, two_places);
+
+    clear_grid(game);
+    int ones = 0;
+    int others = 0;
+    int twos = 0;
+    for (int i = 0; i < NB_PIECES; i++) {
+        size piece = THREE;
+        if (ones < PIECES_PER_SIZE && one_places[ones] == i)
+        {
+            piece = ONE;
+            ones++;
+        }
+        else
+        {
+            if (twos < PIECES_PER_SIZE && two_places[twos] == others)
+            {
+                piece = TWO;
+                twos++;
+            }
+            others++;
+        }
+        put_piece(game, SQUARE_LINE(squares[i]), SQUARE_COL(squares[i]), piece);
+    }
+
+    //placement terminé
+    for (int pl = SOUTH_P; pl <= NORTH_P; pl++) {
+        for (int s = ONE; s <= THREE; s++) {
+            game->setup_counts[pl][s] = NB_INITIAL_PIECES;
+        }
+    }
+    game->winner = NO_PLAYER;
+    game->picked_piece = NONE;
+}
@@ -0,0 +1,53 @@
+#ifndef _RANK_H_
+#define _RANK_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file rank.h
+ *
+ * \brief Numérotation dense des positions de jeu.
+ *
+ * Une position de jeu est la répartition des ::NB_PIECES pièces sur la grille
+ * (::NB_PLAYERS * ::NB_INITIAL_PIECES pièces de chaque taille) et le joueur qui a le trait.
+ * Les fonctions de ce fichier font correspondre à chaque position un entier
+ * entre 0 et ::rank_count() - 1, et inversement.
+ *
+ * Le numéro se compose, du plus fort au plus faible :
+ * - du rang colexicographique des cases occupées parmi les ::NB_SQUARES cases ;
+ * - du rang des places des ONE parmi les pièces, rangées par case croissante ;
+ * - du rang des places des TWO parmi les pièces restantes ;
+ * - du joueur qui a le trait.
+ * Les rangs sont calculés avec ::binomial_table, construite à la compilation.
+ *
+ * Un intervalle de numéros est un ensemble de positions qui peut être confié
+ * à un autre thread ou à un autre processus.
+ */
+
+/**
+ * @brief Nombre de positions de jeu.
+ * @return la taille de la numérotation (environ 8,7e13 pour le jeu 6x6 complet).
+ */
+uint64_t rank_count(void);
+
+/**
+ * @brief Numéro d'une position.
+ * @param game le plateau, entre deux tours, avec toutes ses pièces posées.
+ * @param to_move le joueur qui a le trait (il n'est pas mémorisé dans le plateau).
+ * @return le numéro, entre 0 et ::rank_count() - 1.
+ */
+uint64_t rank_position(board game, player to_move);
+
+/**
+ * @brief Place sur le plateau la position d'un numéro.
+ *
+ * Les pièces déjà posées sont retirées ; la phase de placement est considérée comme terminée.
+ *
+ * @param index le numéro, entre 0 et ::rank_count() - 1.
+ * @param game le plateau, entre deux tours.
+ * @param to_move reçoit le joueur qui a le trait.
+ */
+void unrank_position(uint64_t index, board game, player *to_move);
+
+#endif /*_RANK_H_*/
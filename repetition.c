@@ -0,0 +1,55 @@
+#include <string.h>
+#include "board_s.h"
+#include "repetition.h"
+
+
+#define FILTER_MASK (REPETITION_FILTER - 1)
+
+uint64_t repetition_key(board game, player to_move) {
+    return position_key(game, to_move);
+}
+
+void repetition_clear(repetition_history *h, int draw_count) {
+    h->count = 0;
+    h->draw_count = draw_count;
+    memset(h->filter, 0, sizeof(h->filter));
+}
+
+void repetition_push(repetition_history *h, uint64_t key) {
+    if (h->count == REPETITION_MAX)
+    {
+        //historique plein : la plus ancienne position est oubliée
+        h->filter[h->keys[0] & FILTER_MASK]--;
+        memmove(h->keys, h->keys + 1, (REPETITION_MAX - 1) * sizeof(uint64_t));
+        h->count--;
+    }
+    h->keys[h->count++] = key;
+    h->filter[key & FILTER_MASK]++;
+}
+
+void repetition_pop(repetition_history *h) {
+    if (h->count == 0)
+    {
+        return;
+    }
+    h->count--;
+    h->filter[h->keys[h->count] & FILTER_MASK]--;
+}
+
+int repetition_count(const repetition_history *h, uint64_t key) {
+    //aucune clé de l'historique n'a ces bits : la position n'y est pas
+    int candidates = h->filter[key & FILTER_MASK];
+    int count = 0;
+    for (int i = h->count - 1; i >= 0 && candidates > 0; i--) {
+        if ((h->keys[i] & FILTER_MASK) == (key & FILTER_MASK))
+        {
+            candidates--;
+            count += h->keys[i] == key;
+        }
+    }
+    return count;
+}
+
+bool repetition_is_draw(const repetition_history *h) {
+    return h->draw_count > 0 && h->count > 0 && repetition_count(h, h->keys[h->count - 1]) >= h->draw_count;
+}
@@ -0,0 +1,81 @@
+#ifndef _REPETITION_H_
+#define _REPETITION_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file repetition.h
+ *
+ * \brief Historique des positions d'une partie, pour reconnaître les répétitions.
+ *
+ * Les pièces n'appartiennent à personne et ::swap_piece peut déplacer une pièce n'importe où :
+ * une partie peut repasser sans fin par les mêmes positions. L'historique garde la clé de chaque
+ * position atteinte entre deux tours (::repetition_key) ; un filtre compte les clés par
+ * leurs bits de poids faible, si bien qu'une position jamais vue est reconnue sans parcourir l'historique.
+ *
+ * La règle de la nulle est facultative : avec un seuil non nul, la partie est nulle quand
+ * la dernière position atteinte l'a été ce nombre de fois (::repetition_is_draw).
+ *
+ * Les clés sont celles de position_key (board_s.h) : l'implémentation board.c est supposée.
+ */
+
+/**
+ * @brief nombre de positions gardées ; au-delà, les plus anciennes sont oubliées.
+ */
+#define REPETITION_MAX 1024
+
+/**
+ * @brief seuil habituel de la nulle : une position atteinte pour la troisième fois.
+ */
+#define REPETITION_DRAW 3
+
+/**
+ * @brief nombre de compteurs du filtre (une puissance de deux).
+ */
+#define REPETITION_FILTER 4096
+
+/**
+ * @brief Historique des positions d'une partie.
+ */
+typedef struct {
+	uint64_t keys[REPETITION_MAX]; /**< clés des positions, de la plus ancienne à la plus récente */
+	int count; /**< nombre de clés */
+	int draw_count; /**< occurrences d'une position qui rendent la partie nulle, 0 sans cette règle */
+	uint16_t filter[REPETITION_FILTER]; /**< nombre de clés de l'historique par bits de poids faible */
+} repetition_history;
+
+/**
+ * @brief Clé d'une position entre deux tours : la grille et le joueur qui a le trait.
+ */
+uint64_t repetition_key(board game, player to_move);
+
+/**
+ * @brief Vide l'historique.
+ * @param h l'historique.
+ * @param draw_count seuil de la nulle (::REPETITION_DRAW), 0 pour jouer sans cette règle.
+ */
+void repetition_clear(repetition_history *h, int draw_count);
+
+/**
+ * @brief Ajoute une position à l'historique ; la plus ancienne est oubliée s'il est plein.
+ */
+void repetition_push(repetition_history *h, uint64_t key);
+
+/**
+ * @brief Retire la dernière position ajoutée (pour annuler un tour).
+ */
+void repetition_pop(repetition_history *h);
+
+/**
+ * @brief Nombre de fois où une position figure dans l'historique.
+ */
+int repetition_count(const repetition_history *h, uint64_t key);
+
+/**
+ * @brief Indique si la partie est nulle : la règle est active et la dernière position
+ * ajoutée figure au moins draw_count fois dans l'historique.
+ */
+bool repetition_is_draw(const repetition_history *h);
+
+#endif /*_REPETITION_H_*/
@@ -0,0 +1,317 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "scheduler.h"
+
+
+#define DEQUE_MASK (SCHED_DEQUE_SIZE - 1)
+
+// Recherches vaines avant de passer de la boucle active à sched_yield, puis au sommeil
+#define SPIN_ROUNDS 64
+#define YIELD_ROUNDS 128
+
+// Deque de Chase-Lev (version de Lê, Pop, Cohen et Zappa Nardelli) : seul son propriétaire
+// empile et dépile en bas, les autres threads volent en haut ; top et bottom sont sur des lignes de cache séparées
+typedef struct {
+    int64_t top __attribute__((aligned(64)));
+    int64_t bottom __attribute__((aligned(64)));
+    sched_task *slots[SCHED_DEQUE_SIZE];
+} deque;
+
+typedef struct {
+    deque tasks;
+    sched s;
+    int id;
+    uint64_t rng;
+    uint64_t steals;
+    pthread_t thread;
+} worker;
+
+struct sched_s {
+    worker *workers;
+    int nb_workers;
+    int stop;                   // atomique
+    deque inbox;                // tâches lancées hors des threads, empilées sous inbox_lock
+    pthread_mutex_t inbox_lock;
+};
+
+static __thread worker *current = NULL;
+
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+static bool deque_push(deque *d, sched_task *task) {
+    int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED);
+    int64_t t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    if (b - t >= SCHED_DEQUE_SIZE)
+    {
+        return false;
+    }
+    //la tâche est publiée par l'écriture de bottom, que les voleurs lisent avec acquire
+    __atomic_store_n(&d->slots[b & DEQUE_MASK], task, __ATOMIC_RELAXED);
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static sched_task *deque_pop(deque *d) {
+    int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED) - 1;
+    __atomic_store_n(&d->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t t = __atomic_load_n(&d->top, __ATOMIC_RELAXED);
+
+    if (t > b)
+    {
+        //file vide
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    sched_task *task = __atomic_load_n(&d->slots[b & DEQUE_MASK], __ATOMIC_RELAXED);
+    if (t == b)
+    {
+        //dernière tâche : un voleur peut la prendre en même temps, le compare-and-swap départage
+        if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        {
+            task = NULL;
+        }
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+static sched_task *deque_steal(deque *d) {
+    int64_t t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b)
+    {
+        return NULL;
+    }
+    sched_task *task = __atomic_load_n(&d->slots[t & DEQUE_MASK], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        //un autre thread l'a prise
+        return NULL;
+    }
+    return task;
+}
+
+static void run_task(sched s, sched_task *task) {
+    task->fn(s, task);
+    if (task->game != NULL)
+    {
+        destroy_game(task->game);
+        task->game = NULL;
+    }
+    __atomic_store_n(&task->done, 1, __ATOMIC_RELEASE);
+}
+
+// Vole une tâche : d'abord celles lancées hors des threads, puis dans les files des autres, à partir d'un thread au hasard
+static sched_task *steal_task(worker *w) {
+    sched s = w->s;
+    sched_task *task = deque_steal(&s->inbox);
+    if (task != NULL)
+    {
+        return task;
+    }
+
+    w->rng ^= w->rng << 13;
+    w->rng ^= w->rng >> 7;
+    w->rng ^= w->rng << 17;
+    int first = (int)(w->rng % s->nb_workers);
+    for (int i = 0; i < s->nb_workers; i++) {
+        worker *victim = &s->workers[(first + i) % s->nb_workers];
+        if (victim != w && (task = deque_steal(&victim->tasks)) != NULL)
+        {
+            __atomic_fetch_add(&w->steals, 1, __ATOMIC_RELAXED);
+            return task;
+        }
+    }
+    return NULL;
+}
+
+// Attente d'un thread sans travail, plus longue à chaque recherche vaine
+static void backoff(int *idle) {
+    (*idle)++;
+    if (*idle < SPIN_ROUNDS)
+    {
+        cpu_relax();
+    }
+    else if (*idle < YIELD_ROUNDS)
+    {
+        sched_yield();
+    }
+    else
+    {
+        int shift = *idle - YIELD_ROUNDS;
+        long us = SCHED_MAX_SLEEP_US;
+        if (shift < 20 && (1L << shift) < us)
+        {
+            us = 1L << shift;
+        }
+        struct timespec delay = {0, us * 1000};
+        nanosleep(&delay, NULL);
+    }
+}
+
+static void *worker_main(void *arg) {
+    worker *w = arg;
+    sched s = w->s;
+    int idle = 0;
+
+    current = w;
+    while (!__atomic_load_n(&s->stop, __ATOMIC_ACQUIRE)) {
+        sched_task *task = deque_pop(&w->tasks);
+        if (task == NULL)
+        {
+            task = steal_task(w);
+        }
+        if (task != NULL)
+        {
+            run_task(s, task);
+            idle = 0;
+        }
+        else
+        {
+            backoff(&idle);
+        }
+    }
+    return NULL;
+}
+
+// Arrête les nb_started premiers threads et libère le scheduler
+static void stop_workers(sched s, int nb_started) {
+    __atomic_store_n(&s->stop, 1, __ATOMIC_RELEASE);
+    for (int i = 0; i < nb_started; i++) {
+        pthread_join(s->workers[i].thread, NULL);
+    }
+    pthread_mutex_destroy(&s->inbox_lock);
+    free(s->workers);
+    free(s);
+}
+
+sched sched_create(int nb_threads) {
+    if (nb_threads < 1)
+    {
+        return NULL;
+    }
+    //les deques sont alignées sur les lignes de cache
+    sched s;
+    if (posix_memalign((void **)&s, 64, sizeof(struct sched_s)) != 0)
+    {
+        return NULL;
+    }
+    memset(s, 0, sizeof(struct sched_s));
+    if (posix_memalign((void **)&s->workers, 64, nb_threads * sizeof(worker)) != 0)
+    {
+        free(s);
+        return NULL;
+    }
+    pthread_mutex_init(&s->inbox_lock, NULL);
+
+    //les files des threads pas encore créés sont vides : les voleurs peuvent déjà les regarder
+    s->nb_workers = nb_threads;
+    for (int i = 0; i < nb_threads; i++) {
+        worker *w = &s->workers[i];
+        w->tasks.top = 0;
+        w->tasks.bottom = 0;
+        w->s = s;
+        w->id = i;
+        w->rng = 0x9e3779b97f4a7c15ULL * (i + 1);
+        w->steals = 0;
+    }
+    for (int i = 0; i < nb_threads; i++) {
+        if (pthread_create(&s->workers[i].thread, NULL, worker_main, &s->workers[i]) != 0)
+        {
+            stop_workers(s, i);
+            return NULL;
+        }
+    }
+    return s;
+}
+
+void sched_destroy(sched s) {
+    if (s != NULL)
+    {
+        stop_workers(s, s->nb_workers);
+    }
+}
+
+void sched_task_init(sched_task *task, sched_fn fn, void *arg, board game) {
+    task->fn = fn;
+    task->arg = arg;
+    task->game = game;
+    task->done = 0;
+}
+
+void sched_fork(sched s, sched_task *task) {
+    if (current == NULL)
+    {
+        //hors des threads : la tâche attend dans la file commune
+        pthread_mutex_lock(&s->inbox_lock);
+        bool pushed = deque_push(&s->inbox, task);
+        pthread_mutex_unlock(&s->inbox_lock);
+        if (!pushed)
+        {
+            run_task(s, task);
+        }
+        return;
+    }
+    if (!deque_push(&current->tasks, task))
+    {
+        run_task(s, task);
+    }
+}
+
+void sched_join(sched s, sched_task *task) {
+    int idle = 0;
+    while (!__atomic_load_n(&task->done, __ATOMIC_ACQUIRE)) {
+        if (current == NULL)
+        {
+            backoff(&idle);
+            continue;
+        }
+        //en attendant, le thread exécute ses propres tâches, puis celles des autres
+        sched_task *other = deque_pop(&current->tasks);
+        if (other == NULL)
+        {
+            other = steal_task(current);
+        }
+        if (other != NULL)
+        {
+            run_task(s, other);
+            idle = 0;
+        }
+        else if (++idle < SPIN_ROUNDS)
+        {
+            cpu_relax();
+        }
+        else
+        {
+            //la tâche attendue a été volée : sans dormir, pour la reprendre dès qu'elle finit
+            sched_yield();
+        }
+    }
+}
+
+void sched_run(sched s, sched_task *task) {
+    sched_fork(s, task);
+    sched_join(s, task);
+}
+
+int sched_worker_id(void) {
+    return current != NULL ? current->id : -1;
+}
+
+uint64_t sched_steals(sched s) {
+    uint64_t total = 0;
+    for (int i = 0; i < s->nb_workers; i++) {
+        total += __atomic_load_n(&s->workers[i].steals, __ATOMIC_RELAXED);
+    }
+    return total;
+}
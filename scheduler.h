@@ -0,0 +1,126 @@
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file scheduler.h
+ *
+ * \brief Répartition de calculs indépendants sur des threads, par vol de tâches.
+ *
+ * Chaque thread a sa file (une deque de Chase-Lev) : il y empile les tâches qu'il lance
+ * avec ::sched_fork et les reprend par le bas, les threads sans travail les volent par le haut.
+ * ::sched_join attend une tâche en exécutant d'autres tâches pendant ce temps : les tâches
+ * peuvent se découper récursivement (perft, recherche), sans thread bloqué.
+ * Un thread qui ne trouve rien à faire attend de plus en plus longtemps avant de réessayer
+ * (boucle active, puis sched_yield, puis sommeil jusqu'à ::SCHED_MAX_SLEEP_US).
+ *
+ * Une tâche a en général son propre plateau, fait avec copy_game par celui qui la lance :
+ * elle peut le modifier librement, et il est détruit quand elle est finie.
+ * Le résultat passe par l'argument de la tâche.
+ * \code
+ * sched_task tasks[MAX_TURNS];
+ * for (int i = 0; i < n; i++) {
+ *     sched_task_init(&tasks[i], count_fn, &counts[i], copy_game(children[i]));
+ *     sched_fork(s, &tasks[i]);
+ * }
+ * for (int i = n - 1; i >= 0; i--) {
+ *     sched_join(s, &tasks[i]);
+ * }
+ * \endcode
+ * Les tâches doivent rester en mémoire jusqu'à leur ::sched_join (sur la pile de celui qui les lance).
+ */
+
+/**
+ * @brief nombre de tâches en attente dans la file d'un thread ; au-delà, ::sched_fork exécute la tâche tout de suite.
+ */
+#define SCHED_DEQUE_SIZE 8192
+
+/**
+ * @brief attente maximale, en microsecondes, d'un thread sans travail entre deux recherches de tâches.
+ */
+#define SCHED_MAX_SLEEP_US 1000
+
+/**
+ * @brief Un ensemble de threads et leurs files.
+ */
+typedef struct sched_s *sched;
+
+typedef struct sched_task_s sched_task;
+
+/**
+ * @brief Fonction d'une tâche, exécutée par l'un des threads.
+ * @param s le scheduler, pour lancer des sous-tâches.
+ * @param task la tâche : son argument et son plateau.
+ */
+typedef void (*sched_fn)(sched s, sched_task *task);
+
+/**
+ * @brief Une tâche, préparée avec ::sched_task_init.
+ */
+struct sched_task_s {
+	sched_fn fn; /**< la fonction de la tâche */
+	void *arg; /**< son argument, qui reçoit aussi son résultat */
+	board game; /**< le plateau de la tâche, détruit à la fin de la tâche ; NULL si elle n'en a pas */
+	int done; /**< non nul quand la tâche est finie (lu de façon atomique) */
+};
+
+/**
+ * @brief Crée les threads.
+ * @param nb_threads nombre de threads, au moins 1 ; celui qui appelle ::sched_run n'en fait pas partie.
+ * @return le scheduler, NULL si la mémoire manque ou si les threads n'ont pas pu être créés.
+ */
+sched sched_create(int nb_threads);
+
+/**
+ * @brief Arrête les threads et libère le scheduler ; aucune tâche ne doit être en cours.
+ */
+void sched_destroy(sched s);
+
+/**
+ * @brief Prépare une tâche.
+ * @param task la tâche.
+ * @param fn sa fonction.
+ * @param arg son argument.
+ * @param game son plateau (fait avec copy_game), qui lui appartient désormais ; NULL si elle n'en a pas.
+ */
+void sched_task_init(sched_task *task, sched_fn fn, void *arg, board game);
+
+/**
+ * @brief Exécute une tâche sur les threads et attend qu'elle soit finie.
+ *
+ * À appeler hors des threads du scheduler, par exemple depuis main ;
+ * la tâche se découpe ensuite avec ::sched_fork et ::sched_join.
+ */
+void sched_run(sched s, sched_task *task);
+
+/**
+ * @brief Lance une tâche depuis une tâche en cours : un autre thread peut la voler.
+ *
+ * À appeler depuis l'un des threads du scheduler. Si la file du thread est pleine,
+ * la tâche est exécutée tout de suite.
+ */
+void sched_fork(sched s, sched_task *task);
+
+/**
+ * @brief Attend la fin d'une tâche lancée avec ::sched_fork, en exécutant d'autres tâches en attendant.
+ *
+ * Les tâches sont attendues dans l'ordre inverse de leur lancement : la dernière lancée,
+ * si elle n'a pas été volée, est alors exécutée directement par le thread qui attend.
+ */
+void sched_join(sched s, sched_task *task);
+
+/**
+ * @brief Numéro du thread du scheduler qui appelle, de 0 à nb_threads - 1 ; -1 hors des threads.
+ *
+ * Sert à indexer des données propres à chaque thread (statistiques, tampons).
+ */
+int sched_worker_id(void);
+
+/**
+ * @brief nombre de tâches volées depuis la création, sur tous les threads.
+ */
+uint64_t sched_steals(sched s);
+
+#endif /*_SCHEDULER_H_*/
@@ -0,0 +1,615 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include "board_s.h"
+#include "search.h"
+
+
+// Score plus grand que tous les autres
+#define SEARCH_INF (EVAL_WIN + 1)
+
+// Au-delà, le score est un gain (ou une perte) forcé
+#define WIN_THRESHOLD (EVAL_WIN - SEARCH_MAX_DEPTH - 1)
+
+// Nœuds visités entre deux lectures de l'horloge
+#define CHECK_NODES 1024
+
+// Baisse du score d'une profondeur à l'autre qui fait prolonger la recherche
+#define SCORE_DROP 20
+
+// Profondeur de la recherche courte qui prédit la réponse de l'adversaire
+#define PREDICT_DEPTH 2
+
+// Taille minimale de la table (entrées)
+#define MIN_TABLE_ENTRIES 1024
+
+// Nature du score rangé dans la table
+enum {
+    BOUND_EXACT,
+    BOUND_LOWER,   // le score vaut au moins la valeur rangée (coupure)
+    BOUND_UPPER    // le score vaut au plus la valeur rangée (aucun tour n'a dépassé alpha)
+};
+
+// Entrée de la table de transposition, du point de vue du joueur qui a le trait
+typedef struct {
+    uint64_t key;
+    int score;
+    signed char depth;
+    unsigned char bound;
+    signed char from;      // meilleur tour trouvé, ::NO_SQUARE si aucun
+    signed char to;
+    signed char swap_to;
+} tt_entry;
+
+// État de l'approfondissement d'une position, gardé entre la réflexion et le tour du joueur
+typedef struct {
+    uint64_t key;      // position_key de la position, 0 si aucune
+    int depth;         // dernière profondeur terminée
+    int score;
+    int score_drop;    // baisse du score à la dernière profondeur
+    int stable;        // profondeurs terminées de suite avec le même meilleur tour
+    turn best;
+    long nodes;
+} deepening;
+
+struct search_engine {
+    tt_entry *table;
+    size_t mask;
+    board game;          // plateau de la recherche en cours
+    turn *lists;         // MAX_TURNS tours par profondeur
+    deepening id;
+    repetition_history history; // positions de la partie (::search_set_history)
+    repetition_history path;    // history, puis les positions du chemin de la recherche
+    const posdb *database;      // base consultée avant de chercher, NULL si aucune
+    bool stop;           // lu et écrit atomiquement : demande d'arrêt
+    long deadline;       // heure limite en millisecondes, 0 sans limite
+
+    //réflexion pendant le tour adverse
+    pthread_t thread;
+    bool pondering;
+    player ponder_player;
+};
+
+static long now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000L + ts.tv_nsec / 1000000;
+}
+
+static bool is_forced(int score) {
+    return score > WIN_THRESHOLD || score < -WIN_THRESHOLD;
+}
+
+// Les gains de la table sont comptés depuis le nœud, ceux de la recherche depuis la racine
+static int score_to_table(int score, int ply) {
+    if (score > WIN_THRESHOLD)
+    {
+        return score + ply;
+    }
+    if (score < -WIN_THRESHOLD)
+    {
+        return score - ply;
+    }
+    return score;
+}
+
+static int score_from_table(int score, int ply) {
+    if (score > WIN_THRESHOLD)
+    {
+        return score - ply;
+    }
+    if (score < -WIN_THRESHOLD)
+    {
+        return score + ply;
+    }
+    return score;
+}
+
+static bool same_turn(const turn *a, const turn *b) {
+    return a->from == b->from && a->to == b->to && a->swap_to == b->swap_to;
+}
+
+// Compte un nœud et lit l'horloge de temps en temps ; renvoie true si la recherche doit s'arrêter
+static bool should_stop(search_engine *e) {
+    if (++e->id.nodes % CHECK_NODES == 0 && e->deadline > 0 && now_ms() >= e->deadline)
+    {
+        __atomic_store_n(&e->stop, true, __ATOMIC_RELAXED);
+    }
+    return __atomic_load_n(&e->stop, __ATOMIC_RELAXED);
+}
+
+// Negamax alpha-bêta ; best (à la racine) reçoit le meilleur tour. Renvoie 0 si la recherche est arrêtée.
+static int negamax(search_engine *e, player p, int depth, int ply, int alpha, int beta, turn *best) {
+    if (should_stop(e))
+    {
+        return 0;
+    }
+    if (find_winning_turn(e->game, p, best))
+    {
+        return EVAL_WIN - ply;
+    }
+    uint64_t key = position_key(e->game, p);
+    if (ply > 0 && repetition_count(&e->path, key) > 0)
+    {
+        //position déjà atteinte dans la partie ou sur le chemin : le cycle est compté comme nul
+        return 0;
+    }
+    if (depth == 0)
+    {
+        return evaluate(e->game, p);
+    }
+
+    tt_entry *entry = &e->table[key & e->mask];
+    bool hit = entry->key == key;
+    if (hit && ply > 0 && entry->depth >= depth)
+    {
+        int score = score_from_table(entry->score, ply);
+        if (entry->bound == BOUND_EXACT
+            || (entry->bound == BOUND_LOWER && score >= beta)
+            || (entry->bound == BOUND_UPPER && score <= alpha))
+        {
+            return score;
+        }
+    }
+
+    turn *list = &e->lists[ply * MAX_TURNS];
+    int nb = generate_turns_pruned(e->game, p, list, MAX_TURNS, SEARCH_SWAPS);
+    if (nb == 0)
+    {
+        //aucun tour possible : la partie est perdue
+        return -(EVAL_WIN - ply);
+    }
+
+    //le meilleur tour de la table est essayé en premier
+    if (hit && entry->from != NO_SQUARE)
+    {
+        for (int i = 1; i < nb; i++) {
+            if (list[i].from == entry->from && list[i].to == entry->to && list[i].swap_to == entry->swap_to)
+            {
+                turn t = list[0];
+                list[0] = list[i];
+                list[i] = t;
+                break;
+            }
+        }
+    }
+
+    int original_alpha = alpha;
+    int best_score = -SEARCH_INF;
+    int best_index = 0;
+    if (ply > 0)
+    {
+        repetition_push(&e->path, key);
+    }
+    for (int i = 0; i < nb; i++) {
+        size moved = apply_turn(e->game, p, &list[i]);
+        int score = -negamax(e, next_player(p), depth - 1, ply + 1, -beta, -alpha, NULL);
+        undo_turn(e->game, &list[i], moved);
+        if (__atomic_load_n(&e->stop, __ATOMIC_RELAXED))
+        {
+            if (ply > 0)
+            {
+                repetition_pop(&e->path);
+            }
+            return 0;
+        }
+
+        if (score > best_score)
+        {
+            best_score = score;
+            best_index = i;
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                break;
+            }
+        }
+    }
+    if (ply > 0)
+    {
+        repetition_pop(&e->path);
+    }
+
+    entry->key = key;
+    entry->score = score_to_table(best_score, ply);
+    entry->depth = depth;
+    entry->bound = best_score <= original_alpha ? BOUND_UPPER : (best_score >= beta ? BOUND_LOWER : BOUND_EXACT);
+    entry->from = list[best_index].from;
+    entry->to = list[best_index].to;
+    entry->swap_to = list[best_index].swap_to;
+    if (best != NULL)
+    {
+        *best = list[best_index];
+    }
+    return best_score;
+}
+
+// Prépare le chemin de la recherche : l'historique de la partie, puis la position de départ
+static void start_path(search_engine *e, uint64_t key) {
+    e->path = e->history;
+    if (e->path.count == 0 || e->path.keys[e->path.count - 1] != key)
+    {
+        repetition_push(&e->path, key);
+    }
+}
+
+// Termine une profondeur de plus sur e->game ; renvoie false si elle a été interrompue (l'état ne change pas)
+static bool deepen_once(search_engine *e, player p) {
+    int depth = e->id.depth + 1;
+    turn best;
+    best.from = NO_SQUARE;
+    int score = negamax(e, p, depth, 0, -SEARCH_INF, SEARCH_INF, &best);
+    if (__atomic_load_n(&e->stop, __ATOMIC_RELAXED) || best.from == NO_SQUARE)
+    {
+        return false;
+    }
+
+    if (e->id.depth > 0 && same_turn(&best, &e->id.best))
+    {
+        e->id.stable++;
+    }
+    else
+    {
+        e->id.stable = 0;
+    }
+    e->id.score_drop = e->id.depth > 0 ? e->id.score - score : 0;
+    e->id.best = best;
+    e->id.score = score;
+    e->id.depth = depth;
+    return true;
+}
+
+// Meilleur tour de la table pour e->game, s'il est jouable (la liste de la profondeur ply sert à le vérifier)
+static bool table_turn(search_engine *e, player p, int ply, turn *out) {
+    uint64_t key = position_key(e->game, p);
+    tt_entry *entry = &e->table[key & e->mask];
+    if (entry->key != key || entry->from == NO_SQUARE)
+    {
+        return false;
+    }
+
+    turn *list = &e->lists[ply * MAX_TURNS];
+    int nb = generate_turns_pruned(e->game, p, list, MAX_TURNS, SEARCH_SWAPS);
+    for (int i = 0; i < nb; i++) {
+        if (list[i].from == entry->from && list[i].to == entry->to && list[i].swap_to == entry->swap_to)
+        {
+            *out = list[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Tour de la base de positions pour e->game, s'il y est et qu'il est jouable
+static bool database_turn(search_engine *e, player p, posdb_entry *entry, turn *out) {
+    if (e->database == NULL || !posdb_probe(e->database, position_key(e->game, p), entry) || entry->from == NO_SQUARE)
+    {
+        return false;
+    }
+
+    //tous les échanges sont gardés : celui de la base peut venir d'une analyse plus large
+    turn *list = e->lists;
+    int nb = generate_turns_pruned(e->game, p, list, MAX_TURNS, 0);
+    for (int i = 0; i < nb; i++) {
+        if (list[i].from == entry->from && list[i].to == entry->to && list[i].swap_to == entry->swap_to)
+        {
+            *out = list[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Variante principale de e->game : le meilleur tour, puis ceux de la table, au plus la profondeur terminée
+static int principal_variation(search_engine *e, player p, turn *pv) {
+    size moved[SEARCH_MAX_DEPTH];
+    int length = 0;
+
+    pv[0] = e->id.best;
+    while (true) {
+        moved[length] = apply_turn(e->game, p, &pv[length]);
+        length++;
+        p = next_player(p);
+        if (length >= e->id.depth || get_winner(e->game) != NO_PLAYER || !table_turn(e, p, length, &pv[length]))
+        {
+            break;
+        }
+    }
+    for (int i = length - 1; i >= 0; i--) {
+        undo_turn(e->game, &pv[i], moved[i]);
+    }
+    return length;
+}
+
+// Remplit le résultat avec l'état de l'approfondissement de e->game
+static void fill_result(search_engine *e, player p, search_result *out) {
+    out->best = e->id.best;
+    out->score = e->id.score;
+    out->depth = e->id.depth;
+    out->nodes = e->id.nodes;
+    out->pv_length = principal_variation(e, p, out->pv);
+}
+
+// Temps visé pour le tour : allongé si le meilleur tour vient de changer ou si le score baisse, raccourci s'il est stable
+static long soft_limit(const deepening *id, long base, long hard) {
+    long soft = base;
+    if (id->stable == 0)
+    {
+        soft = 2 * base;
+    }
+    else if (id->stable >= 3)
+    {
+        soft = base / 2;
+    }
+    if (id->score_drop > SCORE_DROP)
+    {
+        soft += base;
+    }
+    return soft < hard ? soft : hard;
+}
+
+search_engine *search_create(size_t table_bytes) {
+    search_engine *e = calloc(1, sizeof(search_engine));
+    if (e == NULL)
+    {
+        return NULL;
+    }
+
+    size_t nb_entries = MIN_TABLE_ENTRIES;
+    while (nb_entries * 2 * sizeof(tt_entry) <= table_bytes) {
+        nb_entries *= 2;
+    }
+    e->table = calloc(nb_entries, sizeof(tt_entry));
+    e->mask = nb_entries - 1;
+    e->lists = malloc((size_t)(SEARCH_MAX_DEPTH + 1) * MAX_TURNS * sizeof(turn));
+    e->game = new_game();
+    repetition_clear(&e->history, 0);
+    if (e->table == NULL || e->lists == NULL || e->game == NULL)
+    {
+        search_destroy(e);
+        return NULL;
+    }
+    return e;
+}
+
+void search_destroy(search_engine *engine) {
+    if (engine == NULL)
+    {
+        return;
+    }
+    search_ponder_stop(engine);
+    free(engine->table);
+    free(engine->lists);
+    if (engine->game != NULL)
+    {
+        destroy_game(engine->game);
+    }
+    free(engine);
+}
+
+bool search_best_turn(search_engine *engine, board game, player p, const search_limits *limits, search_result *out) {
+    long start = now_ms();
+    search_ponder_stop(engine);
+
+    //la réflexion est reprise si elle portait sur cette position, abandonnée sinon
+    uint64_t key = position_key(game, p);
+    bool hit = engine->id.key == key && engine->id.depth > 0;
+    if (!hit)
+    {
+        engine->id = (deepening){.key = key};
+    }
+    *engine->game = *game;
+    start_path(engine, key);
+
+    posdb_entry entry;
+    if (database_turn(engine, p, &entry, &out->best))
+    {
+        out->score = entry.score;
+        out->depth = entry.depth;
+        out->nodes = 0;
+        out->time_ms = now_ms() - start;
+        out->ponder_hit = false;
+        out->pv[0] = out->best;
+        out->pv_length = 1;
+        return true;
+    }
+
+    int moves_to_go = limits->moves_to_go > 0 ? limits->moves_to_go : SEARCH_MOVES_TO_GO;
+    int max_depth = limits->max_depth > 0 && limits->max_depth < SEARCH_MAX_DEPTH ? limits->max_depth : SEARCH_MAX_DEPTH;
+    long base = limits->time_ms / moves_to_go;
+    long hard = limits->time_ms / 4;
+    if (hard > 5 * base)
+    {
+        hard = 5 * base;
+    }
+
+    engine->stop = false;
+    while (engine->id.depth < max_depth && !(engine->id.depth > 0 && is_forced(engine->id.score))) {
+        //la profondeur suivante coûte plus que toutes les précédentes : inutile de la commencer trop tard
+        if (engine->id.depth > 0 && now_ms() - start >= soft_limit(&engine->id, base, hard) / 2)
+        {
+            break;
+        }
+        //la première profondeur est toujours terminée, pour avoir un tour
+        engine->deadline = engine->id.depth > 0 ? start + hard : 0;
+        if (!deepen_once(engine, p))
+        {
+            break;
+        }
+    }
+
+    if (engine->id.depth == 0)
+    {
+        return false;
+    }
+    fill_result(engine, p, out);
+    out->time_ms = now_ms() - start;
+    out->ponder_hit = hit;
+    return true;
+}
+
+bool search_iterate(search_engine *engine, board game, player p, int max_depth, long time_ms, search_progress progress, void *data) {
+    long start = now_ms();
+    search_result result;
+
+    if (max_depth <= 0 || max_depth > SEARCH_MAX_DEPTH)
+    {
+        max_depth = SEARCH_MAX_DEPTH;
+    }
+    engine->id = (deepening){.key = position_key(game, p)};
+    engine->deadline = time_ms > 0 ? start + time_ms : 0;
+    *engine->game = *game;
+    start_path(engine, engine->id.key);
+
+    while (engine->id.depth < max_depth && !(engine->id.depth > 0 && is_forced(engine->id.score))) {
+        if (!deepen_once(engine, p))
+        {
+            break;
+        }
+        if (progress != NULL)
+        {
+            fill_result(engine, p, &result);
+            result.time_ms = now_ms() - start;
+            result.ponder_hit = false;
+            progress(&result, data);
+        }
+    }
+    return engine->id.depth > 0;
+}
+
+void search_stop(search_engine *engine) {
+    __atomic_store_n(&engine->stop, true, __ATOMIC_RELAXED);
+}
+
+// Réponse la plus probable du joueur sur e->game : celle de la table si elle est jouable, sinon une recherche courte
+static bool predict_reply(search_engine *e, player p, turn *reply) {
+    if (table_turn(e, p, 0, reply))
+    {
+        return true;
+    }
+
+    reply->from = NO_SQUARE;
+    negamax(e, p, PREDICT_DEPTH, 0, -SEARCH_INF, SEARCH_INF, reply);
+    return !__atomic_load_n(&e->stop, __ATOMIC_RELAXED) && reply->from != NO_SQUARE;
+}
+
+// Thread de réflexion : prédit la réponse de l'adversaire, puis approfondit la position qui la suit
+static void *ponder_main(void *arg) {
+    search_engine *e = arg;
+    player p = e->ponder_player;
+    player opponent = next_player(p);
+    turn reply;
+
+    if (!predict_reply(e, opponent, &reply))
+    {
+        return NULL;
+    }
+    apply_turn(e->game, opponent, &reply);
+    if (get_winner(e->game) != NO_PLAYER)
+    {
+        return NULL;
+    }
+
+    e->id = (deepening){.key = position_key(e->game, p)};
+    repetition_push(&e->path, e->id.key);
+    while (e->id.depth < SEARCH_MAX_DEPTH && !(e->id.depth > 0 && is_forced(e->id.score))) {
+        if (!deepen_once(e, p))
+        {
+            break;
+        }
+    }
+    return NULL;
+}
+
+bool search_ponder_start(search_engine *engine, board game, player p) {
+    search_ponder_stop(engine);
+    if (get_winner(game) != NO_PLAYER)
+    {
+        return false;
+    }
+
+    //la prédiction de la réponse se fait dans le thread : l'appelant n'attend pas
+    *engine->game = *game;
+    start_path(engine, position_key(game, next_player(p)));
+    engine->id = (deepening){.key = 0};
+    engine->ponder_player = p;
+    engine->stop = false;
+    engine->deadline = 0;
+    if (pthread_create(&engine->thread, NULL, ponder_main, engine) != 0)
+    {
+        return false;
+    }
+    engine->pondering = true;
+    return true;
+}
+
+void search_ponder_stop(search_engine *engine) {
+    if (!engine->pondering)
+    {
+        return;
+    }
+    __atomic_store_n(&engine->stop, true, __ATOMIC_RELAXED);
+    pthread_join(engine->thread, NULL);
+    engine->pondering = false;
+}
+
+void search_set_history(search_engine *engine, const repetition_history *history) {
+    search_ponder_stop(engine);
+    if (history == NULL)
+    {
+        repetition_clear(&engine->history, 0);
+        return;
+    }
+    //le chemin de la recherche doit tenir derrière l'historique sans en faire oublier le début
+    repetition_clear(&engine->history, history->draw_count);
+    int first = history->count - (REPETITION_MAX - SEARCH_MAX_DEPTH - 2);
+    for (int i = first > 0 ? first : 0; i < history->count; i++) {
+        repetition_push(&engine->history, history->keys[i]);
+    }
+}
+
+void search_set_database(search_engine *engine, const posdb *db) {
+    search_ponder_stop(engine);
+    engine->database = db;
+}
+
+bool search_placement(board game, player p, size *piece, int *column) {
+    int line = (p == SOUTH_P) ? 0 : DIMENSION - 1;
+    board scratch = new_game();
+    bool found = false;
+    int best_score = 0;
+
+    if (scratch == NULL)
+    {
+        return false;
+    }
+
+    for (int s = ONE; s <= THREE; s++) {
+        if (nb_pieces_available(game, s, p) <= 0)
+        {
+            continue;
+        }
+        for (int c = 0; c < DIMENSION; c++) {
+            if (game->grid[line][c] != NONE)
+            {
+                continue;
+            }
+
+            *scratch = *game;
+            place_piece(scratch, s, p, c);
+            int score = evaluate(scratch, p);
+            if (!found || score > best_score)
+            {
+                found = true;
+                best_score = score;
+                *piece = s;
+                *column = c;
+            }
+        }
+    }
+    destroy_game(scratch);
+    return found;
+}
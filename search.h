@@ -0,0 +1,191 @@
+#ifndef _SEARCH_H_
+#define _SEARCH_H_
+
+#include <stddef.h>
+#include "board.h"
+#include "turn.h"
+#include "repetition.h"
+#include "posdb.h"
+
+/**
+ * \file search.h
+ *
+ * \brief Joueur artificiel : recherche alpha-bêta par approfondissement itératif.
+ *
+ * La recherche est un negamax alpha-bêta sur les tours complets (turn.h), avec une table
+ * de transposition ; les échanges sont limités aux meilleures cases de ::rank_swap_targets.
+ * Les profondeurs sont explorées l'une après l'autre, et le temps accordé à un tour
+ * dépend du temps restant et de la stabilité du résultat : il est allongé quand le meilleur
+ * tour change ou que le score baisse, et raccourci quand ils restent stables.
+ *
+ * Pendant le tour de l'adversaire, un thread réfléchit à la position qui suivrait
+ * sa réponse la plus probable (::search_ponder_start). Si l'adversaire joue cette réponse,
+ * ::search_best_turn reprend la réflexion où elle en était ; sinon elle est abandonnée.
+ *
+ * Une base de positions analysées (posdb.h) peut être donnée au moteur (::search_set_database) :
+ * une position qui s'y trouve est jouée sans recherche.
+ *
+ * Une position déjà atteinte, dans la partie (::search_set_history) ou plus haut dans la recherche,
+ * vaut une partie nulle : la recherche ne s'enfonce pas dans les cycles.
+ *
+ * Le moteur lit la structure du plateau (board_s.h) : il demande l'implémentation board.c.
+ * \code
+ * gcc -O2 -pthread BoardGame_GAI_Victorien_GIA_Wendy.c board.c eval.c board_tables.c turn.c walks_table.c search.c analysis.c repetition.c posdb.c -o jeu
+ * \endcode
+ */
+
+/**
+ * @brief nombre de tours qu'il reste à jouer par défaut, pour répartir le temps.
+ */
+#define SEARCH_MOVES_TO_GO 30
+
+/**
+ * @brief profondeur maximale de la recherche.
+ */
+#define SEARCH_MAX_DEPTH 32
+
+/**
+ * @brief cases d'échange gardées par pièce rencontrée (voir ::generate_turns_pruned).
+ */
+#define SEARCH_SWAPS 4
+
+/**
+ * @brief Limites d'une recherche.
+ */
+typedef struct {
+	long time_ms; /**< temps restant au joueur pour la partie, en millisecondes */
+	int moves_to_go; /**< tours qu'il lui reste à jouer (estimation), 0 pour ::SEARCH_MOVES_TO_GO */
+	int max_depth; /**< profondeur maximale, 0 pour ::SEARCH_MAX_DEPTH */
+} search_limits;
+
+/**
+ * @brief Résultat d'une recherche.
+ */
+typedef struct {
+	turn best; /**< tour choisi */
+	int score; /**< score du tour pour le joueur, ±::EVAL_WIN moins la distance pour un gain ou une perte forcés */
+	int depth; /**< dernière profondeur terminée */
+	long nodes; /**< nœuds visités, réflexion pendant le tour adverse comprise */
+	long time_ms; /**< temps passé pendant le tour du joueur */
+	bool ponder_hit; /**< la réflexion faite pendant le tour adverse a été reprise */
+	int pv_length; /**< longueur de la variante principale */
+	turn pv[SEARCH_MAX_DEPTH]; /**< variante principale : best, puis les meilleures réponses lues dans la table */
+} search_result;
+
+/**
+ * @brief Fonction appelée à chaque profondeur terminée par ::search_iterate.
+ * @param result le résultat de cette profondeur.
+ * @param data le pointeur donné à ::search_iterate.
+ */
+typedef void (*search_progress)(const search_result *result, void *data);
+
+/**
+ * @brief Un moteur de recherche : table de transposition, état de l'approfondissement et thread de réflexion.
+ */
+typedef struct search_engine search_engine;
+
+/**
+ * @brief Crée un moteur.
+ * @param table_bytes taille de la table de transposition, en octets.
+ * @return le moteur, NULL si la mémoire manque.
+ */
+search_engine *search_create(size_t table_bytes);
+
+/**
+ * @brief Arrête la réflexion en cours et libère le moteur.
+ */
+void search_destroy(search_engine *engine);
+
+/**
+ * @brief Cherche le meilleur tour du joueur.
+ *
+ * Une réflexion en cours est d'abord arrêtée ; si elle portait sur cette position,
+ * la recherche repart de la profondeur qu'elle avait atteinte.
+ *
+ * @param engine le moteur.
+ * @param game le plateau, entre deux tours ; il n'est pas modifié.
+ * @param p le joueur qui a le trait.
+ * @param limits les limites de temps et de profondeur.
+ * @param out reçoit le résultat.
+ * @return false si le joueur n'a aucun tour.
+ */
+bool search_best_turn(search_engine *engine, board game, player p, const search_limits *limits, search_result *out);
+
+/**
+ * @brief Approfondit une position sans répartition du temps, en rendant compte de chaque profondeur.
+ *
+ * La recherche s'arrête à max_depth, sur un gain ou une perte forcés, à l'heure limite,
+ * ou dès que ::search_stop est appelée (depuis un autre thread). Une demande d'arrêt faite
+ * avant l'appel est respectée : le moteur doit être réservé à cet usage.
+ *
+ * @param engine le moteur.
+ * @param game le plateau, entre deux tours ; il n'est pas modifié.
+ * @param p le joueur qui a le trait.
+ * @param max_depth profondeur maximale, 0 pour ::SEARCH_MAX_DEPTH.
+ * @param time_ms durée maximale en millisecondes, 0 sans limite.
+ * @param progress appelée depuis le thread de la recherche après chaque profondeur terminée, ou NULL.
+ * @param data passé à progress.
+ * @return false si aucune profondeur n'a été terminée.
+ */
+bool search_iterate(search_engine *engine, board game, player p, int max_depth, long time_ms, search_progress progress, void *data);
+
+/**
+ * @brief Demande l'arrêt de ::search_iterate ; peut être appelée depuis n'importe quel thread.
+ *
+ * Le drapeau est lu à chaque nœud : la recherche rend la main en bien moins d'une milliseconde.
+ */
+void search_stop(search_engine *engine);
+
+/**
+ * @brief Commence à réfléchir pendant le tour de l'adversaire.
+ *
+ * La fonction rend la main tout de suite : un thread prend la réponse la plus probable
+ * de l'adversaire dans la table (ou la donne par une recherche courte), puis cherche
+ * le meilleur tour du joueur dans la position qui la suit, jusqu'à ::search_best_turn
+ * ou ::search_ponder_stop. Si l'adversaire n'a aucun tour, le thread s'arrête sans rien chercher.
+ *
+ * @param engine le moteur.
+ * @param game le plateau après le tour du joueur ; il est recopié.
+ * @param p le joueur (l'adversaire a le trait).
+ * @return false si la partie est finie ou si le thread n'a pas pu être créé.
+ */
+bool search_ponder_start(search_engine *engine, board game, player p);
+
+/**
+ * @brief Arrête la réflexion en cours, s'il y en a une, sans perdre son travail.
+ */
+void search_ponder_stop(search_engine *engine);
+
+/**
+ * @brief Donne au moteur les positions déjà atteintes dans la partie.
+ *
+ * Les recherches suivantes comptent comme nulle toute position de cet historique
+ * (seules les plus récentes sont gardées). Une réflexion en cours est arrêtée sans perdre son travail.
+ *
+ * @param engine le moteur.
+ * @param history l'historique de la partie, recopié ; NULL pour l'oublier.
+ */
+void search_set_history(search_engine *engine, const repetition_history *history);
+
+/**
+ * @brief Donne au moteur une base de positions, consultée par ::search_best_turn avant de chercher.
+ *
+ * Si la position y est et que son meilleur tour est jouable, ce tour est rendu sans recherche,
+ * avec le score et la profondeur de la base.
+ *
+ * @param engine le moteur.
+ * @param db la base, ouverte par ::posdb_open et gardée ouverte tant que le moteur s'en sert ; NULL pour ne plus la consulter.
+ */
+void search_set_database(search_engine *engine, const posdb *db);
+
+/**
+ * @brief Choisit un placement pour la phase de placement : celui qui laisse la meilleure évaluation.
+ * @param game le plateau.
+ * @param p le joueur qui place.
+ * @param piece reçoit la taille de la pièce.
+ * @param column reçoit la colonne.
+ * @return false s'il n'y a plus rien à placer ou si la mémoire manque.
+ */
+bool search_placement(board game, player p, size *piece, int *column);
+
+#endif /*_SEARCH_H_*/
@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "board_s.h"
+#include "turn.h"
+#include "rank.h"
+#include "repetition.h"
+#include "selfplay.h"
+
+// Génération de parties jouées par le moteur contre lui-même (voir selfplay.h pour le format)
+// Compilation : gcc -O2 -pthread selfplay.c board.c eval.c board_tables.c turn.c walks_table.c rank.c repetition.c -o selfplay
+// Usage : ./selfplay [-t threads] [-g parties] [-s bruit_placement] [-p bruit_jeu] [-r graine] [-o prefixe]
+//
+// Chaque thread a son plateau, son générateur aléatoire et son fichier de sortie :
+// aucune donnée n'est partagée entre threads, sauf le compteur des parties à jouer.
+//
+// Les joueurs sont gloutons : ils jouent un tour gagnant s'il y en a un, sinon le tour
+// qui laisse la meilleure évaluation sans gain immédiat pour l'adversaire.
+// Le bruit est la probabilité de jouer à la place un coup (ou un placement) au hasard.
+
+// Au-delà, la partie est arrêtée sans vainqueur
+#define MAX_PLIES 400
+
+// Une position atteinte ce nombre de fois rend la partie nulle (sans vainqueur)
+#define DRAW_REPETITIONS REPETITION_DRAW
+
+// Taille du tampon d'écriture de chaque thread
+#define WRITE_BUFFER (1 << 20)
+
+typedef struct {
+    long nb_games;
+    double setup_noise;
+    double play_noise;
+    uint64_t seed;
+    const char *prefix;
+    long next_game;   // prochaine partie à jouer (atomique)
+    long nb_records;  // enregistrements écrits (atomique)
+} selfplay_config;
+
+typedef struct {
+    selfplay_config *config;
+    int id;
+    uint64_t rng;
+    board scratch;
+    turn *list;
+    selfplay_record *records;
+    repetition_history history;
+    FILE *out;
+} worker_state;
+
+// Générateur xorshift64*, un par thread
+static uint64_t next_random(worker_state *w) {
+    w->rng ^= w->rng >> 12;
+    w->rng ^= w->rng << 25;
+    w->rng ^= w->rng >> 27;
+    return w->rng * 0x2545f4914f6cdd1dULL;
+}
+
+static double random_unit(worker_state *w) {
+    return (next_random(w) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static int random_below(worker_state *w, int n) {
+    return (int)(next_random(w) % (uint64_t)n);
+}
+
+// Choisit un placement (taille et colonne) pour le joueur p, au hasard ou selon l'évaluation
+static void choose_placement(worker_state *w, board game, player p, size *piece, int *column) {
+    int line = (p == SOUTH_P) ? 0 : DIMENSION - 1;
+    bool random_choice = random_unit(w) < w->config->setup_noise;
+    int best_score = 0;
+    int nb_choices = 0;
+
+    for (int s = ONE; s <= THREE; s++) {
+        if (nb_pieces_available(game, s, p) <= 0)
+        {
+            continue;
+        }
+        for (int c = 0; c < DIMENSION; c++) {
+            if (game->grid[line][c] != NONE)
+            {
+                continue;
+            }
+
+            int score = 0;
+            if (!random_choice)
+            {
+                *w->scratch = *game;
+                place_piece(w->scratch, s, p, c);
+                score = evaluate(w->scratch, p);
+            }
+
+            //tirage uniforme parmi les meilleurs choix (tous au hasard : parmi tous)
+            if (nb_choices == 0 || score > best_score)
+            {
+                best_score = score;
+                nb_choices = 0;
+            }
+            if (score == best_score && random_below(w, ++nb_choices) == 0)
+            {
+                *piece = s;
+                *column = c;
+            }
+        }
+    }
+}
+
+// Choisit un tour parmi les nb tours de la liste ; renvoie son indice
+static int choose_turn(worker_state *w, board game, player p, int nb) {
+    if (random_unit(w) < w->config->play_noise)
+    {
+        return random_below(w, nb);
+    }
+
+    player opponent = next_player(p);
+    int best = 0;
+    int best_score = 0;
+    int nb_choices = 0;
+    for (int i = 0; i < nb; i++) {
+        if (w->list[i].to == NO_SQUARE)
+        {
+            return i;
+        }
+
+        size moved = apply_turn(game, p, &w->list[i]);
+        int score = find_winning_turn(game, opponent, NULL) ? -EVAL_WIN : -evaluate(game, opponent);
+        undo_turn(game, &w->list[i], moved);
+
+        if (nb_choices == 0 || score > best_score)
+        {
+            best_score = score;
+            nb_choices = 0;
+        }
+        if (score == best_score && random_below(w, ++nb_choices) == 0)
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Joue une partie complète et écrit ses enregistrements
+static void play_game(worker_state *w, long game_number) {
+    board game = new_game();
+    player p = random_below(w, 2) ? NORTH_P : SOUTH_P;
+
+    if (game == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        exit(1);
+    }
+
+    //placement : les joueurs posent leurs pièces chacun leur tour
+    for (int i = 0; i < NB_PIECES; i++) {
+        size piece = NONE;
+        int column = 0;
+        choose_placement(w, game, p, &piece, &column);
+        place_piece(game, piece, p, column);
+        p = next_player(p);
+    }
+
+    //le joueur qui a posé en second commence la partie (comme dans l'interface)
+    p = next_player(p);
+    int nb_records = 0;
+    player winner = NO_PLAYER;
+    repetition_clear(&w->history, DRAW_REPETITIONS);
+    repetition_push(&w->history, position_key(game, p));
+    while (nb_records < MAX_PLIES) {
+        int nb = generate_turns(game, p, w->list, MAX_TURNS);
+        if (nb == 0)
+        {
+            //aucun tour possible : la partie est perdue
+            winner = next_player(p);
+            break;
+        }
+
+        int chosen = choose_turn(w, game, p, nb);
+        selfplay_record *r = &w->records[nb_records];
+        memset(r, 0, sizeof(*r));
+        r->position = rank_position(game, p);
+        r->from = w->list[chosen].from;
+        r->to = w->list[chosen].to;
+        r->swap_to = w->list[chosen].swap_to;
+        r->ply = nb_records;
+        r->game = (uint16_t)game_number;
+        nb_records++;
+
+        if (play_turn(game, p, &w->list[chosen]) != OK)
+        {
+            //le tour n'a pas été joué : son enregistrement n'est pas écrit
+            nb_records--;
+            break;
+        }
+        if (get_winner(game) != NO_PLAYER)
+        {
+            winner = get_winner(game);
+            break;
+        }
+        p = next_player(p);
+        repetition_push(&w->history, position_key(game, p));
+        if (repetition_is_draw(&w->history))
+        {
+            break;
+        }
+    }
+
+    for (int i = 0; i < nb_records; i++) {
+        w->records[i].winner = winner;
+    }
+    fwrite(w->records, sizeof(selfplay_record), nb_records, w->out);
+    __atomic_fetch_add(&w->config->nb_records, nb_records, __ATOMIC_RELAXED);
+    destroy_game(game);
+}
+
+static void *worker(void *arg) {
+    worker_state *w = arg;
+    long played = 0;
+
+    while (true) {
+        long n = __atomic_fetch_add(&w->config->next_game, 1, __ATOMIC_RELAXED);
+        if (n >= w->config->nb_games)
+        {
+            break;
+        }
+        play_game(w, played++);
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[]) {
+    selfplay_config config = { 100, 0.1, 0.05, 1, "selfplay", 0, 0 };
+    int nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-t") == 0) nb_threads = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-g") == 0) config.nb_games = atol(argv[i + 1]);
+        else if (strcmp(argv[i], "-s") == 0) config.setup_noise = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "-p") == 0) config.play_noise = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "-r") == 0) config.seed = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "-o") == 0) config.prefix = argv[i + 1];
+    }
+    if (nb_threads < 1 || argc % 2 == 0)
+    {
+        fprintf(stderr, "usage : %s [-t threads] [-g parties] [-s bruit_placement] [-p bruit_jeu] [-r graine] [-o prefixe]\n", argv[0]);
+        return 1;
+    }
+
+    worker_state *workers = calloc(nb_threads, sizeof(worker_state));
+    pthread_t *threads = malloc(nb_threads * sizeof(pthread_t));
+    if (workers == NULL || threads == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+    for (int i = 0; i < nb_threads; i++) {
+        char path[4096];
+        worker_state *w = &workers[i];
+
+        snprintf(path, sizeof(path), "%s.%d.bin", config.prefix, i);
+        w->config = &config;
+        w->id = i;
+        //graines distinctes par thread, jamais nulles pour xorshift
+        w->rng = (config.seed + 1) * 0x9e3779b97f4a7c15ULL ^ ((uint64_t)(i + 1) << 32);
+        if (w->rng == 0)
+        {
+            w->rng = 1;
+        }
+        w->scratch = new_game();
+        w->list = malloc(MAX_TURNS * sizeof(turn));
+        w->records = malloc(MAX_PLIES * sizeof(selfplay_record));
+        w->out = fopen(path, "wb");
+        if (w->out == NULL || w->scratch == NULL || w->list == NULL || w->records == NULL)
+        {
+            fprintf(stderr, "impossible de préparer %s\n", path);
+            return 1;
+        }
+        setvbuf(w->out, NULL, _IOFBF, WRITE_BUFFER);
+    }
+
+    int status = 0;
+    int nb_started = 0;
+    while (nb_started < nb_threads && pthread_create(&threads[nb_started], NULL, worker, &workers[nb_started]) == 0) {
+        nb_started++;
+    }
+    if (nb_started < nb_threads)
+    {
+        //les threads lancés s'arrêtent après leur partie en cours
+        fprintf(stderr, "impossible de lancer %d threads\n", nb_threads);
+        __atomic_store_n(&config.next_game, config.nb_games, __ATOMIC_RELAXED);
+        status = 1;
+    }
+    for (int i = 0; i < nb_started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (int i = 0; i < nb_threads; i++) {
+        fclose(workers[i].out);
+        destroy_game(workers[i].scratch);
+        free(workers[i].list);
+        free(workers[i].records);
+    }
+    free(threads);
+    free(workers);
+
+    if (status == 0)
+    {
+        fprintf(stderr, "%ld parties, %ld tours enregistrés\n", config.nb_games, config.nb_records);
+    }
+    return status;
+}
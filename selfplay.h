@@ -0,0 +1,31 @@
+#ifndef _SELFPLAY_H_
+#define _SELFPLAY_H_
+
+#include <stdint.h>
+#include "board.h"
+
+/**
+ * \file selfplay.h
+ *
+ * \brief Format des données d'entraînement produites par selfplay.c.
+ *
+ * Chaque thread de selfplay écrit son propre fichier (prefixe.N.bin),
+ * suite de ::selfplay_record dans l'ordre des parties.
+ * Un enregistrement est écrit pour chaque tour de la phase de jeu
+ * (la phase de placement n'en produit pas).
+ */
+
+/**
+ * @brief Un tour joué pendant une partie (16 octets).
+ */
+typedef struct {
+	uint64_t position; /**< numéro de la position avant le tour, avec le joueur qui a le trait (rank.h) */
+	signed char from; /**< tour choisi : case de départ (voir ::turn) */
+	signed char to; /**< tour choisi : case d'arrivée, ::NO_SQUARE pour le but */
+	signed char swap_to; /**< tour choisi : case de l'échange, ::NO_SQUARE sans échange */
+	unsigned char winner; /**< ::player gagnant à la fin de la partie, ::NO_PLAYER si elle est nulle (répétition) ou a été arrêtée */
+	uint16_t ply; /**< numéro du tour dans la phase de jeu, à partir de 0 */
+	uint16_t game; /**< numéro de la partie dans le fichier, modulo 65536 */
+} selfplay_record;
+
+#endif /*_SELFPLAY_H_*/
@@ -0,0 +1,838 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "board.h"
+#include "turn.h"
+#include "journal.h"
+
+// Serveur de parties : de nombreux plateaux dans un seul processus, servis sur une socket UNIX
+// gcc -O2 -pthread server.c journal.c board.c eval.c board_tables.c turn.c walks_table.c -o server
+// Usage : ./server [-t threads] [-g parties] [-j journal] socket    (serveur)
+//         ./server -c socket < script                 (client : une requête par ligne, affiche les réponses)
+//
+// Une boucle epoll lit les requêtes (une par ligne) sur des sockets non bloquantes et les
+// confie aux workers ; chaque connexion n'a qu'une requête en cours, les réponses arrivent
+// donc dans l'ordre. Chaque plateau a son verrou : les requêtes de plusieurs clients
+// sur une même partie sont traitées l'une après l'autre.
+//
+// Avec -j, chaque partie est tenue dans un journal (journal.h) : au démarrage, les parties
+// du journal sont reprises avec leurs numéros, dans l'état où le serveur précédent les a laissées.
+//
+// Requêtes (P vaut S ou N, les lignes et colonnes commencent à 0, les cases sont ligne * DIMENSION + colonne) :
+//   NEW                          -> OK id
+//   FREE id                      -> OK
+//   PLACE id P taille colonne    -> OK | ERR code            (place_piece)
+//   PICK id P ligne colonne      -> OK | ERR code            (pick_piece)
+//   MOVE id N|S|E|W|G            -> OK | ERR code            (move_piece)
+//   SWAP id ligne colonne        -> OK | ERR code            (swap_piece)
+//   UNDO id / CANCEL id          -> OK | ERR code            (cancel_step, cancel_movement)
+//   TURNS id P                   -> OK n depart:arrivee:echange ...  (generate_turns, -1 pour le but ou sans échange)
+//   PLAY id P depart arrivee echange -> OK | ERR code       (un tour de TURNS, joué par play_turn)
+//   SHOW id                      -> OK grille gagnant        (les tailles des cases, puis 0, 1 (SUD) ou 2 (NORD))
+
+// Longueur maximale d'une requête
+#define MAX_LINE 256
+
+// Au-delà de cette quantité de réponses non lues, les requêtes suivantes attendent
+#define OUT_LIMIT 65536
+
+// Événements traités par appel à epoll_wait
+#define MAX_EVENTS 64
+
+// Une zone de texte qui grandit à la demande
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} buffer;
+
+// Une connexion, manipulée uniquement par la boucle d'événements
+typedef struct connection_s {
+    int fd;
+    char in[MAX_LINE + 1];
+    size_t in_len;
+    buffer out;
+    size_t out_pos;      // début de la partie de out pas encore envoyée
+    uint32_t events;     // événements demandés à epoll
+    bool discarding;     // la fin d'une ligne trop longue est jetée jusqu'au prochain saut de ligne
+    bool busy;           // une requête est chez les workers
+    bool closed;         // le client est parti : libérer au retour de la requête en cours
+    struct connection_s *next_closed;
+} connection;
+
+// Une requête, de la boucle aux workers puis retour
+typedef struct job_s {
+    connection *conn;
+    char line[MAX_LINE + 1];
+    buffer reply;
+    struct job_s *next;
+} job;
+
+// Une partie
+typedef struct {
+    board game;
+    pthread_mutex_t lock;
+    int next_free;       // partie libre suivante, -1 après la dernière
+} game_slot;
+
+typedef struct {
+    game_slot *games;
+    int max_games;
+    int free_head;
+    pthread_mutex_t games_lock;   // liste des parties libres (NEW le prend avant le verrou d'une partie, FREE après l'avoir rendu)
+
+    //requêtes en attente d'un worker
+    pthread_mutex_t queue_lock;
+    pthread_cond_t queue_cond;
+    job *queue_head;
+    job *queue_tail;
+    bool stopping;
+
+    //requêtes traitées, rendues à la boucle par done_fd
+    pthread_mutex_t done_lock;
+    job *done;
+    int done_fd;
+
+    journal journal;      // NULL sans -j
+
+    turn *lists;          // MAX_TURNS tours par worker
+    int nb_started;       // workers qui ont pris leur liste (atomique)
+
+    int epoll_fd;
+    connection *closed;   // connexions fermées, libérées à la fin du lot d'événements
+} server;
+
+static const char *code_names[] = {"OK", "EMPTY", "FORBIDDEN", "PARAM"};
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_signal(int sig) {
+    (void)sig;
+    interrupted = 1;
+}
+
+static bool buffer_reserve(buffer *b, size_t extra) {
+    if (b->len + extra <= b->cap)
+    {
+        return true;
+    }
+    size_t cap = b->cap == 0 ? 256 : b->cap;
+    while (cap < b->len + extra) {
+        cap *= 2;
+    }
+    char *data = realloc(b->data, cap);
+    if (data == NULL)
+    {
+        return false;
+    }
+    b->data = data;
+    b->cap = cap;
+    return true;
+}
+
+static void buffer_printf(buffer *b, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (n < 0 || !buffer_reserve(b, n + 1))
+    {
+        return;
+    }
+    va_start(args, format);
+    vsnprintf(b->data + b->len, n + 1, format, args);
+    va_end(args);
+    b->len += n;
+}
+
+static bool parse_player(const char *s, player *p) {
+    if (strcmp(s, "S") == 0)
+    {
+        *p = SOUTH_P;
+        return true;
+    }
+    if (strcmp(s, "N") == 0)
+    {
+        *p = NORTH_P;
+        return true;
+    }
+    return false;
+}
+
+static bool parse_direction(const char *s, direction *d) {
+    static const char names[] = "GSNEW";
+    if (strlen(s) != 1 || strchr(names, s[0]) == NULL)
+    {
+        return false;
+    }
+    *d = (direction)(strchr(names, s[0]) - names);
+    return true;
+}
+
+static void reply_code(buffer *reply, return_code rc) {
+    if (rc == OK)
+    {
+        buffer_printf(reply, "OK\n");
+    }
+    else
+    {
+        buffer_printf(reply, "ERR %s\n", code_names[rc]);
+    }
+}
+
+// Requêtes sur une partie existante, verrou de la partie pris
+static void execute_on_game(server *s, int id, board game, const char *cmd, int nb_args, char args[][16], turn *list, buffer *reply) {
+    player p;
+    direction d;
+
+    if (strcmp(cmd, "PLACE") == 0 && nb_args == 3 && parse_player(args[0], &p))
+    {
+        reply_code(reply, journal_place_piece(s->journal, id, game, (size)atoi(args[1]), p, atoi(args[2])));
+    }
+    else if (strcmp(cmd, "PICK") == 0 && nb_args == 3 && parse_player(args[0], &p))
+    {
+        reply_code(reply, journal_pick_piece(s->journal, id, game, p, atoi(args[1]), atoi(args[2])));
+    }
+    else if (strcmp(cmd, "MOVE") == 0 && nb_args == 1 && parse_direction(args[0], &d))
+    {
+        reply_code(reply, journal_move_piece(s->journal, id, game, d));
+    }
+    else if (strcmp(cmd, "SWAP") == 0 && nb_args == 2)
+    {
+        reply_code(reply, journal_swap_piece(s->journal, id, game, atoi(args[0]), atoi(args[1])));
+    }
+    else if (strcmp(cmd, "UNDO") == 0 && nb_args == 0)
+    {
+        reply_code(reply, journal_cancel_step(s->journal, id, game));
+    }
+    else if (strcmp(cmd, "CANCEL") == 0 && nb_args == 0)
+    {
+        reply_code(reply, journal_cancel_movement(s->journal, id, game));
+    }
+    else if (strcmp(cmd, "TURNS") == 0 && nb_args == 1 && parse_player(args[0], &p))
+    {
+        //les tours ne se calculent qu'entre deux tours
+        if (picked_piece_owner(game) != NO_PLAYER || get_winner(game) != NO_PLAYER)
+        {
+            reply_code(reply, FORBIDDEN);
+            return;
+        }
+        int nb = generate_turns(game, p, list, MAX_TURNS);
+        buffer_printf(reply, "OK %d", nb);
+        for (int i = 0; i < nb; i++) {
+            buffer_printf(reply, " %d:%d:%d", list[i].from, list[i].to, list[i].swap_to);
+        }
+        buffer_printf(reply, "\n");
+    }
+    else if (strcmp(cmd, "PLAY") == 0 && nb_args == 4 && parse_player(args[0], &p))
+    {
+        if (picked_piece_owner(game) != NO_PLAYER || get_winner(game) != NO_PLAYER)
+        {
+            reply_code(reply, FORBIDDEN);
+            return;
+        }
+        int from = atoi(args[1]);
+        int to = atoi(args[2]);
+        int swap_to = atoi(args[3]);
+        int nb = generate_turns(game, p, list, MAX_TURNS);
+        for (int i = 0; i < nb; i++) {
+            if (list[i].from == from && list[i].to == to && list[i].swap_to == swap_to)
+            {
+                return_code rc = play_turn(game, p, &list[i]);
+                //le tour passe par plusieurs fonctions de board.h : un instantané le résume
+                journal_snapshot(s->journal, id, game);
+                reply_code(reply, rc);
+                return;
+            }
+        }
+        reply_code(reply, FORBIDDEN);
+    }
+    else if (strcmp(cmd, "SHOW") == 0 && nb_args == 0)
+    {
+        buffer_printf(reply, "OK ");
+        for (int line = 0; line < DIMENSION; line++) {
+            for (int column = 0; column < DIMENSION; column++) {
+                buffer_printf(reply, "%d", get_piece_size(game, line, column));
+            }
+        }
+        buffer_printf(reply, " %d\n", get_winner(game));
+    }
+    else
+    {
+        buffer_printf(reply, "ERR requête invalide\n");
+    }
+}
+
+// Exécute une requête et écrit sa réponse (une ligne)
+static void execute(server *s, const char *line, turn *list, buffer *reply) {
+    char cmd[16];
+    char args[5][16];
+    int id;
+    int n = sscanf(line, "%15s %d %15s %15s %15s %15s %15s", cmd, &id, args[0], args[1], args[2], args[3], args[4]);
+    if (n < 1)
+    {
+        buffer_printf(reply, "ERR requête vide\n");
+        return;
+    }
+
+    if (strcmp(cmd, "NEW") == 0)
+    {
+        pthread_mutex_lock(&s->games_lock);
+        id = s->free_head;
+        board game = id >= 0 ? new_game() : NULL;
+        if (game != NULL)
+        {
+            //la partie est libre : son verrou n'est tenu qu'un instant par une requête qui la trouve vide
+            pthread_mutex_lock(&s->games[id].lock);
+            s->games[id].game = game;
+            journal_attach(s->journal, id, game);
+            pthread_mutex_unlock(&s->games[id].lock);
+            s->free_head = s->games[id].next_free;
+            s->games[id].next_free = -1;
+        }
+        pthread_mutex_unlock(&s->games_lock);
+        if (id < 0)
+        {
+            buffer_printf(reply, "ERR plus de partie libre\n");
+        }
+        else if (game == NULL)
+        {
+            //la partie reste dans la liste des parties libres
+            buffer_printf(reply, "ERR mémoire insuffisante\n");
+        }
+        else
+        {
+            buffer_printf(reply, "OK %d\n", id);
+        }
+        return;
+    }
+
+    if (n < 2 || id < 0 || id >= s->max_games)
+    {
+        buffer_printf(reply, "ERR numéro de partie invalide\n");
+        return;
+    }
+
+    //seul le verrou de la partie est pris : une partie occupée ne bloque pas les autres requêtes
+    game_slot *slot = &s->games[id];
+    pthread_mutex_lock(&slot->lock);
+    if (slot->game == NULL)
+    {
+        pthread_mutex_unlock(&slot->lock);
+        buffer_printf(reply, "ERR partie inconnue\n");
+        return;
+    }
+    if (strcmp(cmd, "FREE") == 0)
+    {
+        journal_detach(s->journal, id);
+        destroy_game(slot->game);
+        slot->game = NULL;
+        pthread_mutex_unlock(&slot->lock);
+
+        //la partie, vide, ne peut plus servir qu'une fois rendue à la liste des parties libres
+        pthread_mutex_lock(&s->games_lock);
+        slot->next_free = s->free_head;
+        s->free_head = id;
+        pthread_mutex_unlock(&s->games_lock);
+        buffer_printf(reply, "OK\n");
+        return;
+    }
+
+    execute_on_game(s, id, slot->game, cmd, n - 2, args, list, reply);
+    pthread_mutex_unlock(&slot->lock);
+}
+
+static void *worker(void *arg) {
+    server *s = arg;
+    turn *list = &s->lists[__atomic_fetch_add(&s->nb_started, 1, __ATOMIC_RELAXED) * MAX_TURNS];
+
+    while (true) {
+        pthread_mutex_lock(&s->queue_lock);
+        while (s->queue_head == NULL && !s->stopping) {
+            pthread_cond_wait(&s->queue_cond, &s->queue_lock);
+        }
+        job *j = s->queue_head;
+        if (j == NULL)
+        {
+            pthread_mutex_unlock(&s->queue_lock);
+            break;
+        }
+        s->queue_head = j->next;
+        if (s->queue_head == NULL)
+        {
+            s->queue_tail = NULL;
+        }
+        pthread_mutex_unlock(&s->queue_lock);
+
+        execute(s, j->line, list, &j->reply);
+
+        //retour à la boucle
+        pthread_mutex_lock(&s->done_lock);
+        j->next = s->done;
+        s->done = j;
+        pthread_mutex_unlock(&s->done_lock);
+        uint64_t one = 1;
+        if (write(s->done_fd, &one, sizeof(one)) < 0)
+        {
+            perror("eventfd");
+        }
+    }
+    return NULL;
+}
+
+// Événements voulus : lire tant que le tampon d'entrée a de la place, écrire s'il reste une réponse à envoyer
+static void update_events(server *s, connection *c) {
+    uint32_t events = (c->in_len < MAX_LINE ? EPOLLIN : 0) | (c->out_pos < c->out.len ? EPOLLOUT : 0);
+    if (events != c->events)
+    {
+        struct epoll_event ev = {.events = events, .data.ptr = c};
+        epoll_ctl(s->epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+        c->events = events;
+    }
+}
+
+// Le client est parti ou a fait une erreur ; la connexion est libérée à la fin du lot d'événements
+// (d'autres événements du lot peuvent encore la désigner), ou au retour de sa requête
+static void close_connection(server *s, connection *c) {
+    epoll_ctl(s->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    c->closed = true;
+    if (!c->busy)
+    {
+        c->next_closed = s->closed;
+        s->closed = c;
+    }
+}
+
+// Envoie ce qui peut l'être ; renvoie false si la connexion a été fermée
+static bool flush(server *s, connection *c) {
+    while (c->out_pos < c->out.len) {
+        ssize_t n = send(c->fd, c->out.data + c->out_pos, c->out.len - c->out_pos, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            close_connection(s, c);
+            return false;
+        }
+        c->out_pos += n;
+    }
+    if (c->out_pos == c->out.len)
+    {
+        c->out_pos = 0;
+        c->out.len = 0;
+    }
+    return true;
+}
+
+// Confie la prochaine requête complète de la connexion aux workers, s'il n'y en a pas déjà une
+static void dispatch(server *s, connection *c) {
+    while (!c->busy && c->out.len - c->out_pos < OUT_LIMIT) {
+        char *end = memchr(c->in, '\n', c->in_len);
+        if (end == NULL)
+        {
+            if (c->in_len == MAX_LINE)
+            {
+                //ligne trop longue : elle est jetée jusqu'au saut de ligne
+                if (!c->discarding)
+                {
+                    buffer_printf(&c->out, "ERR requête trop longue\n");
+                    c->discarding = true;
+                }
+                c->in_len = 0;
+            }
+            return;
+        }
+
+        size_t length = end - c->in;
+        size_t consumed = length + 1;
+        if (c->discarding)
+        {
+            c->discarding = false;
+            length = 0;
+        }
+        if (length > 0 && c->in[length - 1] == '\r')
+        {
+            length--;
+        }
+
+        if (length > 0)
+        {
+            job *j = calloc(1, sizeof(job));
+            if (j == NULL)
+            {
+                return;
+            }
+            j->conn = c;
+            memcpy(j->line, c->in, length);
+            j->line[length] = '\0';
+            c->busy = true;
+
+            pthread_mutex_lock(&s->queue_lock);
+            if (s->queue_tail == NULL)
+            {
+                s->queue_head = j;
+            }
+            else
+            {
+                s->queue_tail->next = j;
+            }
+            s->queue_tail = j;
+            pthread_cond_signal(&s->queue_cond);
+            pthread_mutex_unlock(&s->queue_lock);
+        }
+        memmove(c->in, c->in + consumed, c->in_len - consumed);
+        c->in_len -= consumed;
+    }
+}
+
+// Lit ce qui est arrivé, tant que le tampon d'entrée a de la place ; renvoie false si la connexion a été fermée
+static bool receive(server *s, connection *c) {
+    while (c->in_len < MAX_LINE) {
+        ssize_t n = read(c->fd, c->in + c->in_len, MAX_LINE - c->in_len);
+        if (n > 0)
+        {
+            c->in_len += n;
+            dispatch(s, c);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        close_connection(s, c);
+        return false;
+    }
+    return true;
+}
+
+// Réponses rendues par les workers
+static void on_done(server *s) {
+    uint64_t count;
+    if (read(s->done_fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+    {
+        perror("eventfd");
+    }
+
+    pthread_mutex_lock(&s->done_lock);
+    job *j = s->done;
+    s->done = NULL;
+    pthread_mutex_unlock(&s->done_lock);
+
+    while (j != NULL) {
+        job *next = j->next;
+        connection *c = j->conn;
+        c->busy = false;
+        if (c->closed)
+        {
+            c->next_closed = s->closed;
+            s->closed = c;
+        }
+        else if (buffer_reserve(&c->out, j->reply.len))
+        {
+            memcpy(c->out.data + c->out.len, j->reply.data, j->reply.len);
+            c->out.len += j->reply.len;
+            if (flush(s, c))
+            {
+                dispatch(s, c);
+                update_events(s, c);
+            }
+        }
+        free(j->reply.data);
+        free(j);
+        j = next;
+    }
+}
+
+static int listen_socket(const char *path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("socket");
+        return -1;
+    }
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "chemin de socket trop long : %s\n", path);
+        close(fd);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0)
+    {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int run_server(const char *path, int nb_threads, int max_games, const char *journal_path) {
+    server s = {0};
+    s.max_games = max_games;
+    s.games = calloc(max_games, sizeof(game_slot));
+    if (s.games == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+    if (journal_path != NULL)
+    {
+        s.journal = journal_open(journal_path, max_games);
+        if (s.journal == NULL)
+        {
+            fprintf(stderr, "journal %s : impossible à ouvrir, ou écrit pour un autre nombre de parties\n", journal_path);
+            return 1;
+        }
+    }
+
+    //les parties du journal sont reprises ; les autres numéros forment la liste des parties libres
+    int nb_recovered = 0;
+    s.free_head = -1;
+    for (int i = max_games - 1; i >= 0; i--) {
+        pthread_mutex_init(&s.games[i].lock, NULL);
+        s.games[i].game = s.journal != NULL ? journal_recover(s.journal, i) : NULL;
+        if (s.games[i].game != NULL)
+        {
+            nb_recovered++;
+            s.games[i].next_free = -1;
+        }
+        else
+        {
+            s.games[i].next_free = s.free_head;
+            s.free_head = i;
+        }
+    }
+    if (s.journal != NULL)
+    {
+        fprintf(stderr, "journal %s : %d parties reprises\n", journal_path, nb_recovered);
+    }
+    pthread_mutex_init(&s.games_lock, NULL);
+    pthread_mutex_init(&s.queue_lock, NULL);
+    pthread_cond_init(&s.queue_cond, NULL);
+    pthread_mutex_init(&s.done_lock, NULL);
+
+    int listen_fd = listen_socket(path);
+    s.done_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    s.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (listen_fd < 0 || s.done_fd < 0 || s.epoll_fd < 0)
+    {
+        return 1;
+    }
+
+    //les deux descripteurs de la boucle se reconnaissent à leur adresse
+    static int listen_marker;
+    static int done_marker;
+    struct epoll_event ev = {.events = EPOLLIN, .data.ptr = &listen_marker};
+    epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+    ev.data.ptr = &done_marker;
+    epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, s.done_fd, &ev);
+
+    struct sigaction sa = {.sa_handler = on_signal};
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    //les listes de tours des workers sont allouées avant leur démarrage
+    pthread_t *threads = malloc(nb_threads * sizeof(pthread_t));
+    s.lists = malloc((size_t)nb_threads * MAX_TURNS * sizeof(turn));
+    if (threads == NULL || s.lists == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+    for (int i = 0; i < nb_threads; i++) {
+        if (pthread_create(&threads[i], NULL, worker, &s) != 0)
+        {
+            //les workers déjà lancés sont arrêtés
+            fprintf(stderr, "impossible de lancer les workers\n");
+            pthread_mutex_lock(&s.queue_lock);
+            s.stopping = true;
+            pthread_cond_broadcast(&s.queue_cond);
+            pthread_mutex_unlock(&s.queue_lock);
+            for (int k = 0; k < i; k++) {
+                pthread_join(threads[k], NULL);
+            }
+            unlink(path);
+            return 1;
+        }
+    }
+    fprintf(stderr, "serveur sur %s : %d workers, %d parties au plus\n", path, nb_threads, max_games);
+
+    struct epoll_event events[MAX_EVENTS];
+    while (!interrupted) {
+        int n = epoll_wait(s.epoll_fd, events, MAX_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("epoll_wait");
+            break;
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.ptr == &listen_marker)
+            {
+                int fd;
+                while ((fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+                    connection *c = calloc(1, sizeof(connection));
+                    if (c == NULL)
+                    {
+                        close(fd);
+                        continue;
+                    }
+                    c->fd = fd;
+                    c->events = EPOLLIN;
+                    struct epoll_event cev = {.events = EPOLLIN, .data.ptr = c};
+                    epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, fd, &cev);
+                }
+            }
+            else if (events[i].data.ptr == &done_marker)
+            {
+                on_done(&s);
+            }
+            else
+            {
+                //une connexion fermée plus haut dans ce même lot n'a plus d'événements à traiter
+                connection *c = events[i].data.ptr;
+                if (c->closed)
+                {
+                    continue;
+                }
+                if ((events[i].events & EPOLLOUT) && !flush(&s, c))
+                {
+                    continue;
+                }
+                if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !receive(&s, c))
+                {
+                    continue;
+                }
+                dispatch(&s, c);
+                update_events(&s, c);
+            }
+        }
+
+        while (s.closed != NULL) {
+            connection *c = s.closed;
+            s.closed = c->next_closed;
+            free(c->out.data);
+            free(c);
+        }
+    }
+
+    fprintf(stderr, "arrêt du serveur\n");
+    pthread_mutex_lock(&s.queue_lock);
+    s.stopping = true;
+    pthread_cond_broadcast(&s.queue_cond);
+    pthread_mutex_unlock(&s.queue_lock);
+    for (int i = 0; i < nb_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    free(s.lists);
+    for (int i = 0; i < max_games; i++) {
+        if (s.games[i].game != NULL)
+        {
+            destroy_game(s.games[i].game);
+        }
+        pthread_mutex_destroy(&s.games[i].lock);
+    }
+    free(s.games);
+    journal_close(s.journal);
+    close(listen_fd);
+    unlink(path);
+    return 0;
+}
+
+// Client de test : envoie chaque ligne de l'entrée standard et affiche la réponse
+static int run_client(const char *path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        perror(path);
+        return 1;
+    }
+
+    FILE *in = fdopen(fd, "r");
+    char line[MAX_LINE + 2];
+    char *answer = NULL;
+    size_t answer_cap = 0;
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        if (line[0] == '\n')
+        {
+            continue;
+        }
+        if (send(fd, line, strlen(line), MSG_NOSIGNAL) < 0 || getline(&answer, &answer_cap, in) < 0)
+        {
+            fprintf(stderr, "connexion perdue\n");
+            break;
+        }
+        fputs(answer, stdout);
+    }
+    free(answer);
+    fclose(in);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int max_games = 10000;
+    bool client = false;
+    const char *path = NULL;
+    const char *journal_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            nb_threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc)
+        {
+            max_games = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+        {
+            journal_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            client = true;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if (path == NULL || nb_threads < 1 || max_games < 1)
+    {
+        fprintf(stderr, "usage : %s [-t threads] [-g parties] [-j journal] socket\n        %s -c socket < requêtes\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    return client ? run_client(path) : run_server(path, nb_threads, max_games, journal_path);
+}
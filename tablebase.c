@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "board_s.h"
+#include "rank.h"
+#include "tablebase.h"
+
+
+#define TB_MAGIC "GYGESTB"
+#define TB_VERSION 1
+
+// En-tête du fichier, suivi des valeurs puis des distances (alignées sur 8 octets)
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t dimension;
+    uint32_t initial_pieces;
+    uint32_t reserved;
+    uint64_t nb_positions;
+    uint64_t wdl_offset;
+    uint64_t distance_offset;
+} tb_header;
+
+bool tb_write(const char *path, const unsigned char *wdl, const uint16_t *distance) {
+    tb_header header;
+    uint64_t nb = rank_count();
+    uint64_t wdl_size = (nb + 3) / 4;
+    static const char padding[8] = { 0 };
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TB_MAGIC, sizeof(TB_MAGIC));
+    header.version = TB_VERSION;
+    header.dimension = DIMENSION;
+    header.initial_pieces = NB_INITIAL_PIECES;
+    header.nb_positions = nb;
+    header.wdl_offset = sizeof(header);
+    header.distance_offset = (header.wdl_offset + wdl_size + 7) & ~(uint64_t)7;
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+        && fwrite(wdl, 1, wdl_size, f) == wdl_size
+        && fwrite(padding, 1, header.distance_offset - header.wdl_offset - wdl_size, f) == header.distance_offset - header.wdl_offset - wdl_size
+        && fwrite(distance, sizeof(uint16_t), nb, f) == nb;
+    if (fclose(f) != 0)
+    {
+        ok = false;
+    }
+    return ok;
+}
+
+bool tb_open(tablebase *tb, const char *path) {
+    struct stat st;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(tb_header))
+    {
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+
+    //la table doit correspondre à la variante compilée
+    const tb_header *header = map;
+    uint64_t nb = rank_count();
+    if (memcmp(header->magic, TB_MAGIC, sizeof(TB_MAGIC)) != 0 || header->version != TB_VERSION
+        || header->dimension != DIMENSION || header->initial_pieces != NB_INITIAL_PIECES
+        || header->nb_positions != nb
+        || header->distance_offset + nb * sizeof(uint16_t) > (uint64_t)st.st_size)
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    tb->map = map;
+    tb->map_size = st.st_size;
+    tb->nb_positions = nb;
+    tb->wdl = (const unsigned char *)map + header->wdl_offset;
+    tb->distance = (const uint16_t *)((const unsigned char *)map + header->distance_offset);
+    return true;
+}
+
+void tb_close(tablebase *tb) {
+    if (tb->map != NULL)
+    {
+        munmap(tb->map, tb->map_size);
+        tb->map = NULL;
+    }
+}
+
+tb_value tb_probe(const tablebase *tb, board game, player p, int *distance) {
+    if (tb->map == NULL || game->nb_pieces != NB_PIECES || game->picked_piece != NONE || game->winner != NO_PLAYER)
+    {
+        return TB_UNKNOWN;
+    }
+
+    uint64_t index = rank_position(game, p);
+    if (distance != NULL)
+    {
+        *distance = tb->distance[index];
+    }
+    return TB_GET(tb->wdl, index);
+}
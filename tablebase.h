@@ -0,0 +1,89 @@
+#ifndef _TABLEBASE_H_
+#define _TABLEBASE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "board.h"
+
+/**
+ * \file tablebase.h
+ *
+ * \brief Tables de finales des variantes réduites, résolues complètement.
+ *
+ * Sur un petit plateau avec peu de pièces (par exemple 4x4 et une pièce de chaque
+ * taille par joueur), toutes les positions de jeu peuvent être résolues.
+ * Les positions sont rangées selon leur numéro dans rank.h.
+ *
+ * L'outil tbgen.c calcule la valeur de chaque position et l'écrit dans un fichier
+ * qui est ensuite projeté en mémoire (mmap) et consulté par ::tb_probe.
+ * Toutes les unités doivent être compilées avec les mêmes ::DIMENSION et
+ * ::NB_INITIAL_PIECES, par exemple :
+ * \code
+ * gcc -O2 -pthread -DDIMENSION=4 -DNB_INITIAL_PIECES=1 tbgen.c tablebase.c rank.c board.c eval.c \
+ *     board_tables.c turn.c walks_table_4.c -o tbgen
+ * ./tbgen gyges_4x4.tb
+ * \endcode
+ */
+
+/**
+ * @brief valeur d'une position pour le joueur qui a le trait.
+ */
+typedef enum tb_value_e {
+	TB_UNKNOWN, /**< position absente de la table */
+	TB_WIN, /**< le joueur qui a le trait gagne */
+	TB_LOSS, /**< le joueur qui a le trait perd */
+	TB_DRAW, /**< aucun des deux joueurs ne peut forcer le gain */
+	} tb_value;
+
+/**
+ * @brief une table projetée en mémoire.
+ */
+typedef struct {
+	const unsigned char *wdl; /**< valeurs sur 2 bits, 4 positions par octet */
+	const uint16_t *distance; /**< nombre de demi-coups jusqu'à la fin de la partie */
+	uint64_t nb_positions; /**< nombre de positions de la table */
+	void *map; /**< début de la projection */
+	size_t map_size; /**< taille de la projection */
+} tablebase;
+
+/**
+ * @brief Écrit une table dans un fichier.
+ *
+ * Les deux tableaux couvrent les ::rank_count() positions.
+ *
+ * @param path le chemin du fichier.
+ * @param wdl les valeurs, 4 positions par octet.
+ * @param distance les distances de chaque position.
+ * @return false en cas d'erreur d'écriture.
+ */
+bool tb_write(const char *path, const unsigned char *wdl, const uint16_t *distance);
+
+/**
+ * @brief Ouvre et projette en mémoire une table écrite par ::tb_write.
+ * @param tb reçoit la table.
+ * @param path le chemin du fichier.
+ * @return false si le fichier est absent ou n'a pas été calculé pour cette variante.
+ */
+bool tb_open(tablebase *tb, const char *path);
+
+/**
+ * @brief Ferme une table ouverte par ::tb_open.
+ */
+void tb_close(tablebase *tb);
+
+/**
+ * @brief Cherche la valeur d'une position.
+ * @param tb la table.
+ * @param game le plateau, entre deux tours.
+ * @param p le joueur qui a le trait.
+ * @param distance si non NULL, reçoit le nombre de demi-coups jusqu'à la fin (0 pour une nulle).
+ * @return la valeur, ::TB_UNKNOWN si la position n'est pas une position de la table.
+ */
+tb_value tb_probe(const tablebase *tb, board game, player p, int *distance);
+
+/**
+ * @brief Valeur de la position index dans un tableau de valeurs sur 2 bits.
+ */
+#define TB_GET(wdl, index) ((tb_value)(((wdl)[(index) >> 2] >> (((index) & 3) * 2)) & 3))
+
+#endif /*_TABLEBASE_H_*/
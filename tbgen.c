@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "board_s.h"
+#include "turn.h"
+#include "rank.h"
+#include "tablebase.h"
+
+// Outil de résolution complète d'une variante réduite (voir tablebase.h pour la compilation)
+// Usage : ./tbgen [-t threads] fichier.tb
+//
+// La résolution se fait par passes successives sur tout l'index :
+// - passe 0 : une position sans aucun tour possible est perdue ;
+// - passe 1 : une position avec un tour gagnant immédiat est gagnée ;
+// - passe k : une position est gagnée si l'un de ses fils est perdu,
+//   perdue si tous ses fils sont gagnés.
+// Une passe ne lit que les valeurs des passes précédentes : une position résolue
+// à la passe k est donc exactement à k demi-coups de la fin. Les positions encore
+// inconnues quand une passe ne résout plus rien sont nulles.
+
+// Au-delà, les tableaux ne tiennent pas en mémoire
+#define MAX_POSITIONS ((uint64_t)1 << 34)
+
+// Positions traitées d'un coup par un thread (multiple de 4 : un octet de valeurs n'a qu'un écrivain)
+#define CHUNK 4096
+
+typedef struct {
+    uint64_t nb_positions;
+    unsigned char *wdl;    // valeurs des passes précédentes, lues pendant la passe
+    unsigned char *next;   // valeurs après la passe, écrites pendant la passe
+    uint16_t *distance;
+    int pass;
+    uint64_t next_chunk;   // premier index non distribué (atomique)
+    uint64_t resolved;     // positions résolues pendant la passe (atomique)
+} tb_solver;
+
+static void set_value(unsigned char *wdl, uint64_t index, tb_value v) {
+    wdl[index >> 2] |= v << ((index & 3) * 2);
+}
+
+// Valeur d'une position inconnue à la passe en cours (TB_UNKNOWN si elle reste inconnue)
+static tb_value solve_position(tb_solver *s, board game, player p, turn *list) {
+    if (s->pass == 1 && find_winning_turn(game, p, NULL))
+    {
+        return TB_WIN;
+    }
+
+    int nb = generate_turns(game, p, list, MAX_TURNS);
+    if (s->pass == 0)
+    {
+        return nb == 0 ? TB_LOSS : TB_UNKNOWN;
+    }
+
+    bool all_win = true;
+    for (int i = 0; i < nb; i++) {
+        //les tours gagnants ont été traités à la passe 1
+        if (list[i].to == NO_SQUARE)
+        {
+            all_win = false;
+            continue;
+        }
+
+        size moved = apply_turn(game, p, &list[i]);
+        tb_value v = TB_GET(s->wdl, rank_position(game, next_player(p)));
+        undo_turn(game, &list[i], moved);
+
+        if (v == TB_LOSS)
+        {
+            return TB_WIN;
+        }
+        if (v != TB_WIN)
+        {
+            all_win = false;
+        }
+    }
+    return all_win ? TB_LOSS : TB_UNKNOWN;
+}
+
+static void *worker(void *arg) {
+    tb_solver *s = arg;
+    board game = new_game();
+    turn *list = malloc(MAX_TURNS * sizeof(turn));
+    uint64_t resolved = 0;
+
+    if (game == NULL || list == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        exit(1);
+    }
+
+    while (true) {
+        uint64_t first = __atomic_fetch_add(&s->next_chunk, CHUNK, __ATOMIC_RELAXED);
+        if (first >= s->nb_positions)
+        {
+            break;
+        }
+        uint64_t last = first + CHUNK < s->nb_positions ? first + CHUNK : s->nb_positions;
+
+        for (uint64_t index = first; index < last; index++) {
+            if (TB_GET(s->wdl, index) != TB_UNKNOWN)
+            {
+                continue;
+            }
+
+            player p;
+            unrank_position(index, game, &p);
+            tb_value v = solve_position(s, game, p, list);
+            if (v != TB_UNKNOWN)
+            {
+                set_value(s->next, index, v);
+                s->distance[index] = s->pass;
+                resolved++;
+            }
+        }
+    }
+
+    __atomic_fetch_add(&s->resolved, resolved, __ATOMIC_RELAXED);
+    free(list);
+    destroy_game(game);
+    return NULL;
+}
+
+int main(int argc, char *argv[]) {
+    int nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            nb_threads = atoi(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if (path == NULL || nb_threads < 1)
+    {
+        fprintf(stderr, "usage : %s [-t threads] fichier.tb\n", argv[0]);
+        return 1;
+    }
+
+    tb_solver s;
+    s.nb_positions = rank_count();
+    if (s.nb_positions > MAX_POSITIONS)
+    {
+        fprintf(stderr, "%llu positions : variante trop grande pour être résolue\n", (unsigned long long)s.nb_positions);
+        return 1;
+    }
+
+    uint64_t wdl_size = (s.nb_positions + 3) / 4;
+    s.wdl = calloc(wdl_size, 1);
+    s.next = calloc(wdl_size, 1);
+    s.distance = calloc(s.nb_positions, sizeof(uint16_t));
+    if (s.wdl == NULL || s.next == NULL || s.distance == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+
+    fprintf(stderr, "DIMENSION %d, %d pièces : %llu positions, %d threads\n",
+            DIMENSION, NB_PIECES, (unsigned long long)s.nb_positions, nb_threads);
+
+    pthread_t *threads = malloc(nb_threads * sizeof(pthread_t));
+    if (threads == NULL)
+    {
+        fprintf(stderr, "mémoire insuffisante\n");
+        return 1;
+    }
+    for (s.pass = 0; s.pass < UINT16_MAX; s.pass++) {
+        s.next_chunk = 0;
+        s.resolved = 0;
+        //seuls les threads effectivement lancés sont attendus
+        int nb_started = 0;
+        while (nb_started < nb_threads && pthread_create(&threads[nb_started], NULL, worker, &s) == 0) {
+            nb_started++;
+        }
+        for (int i = 0; i < nb_started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        if (nb_started < nb_threads)
+        {
+            fprintf(stderr, "impossible de lancer %d threads\n", nb_threads);
+            return 1;
+        }
+        memcpy(s.wdl, s.next, wdl_size);
+
+        fprintf(stderr, "passe %d : %llu positions résolues\n", s.pass, (unsigned long long)s.resolved);
+        if (s.pass >= 1 && s.resolved == 0)
+        {
+            break;
+        }
+    }
+    free(threads);
+
+    //les positions restées inconnues sont nulles
+    uint64_t counts[4] = { 0 };
+    for (uint64_t index = 0; index < s.nb_positions; index++) {
+        if (TB_GET(s.wdl, index) == TB_UNKNOWN)
+        {
+            set_value(s.wdl, index, TB_DRAW);
+        }
+        counts[TB_GET(s.wdl, index)]++;
+    }
+    fprintf(stderr, "gains %llu, pertes %llu, nulles %llu\n", (unsigned long long)counts[TB_WIN],
+            (unsigned long long)counts[TB_LOSS], (unsigned long long)counts[TB_DRAW]);
+
+    if (!tb_write(path, s.wdl, s.distance))
+    {
+        fprintf(stderr, "impossible d'écrire %s\n", path);
+        return 1;
+    }
+
+    free(s.wdl);
+    free(s.next);
+    free(s.distance);
+    return 0;
+}
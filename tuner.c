@@ -0,0 +1,338 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "board_s.h"
+#include "rank.h"
+#include "selfplay.h"
+
+// Réglage des poids de l'évaluation sur les parties de selfplay (méthode de Texel)
+// Compilation : gcc -O3 -march=native -ffast-math -pthread tuner.c board.c eval.c board_tables.c rank.c -lm -o tuner
+// Usage : ./tuner [-t threads] [-e époques] [-l pas] selfplay.0.bin selfplay.1.bin...
+//
+// Le résultat d'une position (1 gagnée, 0 perdue, 0.5 sans vainqueur pour le joueur qui a le trait)
+// est prédit par sigmoid(K * évaluation). Les poids minimisent l'erreur quadratique moyenne
+// de cette prédiction ; K est d'abord choisi pour les poids actuels.
+//
+// Les termes de chaque position sont extraits une seule fois dans des tableaux séparés
+// par terme (structure de tableaux) : une époque n'est plus qu'une suite de produits
+// scalaires, que le compilateur vectorise.
+
+// Positions traitées par bloc (les scores d'un bloc restent dans le cache)
+#define BLOCK 1024
+
+// Paramètres d'Adam
+#define ADAM_BETA1 0.9
+#define ADAM_BETA2 0.999
+#define ADAM_EPSILON 1e-8
+
+typedef struct {
+    size_t nb_positions;
+    float *terms[NB_EVAL_TERMS];  // terms[t][i] : terme t de la position i
+    float *result;                // résultat de la position i pour le joueur qui a le trait
+} dataset;
+
+typedef struct {
+    dataset *data;
+    size_t first;
+    size_t last;
+    const selfplay_record *records;   // pour l'extraction : enregistrements du fichier en cours
+    size_t base;                      // indice de la première position du fichier
+    const float *weights;
+    float k;
+    double loss;                      // sortie : somme des erreurs
+    double gradient[NB_EVAL_TERMS];   // sortie : somme des dérivées
+    bool failed;                      // sortie : l'extraction n'a pas pu allouer son plateau
+} slice;
+
+// Libère les tableaux d'un jeu de positions (ceux qui n'ont pas été alloués valent NULL)
+static void free_dataset(dataset *data) {
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        free(data->terms[t]);
+    }
+    free(data->result);
+}
+
+// Extrait les termes des positions [first, last) de la tranche
+static void *extract(void *arg) {
+    slice *s = arg;
+    board game = new_game();
+    int terms[NB_EVAL_TERMS];
+
+    s->failed = (game == NULL);
+    if (s->failed)
+    {
+        return NULL;
+    }
+    for (size_t i = s->first; i < s->last; i++) {
+        const selfplay_record *r = &s->records[i - s->base];
+        player p;
+        unrank_position(r->position, game, &p);
+        eval_terms(game, p, terms);
+        for (int t = 0; t < NB_EVAL_TERMS; t++) {
+            s->data->terms[t][i] = terms[t];
+        }
+        s->data->result[i] = (r->winner == NO_PLAYER) ? 0.5f : (r->winner == p ? 1.0f : 0.0f);
+    }
+
+    destroy_game(game);
+    return NULL;
+}
+
+// Erreur et gradient sur la tranche, bloc par bloc
+static void *sweep(void *arg) {
+    slice *s = arg;
+    float score[BLOCK];
+    float delta[BLOCK];
+
+    s->loss = 0;
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        s->gradient[t] = 0;
+    }
+
+    for (size_t start = s->first; start < s->last; start += BLOCK) {
+        size_t n = (s->last - start < BLOCK) ? s->last - start : BLOCK;
+
+        //scores : un produit scalaire par position, terme par terme
+        for (size_t i = 0; i < n; i++) {
+            score[i] = 0;
+        }
+        for (int t = 0; t < NB_EVAL_TERMS; t++) {
+            const float *x = s->data->terms[t] + start;
+            float w = s->weights[t];
+            for (size_t i = 0; i < n; i++) {
+                score[i] += w * x[i];
+            }
+        }
+
+        //erreur, et dérivée de l'erreur par rapport au score
+        const float *result = s->data->result + start;
+        float loss = 0;
+        for (size_t i = 0; i < n; i++) {
+            float sigma = 1.0f / (1.0f + expf(-s->k * score[i]));
+            float error = result[i] - sigma;
+            loss += error * error;
+            delta[i] = -2.0f * error * sigma * (1.0f - sigma) * s->k;
+        }
+        s->loss += loss;
+
+        for (int t = 0; t < NB_EVAL_TERMS; t++) {
+            const float *x = s->data->terms[t] + start;
+            float g = 0;
+            for (size_t i = 0; i < n; i++) {
+                g += delta[i] * x[i];
+            }
+            s->gradient[t] += g;
+        }
+    }
+    return NULL;
+}
+
+// Lance fn sur chaque tranche, un thread par tranche
+static void run_slices(slice *slices, int nb_threads, void *(*fn)(void *)) {
+    pthread_t threads[nb_threads];
+    for (int i = 0; i < nb_threads; i++) {
+        pthread_create(&threads[i], NULL, fn, &slices[i]);
+    }
+    for (int i = 0; i < nb_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+// Erreur moyenne (et gradient moyen si non NULL) pour des poids et un K donnés
+static double mean_error(slice *slices, int nb_threads, const float *weights, float k, double *gradient) {
+    double loss = 0;
+    size_t n = slices[0].data->nb_positions;
+
+    for (int i = 0; i < nb_threads; i++) {
+        slices[i].weights = weights;
+        slices[i].k = k;
+    }
+    run_slices(slices, nb_threads, sweep);
+
+    if (gradient != NULL)
+    {
+        for (int t = 0; t < NB_EVAL_TERMS; t++) {
+            gradient[t] = 0;
+        }
+    }
+    for (int i = 0; i < nb_threads; i++) {
+        loss += slices[i].loss;
+        for (int t = 0; gradient != NULL && t < NB_EVAL_TERMS; t++) {
+            gradient[t] += slices[i].gradient[t] / n;
+        }
+    }
+    return loss / n;
+}
+
+// Nombre d'enregistrements d'un fichier de selfplay, -1 s'il est illisible
+static long count_records(const char *path) {
+    struct stat st;
+
+    if (stat(path, &st) != 0)
+    {
+        return -1;
+    }
+    return st.st_size / sizeof(selfplay_record);
+}
+
+// Projette un fichier de selfplay et extrait ses positions à partir de l'indice first
+static bool extract_file(const char *path, dataset *data, size_t first, slice *slices, int nb_threads) {
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        return false;
+    }
+    size_t count = st.st_size / sizeof(selfplay_record);
+    if (count == 0)
+    {
+        close(fd);
+        return true;
+    }
+
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+
+    //les enregistrements sont lus directement dans la projection, une tranche par thread
+    for (int i = 0; i < nb_threads; i++) {
+        slices[i].data = data;
+        slices[i].records = map;
+        slices[i].base = first;
+        slices[i].first = first + count * i / nb_threads;
+        slices[i].last = first + count * (i + 1) / nb_threads;
+    }
+    run_slices(slices, nb_threads, extract);
+    munmap(map, st.st_size);
+    for (int i = 0; i < nb_threads; i++) {
+        if (slices[i].failed)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int nb_epochs = 500;
+    double step = 0.5;
+    int first_file = argc;
+    size_t nb_records = 0;
+
+    for (int i = 1; i < argc && first_file == argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) nb_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) nb_epochs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) step = atof(argv[++i]);
+        else first_file = i;
+    }
+    for (int i = first_file; i < argc; i++) {
+        long count = count_records(argv[i]);
+        if (count < 0)
+        {
+            fprintf(stderr, "impossible de lire %s\n", argv[i]);
+            return 1;
+        }
+        nb_records += count;
+    }
+    if (nb_records == 0 || nb_threads < 1)
+    {
+        fprintf(stderr, "usage : %s [-t threads] [-e époques] [-l pas] fichiers de selfplay...\n", argv[0]);
+        return 1;
+    }
+
+    dataset data;
+    data.nb_positions = nb_records;
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        data.terms[t] = aligned_alloc(64, (nb_records * sizeof(float) + 63) / 64 * 64);
+    }
+    data.result = aligned_alloc(64, (nb_records * sizeof(float) + 63) / 64 * 64);
+    bool allocated = (data.result != NULL);
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        allocated = allocated && data.terms[t] != NULL;
+    }
+    if (!allocated)
+    {
+        fprintf(stderr, "mémoire insuffisante pour %zu positions\n", nb_records);
+        free_dataset(&data);
+        return 1;
+    }
+
+    slice slices[nb_threads];
+    size_t first = 0;
+    for (int i = first_file; i < argc; i++) {
+        if (!extract_file(argv[i], &data, first, slices, nb_threads))
+        {
+            fprintf(stderr, "impossible d'extraire les positions de %s\n", argv[i]);
+            free_dataset(&data);
+            return 1;
+        }
+        first += count_records(argv[i]);
+    }
+
+    //chaque thread traite ensuite une tranche contiguë de toutes les positions
+    for (int i = 0; i < nb_threads; i++) {
+        slices[i].first = nb_records * i / nb_threads;
+        slices[i].last = nb_records * (i + 1) / nb_threads;
+    }
+    fprintf(stderr, "%zu positions, %d threads\n", nb_records, nb_threads);
+
+    float weights[NB_EVAL_TERMS];
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        weights[t] = eval_weights[t];
+    }
+
+    //K : la pente qui colle le mieux aux poids actuels (recherche sur une échelle logarithmique)
+    float k = 1e-6f;
+    double best_error = mean_error(slices, nb_threads, weights, k, NULL);
+    for (float candidate = 1.25e-6f; candidate < 1.0f; candidate *= 1.25f) {
+        double error = mean_error(slices, nb_threads, weights, candidate, NULL);
+        if (error < best_error)
+        {
+            best_error = error;
+            k = candidate;
+        }
+    }
+    fprintf(stderr, "K = %g, erreur initiale %.6f\n", k, best_error);
+
+    //descente de gradient (Adam), le pas est exprimé en unités de poids
+    double m[NB_EVAL_TERMS] = { 0 };
+    double v[NB_EVAL_TERMS] = { 0 };
+    double gradient[NB_EVAL_TERMS];
+    double error = best_error;
+    for (int epoch = 1; epoch <= nb_epochs; epoch++) {
+        error = mean_error(slices, nb_threads, weights, k, gradient);
+        for (int t = 0; t < NB_EVAL_TERMS; t++) {
+            m[t] = ADAM_BETA1 * m[t] + (1 - ADAM_BETA1) * gradient[t];
+            v[t] = ADAM_BETA2 * v[t] + (1 - ADAM_BETA2) * gradient[t] * gradient[t];
+            double m_hat = m[t] / (1 - pow(ADAM_BETA1, epoch));
+            double v_hat = v[t] / (1 - pow(ADAM_BETA2, epoch));
+            weights[t] -= step * m_hat / (sqrt(v_hat) + ADAM_EPSILON);
+        }
+        if (epoch % 50 == 0)
+        {
+            fprintf(stderr, "époque %d : erreur %.6f\n", epoch, error);
+        }
+    }
+
+    //poids arrondis, à recopier dans eval.c
+    printf("int eval_weights[NB_EVAL_TERMS] = {");
+    for (int t = 0; t < NB_EVAL_TERMS; t++) {
+        printf(" %d%s", (int)lrintf(weights[t]), t + 1 < NB_EVAL_TERMS ? "," : "");
+    }
+    printf(" };\n");
+    fprintf(stderr, "erreur finale %.6f\n", error);
+
+    free_dataset(&data);
+    return 0;
+}
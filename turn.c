@@ -0,0 +1,522 @@
+#include <stdlib.h>
+#include <string.h>
+#include "board_s.h"
+#include "turn.h"
+#include "walks.h"
+
+
+// Résultat de l'exploration d'un état (case, pas restants) : les arrivées atteintes,
+// et les segments et cases dont l'exploration a lu l'état. Deux explorations du même état
+// donnent le même résultat si ces segments et ces cases sont dans le même état.
+typedef struct {
+    endpoints ends;
+    uint64_t edges;        // segments testés
+    uint64_t squares;      // cases dont l'occupation a été testée
+} reach;
+
+// Mémo des explorations d'une position, par case, pas restants et rebond
+typedef struct {
+    reach result;
+    uint64_t used;         // segments empruntés, restreints à result.edges
+    uint64_t occupied;     // occupation, restreinte à result.squares
+    unsigned stamp;        // l'entrée est valable si elle porte le numéro du mémo
+} memo_entry;
+
+typedef struct {
+    uint64_t key;          // position mémorisée (clé de Zobrist de la grille)
+    player p;
+    unsigned stamp;        // changé à chaque position, ce qui invalide toutes les entrées
+    memo_entry entries[NB_SQUARES][NB_SIZE + 1][2];
+} bounce_memo;
+
+// Un mémo par thread : il reste valable tant que la grille ne change pas
+static __thread bounce_memo memo;
+
+// État de l'exploration des mouvements d'une pièce prise
+typedef struct {
+    board game;
+    player player;
+    uint64_t occupied;     // cases occupées, sans la pièce en main
+    uint64_t goal_line;
+    int from;
+    bool stop_at_goal;     // arrêt dès qu'un tour gagnant est trouvé
+    bool goal_only;        // seuls les tours gagnants sont ajoutés à la liste
+    endpoints ends;        // arrivées déjà trouvées
+    unsigned char steps[MAX_TURN_STEPS];
+    int nb_steps;
+    turn *list;            // tours à remplir, NULL pour ne calculer que les arrivées
+    int nb_turns;
+    int max_turns;
+    int max_swaps;         // échanges gardés par pièce rencontrée, 0 pour tous
+} explorer;
+
+// Ajoute un tour à la liste : les pas déjà faits, puis n pas du chemin, puis éventuellement GOAL
+static void emit(explorer *e, const walk *w, int n, int to, int swap_to, bool goal) {
+    if (e->list == NULL || e->nb_turns >= e->max_turns || (e->goal_only && !goal))
+    {
+        return;
+    }
+
+    turn *t = &e->list[e->nb_turns++];
+    t->from = e->from;
+    t->to = to;
+    t->swap_to = swap_to;
+    t->nb_steps = 0;
+    for (int i = 0; i < e->nb_steps; i++) {
+        t->steps[t->nb_steps++] = e->steps[i];
+    }
+    for (int i = 0; i < n; i++) {
+        t->steps[t->nb_steps++] = w->dirs[i];
+    }
+    if (goal)
+    {
+        t->steps[t->nb_steps++] = GOAL;
+    }
+}
+
+// Enregistre que la pièce peut entrer dans le but ; renvoie true s'il faut s'arrêter
+static bool reach_goal(explorer *e, const walk *w, int n) {
+    if (!e->ends.goal)
+    {
+        e->ends.goal = true;
+        emit(e, w, n, NO_SQUARE, NO_SQUARE, true);
+    }
+    return e->stop_at_goal;
+}
+
+static void merge_reach(reach *into, const reach *r) {
+    into->ends.land |= r->ends.land;
+    into->ends.bounce |= r->ends.bounce;
+    into->ends.goal |= r->ends.goal;
+    into->edges |= r->edges;
+    into->squares |= r->squares;
+}
+
+// Utilise le mémo de l'état s'il est valable ; renvoie true si l'exploration de l'état est inutile.
+// Un tour a besoin de ses pas : le sous-arbre n'est sauté que s'il n'apporte aucune nouvelle arrivée,
+// ou si seules les arrivées sont demandées.
+static bool use_memo(explorer *e, const memo_entry *m, uint64_t used, reach *out, bool *stop) {
+    const reach *r = &m->result;
+    if (m->stamp != memo.stamp || (used & r->edges) != m->used || (e->occupied & r->squares) != m->occupied)
+    {
+        return false;
+    }
+
+    merge_reach(out, r);
+    if (e->list == NULL)
+    {
+        e->ends.land |= r->ends.land;
+        e->ends.bounce |= r->ends.bounce;
+        if (r->ends.goal && !e->ends.goal)
+        {
+            e->ends.goal = true;
+            *stop = e->stop_at_goal;
+        }
+        return true;
+    }
+    if (e->goal_only)
+    {
+        //seul le but compte : un sous-arbre sans but est sauté
+        return !r->ends.goal || e->ends.goal;
+    }
+    return !(r->ends.land & ~e->ends.land) && !(r->ends.bounce & ~e->ends.bounce) && (!r->ends.goal || e->ends.goal);
+}
+
+// Explore les chemins d'une pièce en main sur square, qui doit encore faire k pas.
+// Les arrivées atteintes depuis cet état sont ajoutées à out.
+// Renvoie true si l'exploration doit s'arrêter.
+static bool explore(explorer *e, int square, int k, uint64_t used, bool bounce, reach *out) {
+    memo_entry *m = &memo.entries[square][k][bounce];
+    bool stop = false;
+    if (use_memo(e, m, used, out, &stop))
+    {
+        return stop;
+    }
+
+    reach r = { { 0, 0, false }, 0, 0 };
+    int count;
+
+    //la pièce peut entrer dans le but dès qu'elle est en main sur la ligne du but,
+    //même si la suite de son mouvement est bloquée : on teste les débuts de chemin
+    for (int j = 1; j < k && !r.ends.goal; j++) {
+        const walk *w = walks_from(square, j, &count);
+        for (int i = 0; i < count; i++, w++) {
+            uint64_t land = (uint64_t)1 << WALK_LAND(w, j);
+            if (!(land & e->goal_line))
+            {
+                continue;
+            }
+            r.edges |= w->edges;
+            r.squares |= w->inter | land;
+            if (!(w->edges & used) && !((w->inter | land) & e->occupied))
+            {
+                r.ends.goal = true;
+                if (reach_goal(e, w, j)) return true;
+                break;
+            }
+        }
+    }
+
+    const walk *w = walks_from(square, k, &count);
+    for (int i = 0; i < count; i++, w++) {
+        int land = WALK_LAND(w, k);
+        uint64_t land_bit = (uint64_t)1 << land;
+
+        //segment déjà emprunté ou case intermédiaire occupée
+        r.edges |= w->edges;
+        r.squares |= w->inter | land_bit;
+        if ((w->edges & used) || (w->inter & e->occupied))
+        {
+            continue;
+        }
+
+        //sur une case vide, la pièce est posée et le tour s'arrête
+        if (!(land_bit & e->occupied))
+        {
+            r.ends.land |= land_bit;
+            if (!(e->ends.land & land_bit))
+            {
+                e->ends.land |= land_bit;
+                emit(e, w, k, land, NO_SQUARE, false);
+            }
+            continue;
+        }
+
+        //un rebond commence toujours vers une case vide
+        if (bounce && k == 1)
+        {
+            continue;
+        }
+
+        //arrivée sur une pièce de la ligne du but : la pièce est encore en main
+        if (land_bit & e->goal_line)
+        {
+            r.ends.goal = true;
+            if (reach_goal(e, w, k)) return true;
+        }
+
+        //échange avec la pièce d'arrivée, vers chacune des cases vides
+        r.ends.bounce |= land_bit;
+        if (!(e->ends.bounce & land_bit))
+        {
+            e->ends.bounce |= land_bit;
+            uint64_t empty = BOARD_MASK & ~e->occupied;
+            if (e->max_swaps > 0 && e->list != NULL)
+            {
+                //seuls les meilleurs échanges selon rank_swap_targets sont gardés
+                signed char targets[NB_SQUARES];
+                int nb = rank_swap_targets(e->game, e->player, e->from, land, empty, targets);
+                for (int t = 0; t < nb && t < e->max_swaps; t++) {
+                    emit(e, w, k, land, targets[t], false);
+                }
+            }
+            else
+            {
+                while (empty != 0) {
+                    int target = __builtin_ctzll(empty);
+                    empty &= empty - 1;
+                    emit(e, w, k, land, target, false);
+                }
+            }
+        }
+
+        //rebond sur la pièce d'arrivée
+        int saved = e->nb_steps;
+        for (int j = 0; j < k; j++) {
+            e->steps[e->nb_steps++] = w->dirs[j];
+        }
+        size under = e->game->grid[SQUARE_LINE(land)][SQUARE_COL(land)];
+        if (explore(e, land, under, used | w->edges, true, &r))
+        {
+            return true;
+        }
+        e->nb_steps = saved;
+    }
+
+    //l'exploration est complète : elle est mémorisée pour les autres chemins et les autres pièces
+    m->result = r;
+    m->used = used & r.edges;
+    m->occupied = e->occupied & r.squares;
+    m->stamp = memo.stamp;
+    merge_reach(out, &r);
+    return false;
+}
+
+// Explore tous les mouvements de la pièce prise en from ; renvoie true si l'exploration s'est arrêtée
+static bool explore_pick(explorer *e, int from) {
+    size piece = e->game->pieces[e->game->square_index[from]].piece;
+
+    e->from = from;
+    e->occupied = e->game->occupied & ~((uint64_t)1 << from);
+    e->nb_steps = 0;
+    e->ends.land = 0;
+    e->ends.bounce = 0;
+    e->ends.goal = false;
+
+    //pièce prise directement sur la ligne du but
+    if (e->goal_line & ((uint64_t)1 << from))
+    {
+        if (reach_goal(e, NULL, 0)) return true;
+    }
+    reach r = { { 0, 0, false }, 0, 0 };
+    return explore(e, from, piece, 0, false, &r);
+}
+
+// Prépare l'exploration, renvoie la ligne active du joueur ou -1 s'il ne peut pas jouer
+static int start_explorer(explorer *e, board game, player p) {
+    if (game->winner != NO_PLAYER || game->picked_piece != NONE)
+    {
+        return -1;
+    }
+    e->game = game;
+    e->player = p;
+    e->goal_line = GOAL_LINE_MASK(p);
+
+    //le mémo ne sert que pour la grille et le joueur où il a été rempli
+    if (memo.key != game->key || memo.p != p || memo.stamp == 0)
+    {
+        memo.key = game->key;
+        memo.p = p;
+        if (++memo.stamp == 0)
+        {
+            //le numéro a fait le tour : les anciennes entrées pourraient redevenir valables
+            memset(memo.entries, 0, sizeof(memo.entries));
+            memo.stamp = 1;
+        }
+    }
+    e->stop_at_goal = false;
+    e->goal_only = false;
+    e->list = NULL;
+    e->nb_turns = 0;
+    e->max_turns = 0;
+    e->max_swaps = 0;
+    return eval_active_line(&game->features, p);
+}
+
+bool find_winning_turn(board game, player p, turn *out) {
+    explorer e;
+    int line = start_explorer(&e, game, p);
+    if (line < 0)
+    {
+        return false;
+    }
+
+    //seul le tour gagnant est écrit dans out
+    e.stop_at_goal = true;
+    e.goal_only = true;
+    e.list = out;
+    e.max_turns = 1;
+
+    for (int i = 0; i < game->nb_pieces; i++) {
+        int from = game->pieces[i].square;
+        if (SQUARE_LINE(from) == line && explore_pick(&e, from))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool pick_endpoints(board game, player p, int line, int column, endpoints *out) {
+    explorer e;
+    int active = start_explorer(&e, game, p);
+    if (active < 0 || line != active || column < 0 || column >= DIMENSION || game->grid[line][column] == NONE)
+    {
+        return false;
+    }
+
+    explore_pick(&e, SQUARE(line, column));
+    *out = e.ends;
+    return true;
+}
+
+int generate_turns(board game, player p, turn *list, int max_turns) {
+    return generate_turns_pruned(game, p, list, max_turns, 0);
+}
+
+int generate_turns_pruned(board game, player p, turn *list, int max_turns, int max_swaps) {
+    explorer e;
+    int line = start_explorer(&e, game, p);
+    if (line < 0)
+    {
+        return 0;
+    }
+
+    e.list = list;
+    e.max_turns = max_turns;
+    e.max_swaps = max_swaps;
+    for (int i = 0; i < game->nb_pieces; i++) {
+        int from = game->pieces[i].square;
+        if (SQUARE_LINE(from) == line)
+        {
+            explore_pick(&e, from);
+        }
+    }
+    return e.nb_turns;
+}
+
+uint64_t swap_targets(board game) {
+    //la pièce en main n'est pas dans occupied : sa case de départ est libre
+    return BOARD_MASK & ~game->occupied;
+}
+
+// Distance d'une ligne au but du joueur
+static inline int goal_distance(player p, int line) {
+    return (p == SOUTH_P) ? DIMENSION - 1 - line : line;
+}
+
+// Cases des chemins qui mènent une pièce de taille k, en main sur square, à la ligne du but du joueur :
+// les cases intermédiaires des chemins, et les arrivées des débuts de chemin sur la ligne du but
+static uint64_t goal_paths(int square, int k, uint64_t goal_line) {
+    uint64_t mask = 0;
+    int count;
+
+    for (int j = 1; j <= k; j++) {
+        const walk *w = walks_from(square, j, &count);
+        for (int i = 0; i < count; i++, w++) {
+            uint64_t land = (uint64_t)1 << WALK_LAND(w, j);
+            if (land & goal_line)
+            {
+                mask |= w->inter | (j < k ? land : 0);
+            }
+        }
+    }
+    return mask;
+}
+
+int rank_swap_targets(board game, player p, int from, int to, uint64_t targets, signed char *out) {
+    player opponent = next_player(p);
+    size displaced = game->grid[SQUARE_LINE(to)][SQUARE_COL(to)];
+    //pendant un mouvement, la pièce prise est en main ; entre deux tours, elle est encore sur from
+    size moved = (game->picked_piece != NONE) ? game->picked_piece : game->grid[SQUARE_LINE(from)][SQUARE_COL(from)];
+    int scores[NB_SQUARES];
+    int nb = 0;
+
+    //occupation après le tour, sans la pièce envoyée : la pièce prise a quitté from et occupe to
+    uint64_t occupied = (game->occupied & ~((uint64_t)1 << from)) | ((uint64_t)1 << to);
+    int line = (opponent == SOUTH_P) ? __builtin_ctzll(occupied) / DIMENSION : (63 - __builtin_clzll(occupied)) / DIMENSION;
+    int line_distance = goal_distance(opponent, line);
+
+    //chemins vers le but des pièces de la ligne active de l'adversaire
+    uint64_t paths = 0;
+    uint64_t active = occupied & LINE_MASK(line);
+    while (active != 0) {
+        int sq = __builtin_ctzll(active);
+        active &= active - 1;
+        size piece = (sq == to) ? moved : game->grid[SQUARE_LINE(sq)][SQUARE_COL(sq)];
+        paths |= goal_paths(sq, piece, GOAL_LINE_MASK(opponent));
+    }
+
+    targets &= BOARD_MASK & ~occupied;
+    while (targets != 0) {
+        int sq = __builtin_ctzll(targets);
+        targets &= targets - 1;
+
+        //loin du but adverse d'abord
+        int distance = goal_distance(opponent, SQUARE_LINE(sq));
+        int score = distance;
+        if (distance > line_distance)
+        {
+            //la pièce envoyée devient la seule pièce jouable de l'adversaire,
+            //d'autant mieux si elle est trop petite pour atteindre le but d'un coup
+            score += SWAP_SCORE_FORCE;
+            if ((int)displaced < distance)
+            {
+                score += SWAP_SCORE_FORCE / 2;
+            }
+        }
+        else if (distance == line_distance)
+        {
+            //une pièce de plus à la disposition de l'adversaire
+            score -= SWAP_SCORE_CROWD;
+        }
+        if (paths & ((uint64_t)1 << sq))
+        {
+            score += SWAP_SCORE_BLOCK;
+        }
+
+        //insertion à sa place, par score décroissant (à égalité, par case croissante)
+        int i = nb++;
+        while (i > 0 && scores[i - 1] < score) {
+            scores[i] = scores[i - 1];
+            out[i] = out[i - 1];
+            i--;
+        }
+        scores[i] = score;
+        out[i] = sq;
+    }
+    return nb;
+}
+
+return_code play_turn(board game, player p, const turn *t) {
+    return_code rc = pick_piece(game, p, SQUARE_LINE(t->from), SQUARE_COL(t->from));
+    if (rc != OK)
+    {
+        return rc;
+    }
+
+    for (int i = 0; i < t->nb_steps; i++) {
+        rc = move_piece(game, t->steps[i]);
+        if (rc != OK)
+        {
+            cancel_movement(game);
+            return rc;
+        }
+    }
+
+    if (t->swap_to != NO_SQUARE)
+    {
+        rc = swap_piece(game, SQUARE_LINE(t->swap_to), SQUARE_COL(t->swap_to));
+        if (rc != OK)
+        {
+            cancel_movement(game);
+            return rc;
+        }
+    }
+
+    //le tour doit laisser la main libre
+    if (picked_piece_owner(game) != NO_PLAYER)
+    {
+        cancel_movement(game);
+        return FORBIDDEN;
+    }
+    return OK;
+}
+
+size apply_turn(board game, player p, const turn *t) {
+    size moved = remove_piece(game, SQUARE_LINE(t->from), SQUARE_COL(t->from));
+
+    //la pièce entre dans le but et quitte le plateau
+    if (t->to == NO_SQUARE)
+    {
+        game->winner = p;
+        return moved;
+    }
+
+    //échange : la pièce rencontrée part sur la case choisie
+    if (t->swap_to != NO_SQUARE)
+    {
+        size under = remove_piece(game, SQUARE_LINE(t->to), SQUARE_COL(t->to));
+        put_piece(game, SQUARE_LINE(t->swap_to), SQUARE_COL(t->swap_to), under);
+    }
+
+    put_piece(game, SQUARE_LINE(t->to), SQUARE_COL(t->to), moved);
+    return moved;
+}
+
+void undo_turn(board game, const turn *t, size moved) {
+    if (t->to == NO_SQUARE)
+    {
+        game->winner = NO_PLAYER;
+    }
+    else
+    {
+        remove_piece(game, SQUARE_LINE(t->to), SQUARE_COL(t->to));
+        if (t->swap_to != NO_SQUARE)
+        {
+            size under = remove_piece(game, SQUARE_LINE(t->swap_to), SQUARE_COL(t->swap_to));
+            put_piece(game, SQUARE_LINE(t->to), SQUARE_COL(t->to), under);
+        }
+    }
+    put_piece(game, SQUARE_LINE(t->from), SQUARE_COL(t->from), moved);
+}
@@ -0,0 +1,199 @@
+#ifndef _TURN_H_
+#define _TURN_H_
+
+#include <stdint.h>
+#include "board.h"
+#include "board_tables.h"
+
+/**
+ * \file turn.h
+ *
+ * \brief Tours complets : choix de la pièce, suite de pas et échange éventuel.
+ *
+ * Un ::turn décrit tout ce qu'un joueur fait pendant son tour,
+ * sous une forme qui peut être rejouée avec les fonctions de board.h.
+ */
+
+/**
+ * @brief nombre maximal de pas d'un tour : chaque segment au plus une fois, plus le but.
+ */
+#define MAX_TURN_STEPS (NB_EDGES + 1)
+
+/**
+ * @brief Un tour complet.
+ *
+ * Les cases sont numérotées comme dans board_tables.h.
+ * Les rebonds sont implicites : un pas donné alors que la pièce est arrivée
+ * sur une autre pièce est un rebond.
+ */
+typedef struct {
+	signed char from; /**< case de la pièce prise */
+	signed char to; /**< case où la pièce termine, ::NO_SQUARE si elle entre dans le but */
+	signed char swap_to; /**< case où l'échange envoie la pièce rencontrée, ::NO_SQUARE sans échange */
+	unsigned char nb_steps; /**< nombre de pas */
+	unsigned char steps[MAX_TURN_STEPS]; /**< les ::direction successives, la dernière peut être ::GOAL */
+} turn;
+
+/**
+ * @brief nombre maximal de tours d'une position :
+ * 6 pièces, chacune avec au plus 25 arrivées, le but, et 11 échanges vers 25 cases.
+ */
+#define MAX_TURNS 2048
+
+/**
+ * @brief Arrivées possibles d'une pièce prise.
+ */
+typedef struct {
+	uint64_t land; /**< cases vides où la pièce peut terminer son mouvement */
+	uint64_t bounce; /**< cases occupées où la pièce peut s'arrêter (rebond ou échange) */
+	bool goal; /**< la pièce peut entrer dans le but adverse */
+} endpoints;
+
+/**
+ * @brief Calcule les arrivées possibles d'une pièce de la ligne active.
+ *
+ * Les chemins de la pièce sont ceux de walks.h, testés sur l'occupation du plateau,
+ * en suivant les rebonds.
+ * Les arrivées de chaque état (case, pas restants) sont mémorisées par thread
+ * tant que la grille ne change pas : les appels suivants sur la même position,
+ * et les chaînes de rebonds dont les arrivées sont déjà connues, ne sont pas reparcourus.
+ *
+ * @param game le plateau, entre deux tours.
+ * @param p le joueur qui a le trait.
+ * @param line la ligne de la pièce (la ligne active du joueur).
+ * @param column la colonne de la pièce.
+ * @param out reçoit les arrivées.
+ * @return false si la pièce ne peut pas être prise.
+ */
+bool pick_endpoints(board game, player p, int line, int column, endpoints *out);
+
+/**
+ * @brief Génère les tours possibles du joueur.
+ *
+ * Deux chemins qui mènent à la même arrivée ne donnent qu'un seul tour :
+ * il y a un tour par arrivée sur une case vide, un par couple
+ * (pièce rencontrée, case vide de l'échange), et un pour le but.
+ * Des tours différents peuvent néanmoins donner la même position (échange entre
+ * deux pièces de même taille, échange vers la case de départ) : ils ne sont pas fusionnés.
+ *
+ * @param game le plateau, entre deux tours.
+ * @param p le joueur qui a le trait.
+ * @param list tableau recevant les tours.
+ * @param max_turns taille du tableau (::MAX_TURNS suffit toujours).
+ * @return le nombre de tours écrits.
+ */
+int generate_turns(board game, player p, turn *list, int max_turns);
+
+/**
+ * @brief Génère les tours possibles du joueur, en ne gardant que les meilleurs échanges.
+ *
+ * Comme ::generate_turns, mais pour chaque pièce rencontrée seules les max_swaps
+ * premières cases de ::rank_swap_targets donnent un tour d'échange.
+ *
+ * @param game le plateau, entre deux tours.
+ * @param p le joueur qui a le trait.
+ * @param list tableau recevant les tours.
+ * @param max_turns taille du tableau.
+ * @param max_swaps nombre d'échanges gardés par pièce rencontrée, 0 pour tous les garder.
+ * @return le nombre de tours écrits.
+ */
+int generate_turns_pruned(board game, player p, turn *list, int max_turns, int max_swaps);
+
+/**
+ * @brief Cases où un échange peut envoyer la pièce rencontrée.
+ *
+ * Ce sont les cases vides de la grille ; pendant un mouvement, la case de départ
+ * de la pièce en main est libre et en fait partie.
+ *
+ * @param game le plateau.
+ * @return un bit par case (numérotation de board_tables.h).
+ */
+uint64_t swap_targets(board game);
+
+/**
+ * @brief poids des critères de ::rank_swap_targets : la pièce envoyée devient la seule pièce
+ * jouable de l'adversaire.
+ */
+#define SWAP_SCORE_FORCE (4 * DIMENSION)
+
+/**
+ * @brief poids des critères de ::rank_swap_targets : la pièce envoyée coupe un chemin
+ * de l'adversaire vers son but.
+ */
+#define SWAP_SCORE_BLOCK (2 * DIMENSION)
+
+/**
+ * @brief poids des critères de ::rank_swap_targets : la pièce envoyée s'ajoute
+ * à la ligne active de l'adversaire (pénalité).
+ */
+#define SWAP_SCORE_CROWD DIMENSION
+
+/**
+ * @brief Classe les cases d'un échange de la plus prometteuse à la moins prometteuse.
+ *
+ * Le classement est une heuristique rapide, sans jouer le tour : il préfère les cases
+ * loin du but de l'adversaire, celles qui font de la pièce envoyée la seule pièce jouable
+ * de l'adversaire, et celles qui coupent les chemins vers son but des pièces de sa ligne active ;
+ * il évite d'ajouter une pièce à cette ligne.
+ *
+ * @param game le plateau, entre deux tours ou pendant le mouvement.
+ * @param p le joueur qui joue le tour.
+ * @param from la case de départ de la pièce prise.
+ * @param to la case de la pièce rencontrée, où la pièce prise termine.
+ * @param targets les cases candidates, par exemple ::swap_targets ; les cases occupées sont ignorées.
+ * @param out reçoit les cases, dans l'ordre du classement (::NB_SQUARES au plus).
+ * @return le nombre de cases écrites.
+ */
+int rank_swap_targets(board game, player p, int from, int to, uint64_t targets, signed char *out);
+
+/**
+ * @brief Cherche un tour gagnant immédiatement pour le joueur.
+ *
+ * Le plateau doit être entre deux tours (aucune pièce en main).
+ * La recherche parcourt les chemins précalculés (walks.h) de chaque pièce de la ligne
+ * active et s'arrête au premier chemin qui permet de jouer ::GOAL,
+ * sans générer les autres tours. Le plateau n'est pas modifié.
+ *
+ * @param game le plateau.
+ * @param p le joueur qui a le trait.
+ * @param out si non NULL, reçoit le tour gagnant trouvé.
+ * @return true si un tour gagnant existe.
+ */
+bool find_winning_turn(board game, player p, turn *out);
+
+/**
+ * @brief Joue un tour avec les fonctions de board.h.
+ *
+ * En cas d'échec, le mouvement en cours est annulé et le plateau est
+ * remis dans l'état du début du tour.
+ *
+ * @param game le plateau.
+ * @param p le joueur qui joue.
+ * @param t le tour à jouer.
+ * @return ::OK, ou le premier ::return_code en erreur.
+ */
+return_code play_turn(board game, player p, const turn *t);
+
+/**
+ * @brief Applique directement le résultat d'un tour, sans rejouer ses pas.
+ *
+ * Réservé à la recherche : le tour doit venir de ::generate_turns ou
+ * ::find_winning_turn sur ce même plateau. Seuls from, to et swap_to sont lus.
+ * Un tour qui entre dans le but désigne p comme gagnant.
+ *
+ * @param game le plateau, entre deux tours.
+ * @param p le joueur qui joue.
+ * @param t le tour.
+ * @return la ::size de la pièce jouée, à passer à ::undo_turn.
+ */
+size apply_turn(board game, player p, const turn *t);
+
+/**
+ * @brief Annule un tour appliqué par ::apply_turn.
+ * @param game le plateau.
+ * @param t le tour appliqué.
+ * @param moved la ::size renvoyée par ::apply_turn.
+ */
+void undo_turn(board game, const turn *t, size moved);
+
+#endif /*_TURN_H_*/
@@ -0,0 +1,69 @@
+#ifndef _WALKS_H_
+#define _WALKS_H_
+
+#include <stdint.h>
+#include "board.h"
+#include "board_tables.h"
+
+/**
+ * \file walks.h
+ *
+ * \brief Chemins précalculés d'une pièce, pour chaque case et chaque taille.
+ *
+ * Une pièce de taille k fait exactement k pas sans repasser par un segment,
+ * et seul son dernier pas peut arriver sur une case occupée.
+ * Pour chaque case et chaque k de 1 à 3, la table liste tous ces chemins :
+ * un chemin est possible si ses cases intermédiaires sont vides
+ * et si aucun de ses segments n'a déjà été emprunté,
+ * ce qui se vérifie avec deux tests de masques.
+ *
+ * La table (walks_table.c) est générée hors ligne par gen_walks.c :
+ * \code
+ * gcc gen_walks.c board_tables.c -o gen_walks && ./gen_walks > walks_table.c
+ * \endcode
+ * Elle doit être régénérée si ::DIMENSION change ; walks_table_4.c est la table
+ * du plateau 4x4 des variantes réduites (voir tablebase.h) :
+ * \code
+ * gcc -DDIMENSION=4 gen_walks.c board_tables.c -o gen_walks && ./gen_walks > walks_table_4.c
+ * \endcode
+ */
+
+/**
+ * @brief Un chemin de k pas depuis une case.
+ */
+typedef struct {
+	uint64_t inter; /**< cases intermédiaires, qui doivent être vides */
+	uint64_t edges; /**< segments empruntés */
+	signed char squares[NB_SIZE]; /**< cases successives, la k-ième est l'arrivée */
+	unsigned char dirs[NB_SIZE]; /**< ::direction de chaque pas */
+} walk;
+
+/**
+ * @brief tous les chemins, rangés par case puis par taille.
+ */
+extern const walk walk_table[];
+
+/**
+ * @brief les chemins de taille k depuis la case sq sont
+ * walk_table[walk_first[sq][k]] à walk_table[walk_first[sq][k + 1] - 1].
+ */
+extern const unsigned short walk_first[NB_SQUARES][NB_SIZE + 2];
+
+/**
+ * @brief Renvoie le premier chemin de taille k depuis une case.
+ * @param square la case de départ.
+ * @param k le nombre de pas (de 1 à 3).
+ * @param count reçoit le nombre de chemins.
+ * @return le premier chemin de la liste.
+ */
+static inline const walk *walks_from(int square, int k, int *count) {
+	*count = walk_first[square][k + 1] - walk_first[square][k];
+	return &walk_table[walk_first[square][k]];
+}
+
+/**
+ * @brief Case d'arrivée d'un chemin de taille k.
+ */
+#define WALK_LAND(w, k) ((w)->squares[(k) - 1])
+
+#endif /*_WALKS_H_*/
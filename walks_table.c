@@ -0,0 +1,1216 @@
+// Fichier généré par gen_walks.c, ne pas modifier à la main.
+#include "walks.h"
+
+#if DIMENSION != 6
+#error "table générée pour DIMENSION 6 : relancer gen_walks"
+#endif
+
+const walk walk_table[1168] = {
+    { 0x0ULL, 0x40000000ULL, { 6, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x1ULL, { 1, -1, -1 }, { 3, 0, 0 } },
+    { 0x40ULL, 0x1040000000ULL, { 6, 12, -1 }, { 2, 2, 0 } },
+    { 0x40ULL, 0x40000020ULL, { 6, 7, -1 }, { 2, 3, 0 } },
+    { 0x2ULL, 0x80000001ULL, { 1, 7, -1 }, { 3, 2, 0 } },
+    { 0x2ULL, 0x3ULL, { 1, 2, -1 }, { 3, 3, 0 } },
+    { 0x1040ULL, 0x41040000000ULL, { 6, 12, 18 }, { 2, 2, 2 } },
+    { 0x1040ULL, 0x1040000400ULL, { 6, 12, 13 }, { 2, 2, 3 } },
+    { 0xc0ULL, 0xc0000020ULL, { 6, 7, 1 }, { 2, 3, 1 } },
+    { 0xc0ULL, 0x2040000020ULL, { 6, 7, 13 }, { 2, 3, 2 } },
+    { 0xc0ULL, 0x40000060ULL, { 6, 7, 8 }, { 2, 3, 3 } },
+    { 0x82ULL, 0x2080000001ULL, { 1, 7, 13 }, { 3, 2, 2 } },
+    { 0x82ULL, 0x80000041ULL, { 1, 7, 8 }, { 3, 2, 3 } },
+    { 0x82ULL, 0x80000021ULL, { 1, 7, 6 }, { 3, 2, 4 } },
+    { 0x6ULL, 0x100000003ULL, { 1, 2, 8 }, { 3, 3, 2 } },
+    { 0x6ULL, 0x7ULL, { 1, 2, 3 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x80000000ULL, { 7, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x2ULL, { 2, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x1ULL, { 0, -1, -1 }, { 4, 0, 0 } },
+    { 0x80ULL, 0x2080000000ULL, { 7, 13, -1 }, { 2, 2, 0 } },
+    { 0x80ULL, 0x80000040ULL, { 7, 8, -1 }, { 2, 3, 0 } },
+    { 0x80ULL, 0x80000020ULL, { 7, 6, -1 }, { 2, 4, 0 } },
+    { 0x4ULL, 0x100000002ULL, { 2, 8, -1 }, { 3, 2, 0 } },
+    { 0x4ULL, 0x6ULL, { 2, 3, -1 }, { 3, 3, 0 } },
+    { 0x1ULL, 0x40000001ULL, { 0, 6, -1 }, { 4, 2, 0 } },
+    { 0x2080ULL, 0x82080000000ULL, { 7, 13, 19 }, { 2, 2, 2 } },
+    { 0x2080ULL, 0x2080000800ULL, { 7, 13, 14 }, { 2, 2, 3 } },
+    { 0x2080ULL, 0x2080000400ULL, { 7, 13, 12 }, { 2, 2, 4 } },
+    { 0x180ULL, 0x180000040ULL, { 7, 8, 2 }, { 2, 3, 1 } },
+    { 0x180ULL, 0x4080000040ULL, { 7, 8, 14 }, { 2, 3, 2 } },
+    { 0x180ULL, 0x800000c0ULL, { 7, 8, 9 }, { 2, 3, 3 } },
+    { 0xc0ULL, 0xc0000020ULL, { 7, 6, 0 }, { 2, 4, 1 } },
+    { 0xc0ULL, 0x1080000020ULL, { 7, 6, 12 }, { 2, 4, 2 } },
+    { 0x104ULL, 0x4100000002ULL, { 2, 8, 14 }, { 3, 2, 2 } },
+    { 0x104ULL, 0x100000082ULL, { 2, 8, 9 }, { 3, 2, 3 } },
+    { 0x104ULL, 0x100000042ULL, { 2, 8, 7 }, { 3, 2, 4 } },
+    { 0xcULL, 0x200000006ULL, { 2, 3, 9 }, { 3, 3, 2 } },
+    { 0xcULL, 0xeULL, { 2, 3, 4 }, { 3, 3, 3 } },
+    { 0x41ULL, 0x1040000001ULL, { 0, 6, 12 }, { 4, 2, 2 } },
+    { 0x41ULL, 0x40000021ULL, { 0, 6, 7 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x100000000ULL, { 8, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x4ULL, { 3, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x2ULL, { 1, -1, -1 }, { 4, 0, 0 } },
+    { 0x100ULL, 0x4100000000ULL, { 8, 14, -1 }, { 2, 2, 0 } },
+    { 0x100ULL, 0x100000080ULL, { 8, 9, -1 }, { 2, 3, 0 } },
+    { 0x100ULL, 0x100000040ULL, { 8, 7, -1 }, { 2, 4, 0 } },
+    { 0x8ULL, 0x200000004ULL, { 3, 9, -1 }, { 3, 2, 0 } },
+    { 0x8ULL, 0xcULL, { 3, 4, -1 }, { 3, 3, 0 } },
+    { 0x2ULL, 0x80000002ULL, { 1, 7, -1 }, { 4, 2, 0 } },
+    { 0x2ULL, 0x3ULL, { 1, 0, -1 }, { 4, 4, 0 } },
+    { 0x4100ULL, 0x104100000000ULL, { 8, 14, 20 }, { 2, 2, 2 } },
+    { 0x4100ULL, 0x4100001000ULL, { 8, 14, 15 }, { 2, 2, 3 } },
+    { 0x4100ULL, 0x4100000800ULL, { 8, 14, 13 }, { 2, 2, 4 } },
+    { 0x300ULL, 0x300000080ULL, { 8, 9, 3 }, { 2, 3, 1 } },
+    { 0x300ULL, 0x8100000080ULL, { 8, 9, 15 }, { 2, 3, 2 } },
+    { 0x300ULL, 0x100000180ULL, { 8, 9, 10 }, { 2, 3, 3 } },
+    { 0x180ULL, 0x180000040ULL, { 8, 7, 1 }, { 2, 4, 1 } },
+    { 0x180ULL, 0x2100000040ULL, { 8, 7, 13 }, { 2, 4, 2 } },
+    { 0x180ULL, 0x100000060ULL, { 8, 7, 6 }, { 2, 4, 4 } },
+    { 0x208ULL, 0x8200000004ULL, { 3, 9, 15 }, { 3, 2, 2 } },
+    { 0x208ULL, 0x200000104ULL, { 3, 9, 10 }, { 3, 2, 3 } },
+    { 0x208ULL, 0x200000084ULL, { 3, 9, 8 }, { 3, 2, 4 } },
+    { 0x18ULL, 0x40000000cULL, { 3, 4, 10 }, { 3, 3, 2 } },
+    { 0x18ULL, 0x1cULL, { 3, 4, 5 }, { 3, 3, 3 } },
+    { 0x82ULL, 0x2080000002ULL, { 1, 7, 13 }, { 4, 2, 2 } },
+    { 0x82ULL, 0x80000042ULL, { 1, 7, 8 }, { 4, 2, 3 } },
+    { 0x82ULL, 0x80000022ULL, { 1, 7, 6 }, { 4, 2, 4 } },
+    { 0x3ULL, 0x40000003ULL, { 1, 0, 6 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x200000000ULL, { 9, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x8ULL, { 4, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x4ULL, { 2, -1, -1 }, { 4, 0, 0 } },
+    { 0x200ULL, 0x8200000000ULL, { 9, 15, -1 }, { 2, 2, 0 } },
+    { 0x200ULL, 0x200000100ULL, { 9, 10, -1 }, { 2, 3, 0 } },
+    { 0x200ULL, 0x200000080ULL, { 9, 8, -1 }, { 2, 4, 0 } },
+    { 0x10ULL, 0x400000008ULL, { 4, 10, -1 }, { 3, 2, 0 } },
+    { 0x10ULL, 0x18ULL, { 4, 5, -1 }, { 3, 3, 0 } },
+    { 0x4ULL, 0x100000004ULL, { 2, 8, -1 }, { 4, 2, 0 } },
+    { 0x4ULL, 0x6ULL, { 2, 1, -1 }, { 4, 4, 0 } },
+    { 0x8200ULL, 0x208200000000ULL, { 9, 15, 21 }, { 2, 2, 2 } },
+    { 0x8200ULL, 0x8200002000ULL, { 9, 15, 16 }, { 2, 2, 3 } },
+    { 0x8200ULL, 0x8200001000ULL, { 9, 15, 14 }, { 2, 2, 4 } },
+    { 0x600ULL, 0x600000100ULL, { 9, 10, 4 }, { 2, 3, 1 } },
+    { 0x600ULL, 0x10200000100ULL, { 9, 10, 16 }, { 2, 3, 2 } },
+    { 0x600ULL, 0x200000300ULL, { 9, 10, 11 }, { 2, 3, 3 } },
+    { 0x300ULL, 0x300000080ULL, { 9, 8, 2 }, { 2, 4, 1 } },
+    { 0x300ULL, 0x4200000080ULL, { 9, 8, 14 }, { 2, 4, 2 } },
+    { 0x300ULL, 0x2000000c0ULL, { 9, 8, 7 }, { 2, 4, 4 } },
+    { 0x410ULL, 0x10400000008ULL, { 4, 10, 16 }, { 3, 2, 2 } },
+    { 0x410ULL, 0x400000208ULL, { 4, 10, 11 }, { 3, 2, 3 } },
+    { 0x410ULL, 0x400000108ULL, { 4, 10, 9 }, { 3, 2, 4 } },
+    { 0x30ULL, 0x800000018ULL, { 4, 5, 11 }, { 3, 3, 2 } },
+    { 0x104ULL, 0x4100000004ULL, { 2, 8, 14 }, { 4, 2, 2 } },
+    { 0x104ULL, 0x100000084ULL, { 2, 8, 9 }, { 4, 2, 3 } },
+    { 0x104ULL, 0x100000044ULL, { 2, 8, 7 }, { 4, 2, 4 } },
+    { 0x6ULL, 0x80000006ULL, { 2, 1, 7 }, { 4, 4, 2 } },
+    { 0x6ULL, 0x7ULL, { 2, 1, 0 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x400000000ULL, { 10, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x10ULL, { 5, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x8ULL, { 3, -1, -1 }, { 4, 0, 0 } },
+    { 0x400ULL, 0x10400000000ULL, { 10, 16, -1 }, { 2, 2, 0 } },
+    { 0x400ULL, 0x400000200ULL, { 10, 11, -1 }, { 2, 3, 0 } },
+    { 0x400ULL, 0x400000100ULL, { 10, 9, -1 }, { 2, 4, 0 } },
+    { 0x20ULL, 0x800000010ULL, { 5, 11, -1 }, { 3, 2, 0 } },
+    { 0x8ULL, 0x200000008ULL, { 3, 9, -1 }, { 4, 2, 0 } },
+    { 0x8ULL, 0xcULL, { 3, 2, -1 }, { 4, 4, 0 } },
+    { 0x10400ULL, 0x410400000000ULL, { 10, 16, 22 }, { 2, 2, 2 } },
+    { 0x10400ULL, 0x10400004000ULL, { 10, 16, 17 }, { 2, 2, 3 } },
+    { 0x10400ULL, 0x10400002000ULL, { 10, 16, 15 }, { 2, 2, 4 } },
+    { 0xc00ULL, 0xc00000200ULL, { 10, 11, 5 }, { 2, 3, 1 } },
+    { 0xc00ULL, 0x20400000200ULL, { 10, 11, 17 }, { 2, 3, 2 } },
+    { 0x600ULL, 0x600000100ULL, { 10, 9, 3 }, { 2, 4, 1 } },
+    { 0x600ULL, 0x8400000100ULL, { 10, 9, 15 }, { 2, 4, 2 } },
+    { 0x600ULL, 0x400000180ULL, { 10, 9, 8 }, { 2, 4, 4 } },
+    { 0x820ULL, 0x20800000010ULL, { 5, 11, 17 }, { 3, 2, 2 } },
+    { 0x820ULL, 0x800000210ULL, { 5, 11, 10 }, { 3, 2, 4 } },
+    { 0x208ULL, 0x8200000008ULL, { 3, 9, 15 }, { 4, 2, 2 } },
+    { 0x208ULL, 0x200000108ULL, { 3, 9, 10 }, { 4, 2, 3 } },
+    { 0x208ULL, 0x200000088ULL, { 3, 9, 8 }, { 4, 2, 4 } },
+    { 0xcULL, 0x10000000cULL, { 3, 2, 8 }, { 4, 4, 2 } },
+    { 0xcULL, 0xeULL, { 3, 2, 1 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x800000000ULL, { 11, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x10ULL, { 4, -1, -1 }, { 4, 0, 0 } },
+    { 0x800ULL, 0x20800000000ULL, { 11, 17, -1 }, { 2, 2, 0 } },
+    { 0x800ULL, 0x800000200ULL, { 11, 10, -1 }, { 2, 4, 0 } },
+    { 0x10ULL, 0x400000010ULL, { 4, 10, -1 }, { 4, 2, 0 } },
+    { 0x10ULL, 0x18ULL, { 4, 3, -1 }, { 4, 4, 0 } },
+    { 0x20800ULL, 0x820800000000ULL, { 11, 17, 23 }, { 2, 2, 2 } },
+    { 0x20800ULL, 0x20800004000ULL, { 11, 17, 16 }, { 2, 2, 4 } },
+    { 0xc00ULL, 0xc00000200ULL, { 11, 10, 4 }, { 2, 4, 1 } },
+    { 0xc00ULL, 0x10800000200ULL, { 11, 10, 16 }, { 2, 4, 2 } },
+    { 0xc00ULL, 0x800000300ULL, { 11, 10, 9 }, { 2, 4, 4 } },
+    { 0x410ULL, 0x10400000010ULL, { 4, 10, 16 }, { 4, 2, 2 } },
+    { 0x410ULL, 0x400000210ULL, { 4, 10, 11 }, { 4, 2, 3 } },
+    { 0x410ULL, 0x400000110ULL, { 4, 10, 9 }, { 4, 2, 4 } },
+    { 0x18ULL, 0x200000018ULL, { 4, 3, 9 }, { 4, 4, 2 } },
+    { 0x18ULL, 0x1cULL, { 4, 3, 2 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x40000000ULL, { 0, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x1000000000ULL, { 12, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x20ULL, { 7, -1, -1 }, { 3, 0, 0 } },
+    { 0x1ULL, 0x40000001ULL, { 0, 1, -1 }, { 1, 3, 0 } },
+    { 0x1000ULL, 0x41000000000ULL, { 12, 18, -1 }, { 2, 2, 0 } },
+    { 0x1000ULL, 0x1000000400ULL, { 12, 13, -1 }, { 2, 3, 0 } },
+    { 0x80ULL, 0x80000020ULL, { 7, 1, -1 }, { 3, 1, 0 } },
+    { 0x80ULL, 0x2000000020ULL, { 7, 13, -1 }, { 3, 2, 0 } },
+    { 0x80ULL, 0x60ULL, { 7, 8, -1 }, { 3, 3, 0 } },
+    { 0x3ULL, 0xc0000001ULL, { 0, 1, 7 }, { 1, 3, 2 } },
+    { 0x3ULL, 0x40000003ULL, { 0, 1, 2 }, { 1, 3, 3 } },
+    { 0x41000ULL, 0x1041000000000ULL, { 12, 18, 24 }, { 2, 2, 2 } },
+    { 0x41000ULL, 0x41000008000ULL, { 12, 18, 19 }, { 2, 2, 3 } },
+    { 0x3000ULL, 0x3000000400ULL, { 12, 13, 7 }, { 2, 3, 1 } },
+    { 0x3000ULL, 0x81000000400ULL, { 12, 13, 19 }, { 2, 3, 2 } },
+    { 0x3000ULL, 0x1000000c00ULL, { 12, 13, 14 }, { 2, 3, 3 } },
+    { 0x82ULL, 0x80000022ULL, { 7, 1, 2 }, { 3, 1, 3 } },
+    { 0x82ULL, 0x80000021ULL, { 7, 1, 0 }, { 3, 1, 4 } },
+    { 0x2080ULL, 0x82000000020ULL, { 7, 13, 19 }, { 3, 2, 2 } },
+    { 0x2080ULL, 0x2000000820ULL, { 7, 13, 14 }, { 3, 2, 3 } },
+    { 0x2080ULL, 0x2000000420ULL, { 7, 13, 12 }, { 3, 2, 4 } },
+    { 0x180ULL, 0x100000060ULL, { 7, 8, 2 }, { 3, 3, 1 } },
+    { 0x180ULL, 0x4000000060ULL, { 7, 8, 14 }, { 3, 3, 2 } },
+    { 0x180ULL, 0xe0ULL, { 7, 8, 9 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x80000000ULL, { 1, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x2000000000ULL, { 13, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x40ULL, { 8, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x20ULL, { 6, -1, -1 }, { 4, 0, 0 } },
+    { 0x2ULL, 0x80000002ULL, { 1, 2, -1 }, { 1, 3, 0 } },
+    { 0x2ULL, 0x80000001ULL, { 1, 0, -1 }, { 1, 4, 0 } },
+    { 0x2000ULL, 0x82000000000ULL, { 13, 19, -1 }, { 2, 2, 0 } },
+    { 0x2000ULL, 0x2000000800ULL, { 13, 14, -1 }, { 2, 3, 0 } },
+    { 0x2000ULL, 0x2000000400ULL, { 13, 12, -1 }, { 2, 4, 0 } },
+    { 0x100ULL, 0x100000040ULL, { 8, 2, -1 }, { 3, 1, 0 } },
+    { 0x100ULL, 0x4000000040ULL, { 8, 14, -1 }, { 3, 2, 0 } },
+    { 0x100ULL, 0xc0ULL, { 8, 9, -1 }, { 3, 3, 0 } },
+    { 0x40ULL, 0x40000020ULL, { 6, 0, -1 }, { 4, 1, 0 } },
+    { 0x40ULL, 0x1000000020ULL, { 6, 12, -1 }, { 4, 2, 0 } },
+    { 0x6ULL, 0x180000002ULL, { 1, 2, 8 }, { 1, 3, 2 } },
+    { 0x6ULL, 0x80000006ULL, { 1, 2, 3 }, { 1, 3, 3 } },
+    { 0x3ULL, 0xc0000001ULL, { 1, 0, 6 }, { 1, 4, 2 } },
+    { 0x82000ULL, 0x2082000000000ULL, { 13, 19, 25 }, { 2, 2, 2 } },
+    { 0x82000ULL, 0x82000010000ULL, { 13, 19, 20 }, { 2, 2, 3 } },
+    { 0x82000ULL, 0x82000008000ULL, { 13, 19, 18 }, { 2, 2, 4 } },
+    { 0x6000ULL, 0x6000000800ULL, { 13, 14, 8 }, { 2, 3, 1 } },
+    { 0x6000ULL, 0x102000000800ULL, { 13, 14, 20 }, { 2, 3, 2 } },
+    { 0x6000ULL, 0x2000001800ULL, { 13, 14, 15 }, { 2, 3, 3 } },
+    { 0x3000ULL, 0x3000000400ULL, { 13, 12, 6 }, { 2, 4, 1 } },
+    { 0x3000ULL, 0x42000000400ULL, { 13, 12, 18 }, { 2, 4, 2 } },
+    { 0x104ULL, 0x100000044ULL, { 8, 2, 3 }, { 3, 1, 3 } },
+    { 0x104ULL, 0x100000042ULL, { 8, 2, 1 }, { 3, 1, 4 } },
+    { 0x4100ULL, 0x104000000040ULL, { 8, 14, 20 }, { 3, 2, 2 } },
+    { 0x4100ULL, 0x4000001040ULL, { 8, 14, 15 }, { 3, 2, 3 } },
+    { 0x4100ULL, 0x4000000840ULL, { 8, 14, 13 }, { 3, 2, 4 } },
+    { 0x300ULL, 0x2000000c0ULL, { 8, 9, 3 }, { 3, 3, 1 } },
+    { 0x300ULL, 0x80000000c0ULL, { 8, 9, 15 }, { 3, 3, 2 } },
+    { 0x300ULL, 0x1c0ULL, { 8, 9, 10 }, { 3, 3, 3 } },
+    { 0x41ULL, 0x40000021ULL, { 6, 0, 1 }, { 4, 1, 3 } },
+    { 0x1040ULL, 0x41000000020ULL, { 6, 12, 18 }, { 4, 2, 2 } },
+    { 0x1040ULL, 0x1000000420ULL, { 6, 12, 13 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x100000000ULL, { 2, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x4000000000ULL, { 14, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x80ULL, { 9, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x40ULL, { 7, -1, -1 }, { 4, 0, 0 } },
+    { 0x4ULL, 0x100000004ULL, { 2, 3, -1 }, { 1, 3, 0 } },
+    { 0x4ULL, 0x100000002ULL, { 2, 1, -1 }, { 1, 4, 0 } },
+    { 0x4000ULL, 0x104000000000ULL, { 14, 20, -1 }, { 2, 2, 0 } },
+    { 0x4000ULL, 0x4000001000ULL, { 14, 15, -1 }, { 2, 3, 0 } },
+    { 0x4000ULL, 0x4000000800ULL, { 14, 13, -1 }, { 2, 4, 0 } },
+    { 0x200ULL, 0x200000080ULL, { 9, 3, -1 }, { 3, 1, 0 } },
+    { 0x200ULL, 0x8000000080ULL, { 9, 15, -1 }, { 3, 2, 0 } },
+    { 0x200ULL, 0x180ULL, { 9, 10, -1 }, { 3, 3, 0 } },
+    { 0x80ULL, 0x80000040ULL, { 7, 1, -1 }, { 4, 1, 0 } },
+    { 0x80ULL, 0x2000000040ULL, { 7, 13, -1 }, { 4, 2, 0 } },
+    { 0x80ULL, 0x60ULL, { 7, 6, -1 }, { 4, 4, 0 } },
+    { 0xcULL, 0x300000004ULL, { 2, 3, 9 }, { 1, 3, 2 } },
+    { 0xcULL, 0x10000000cULL, { 2, 3, 4 }, { 1, 3, 3 } },
+    { 0x6ULL, 0x180000002ULL, { 2, 1, 7 }, { 1, 4, 2 } },
+    { 0x6ULL, 0x100000003ULL, { 2, 1, 0 }, { 1, 4, 4 } },
+    { 0x104000ULL, 0x4104000000000ULL, { 14, 20, 26 }, { 2, 2, 2 } },
+    { 0x104000ULL, 0x104000020000ULL, { 14, 20, 21 }, { 2, 2, 3 } },
+    { 0x104000ULL, 0x104000010000ULL, { 14, 20, 19 }, { 2, 2, 4 } },
+    { 0xc000ULL, 0xc000001000ULL, { 14, 15, 9 }, { 2, 3, 1 } },
+    { 0xc000ULL, 0x204000001000ULL, { 14, 15, 21 }, { 2, 3, 2 } },
+    { 0xc000ULL, 0x4000003000ULL, { 14, 15, 16 }, { 2, 3, 3 } },
+    { 0x6000ULL, 0x6000000800ULL, { 14, 13, 7 }, { 2, 4, 1 } },
+    { 0x6000ULL, 0x84000000800ULL, { 14, 13, 19 }, { 2, 4, 2 } },
+    { 0x6000ULL, 0x4000000c00ULL, { 14, 13, 12 }, { 2, 4, 4 } },
+    { 0x208ULL, 0x200000088ULL, { 9, 3, 4 }, { 3, 1, 3 } },
+    { 0x208ULL, 0x200000084ULL, { 9, 3, 2 }, { 3, 1, 4 } },
+    { 0x8200ULL, 0x208000000080ULL, { 9, 15, 21 }, { 3, 2, 2 } },
+    { 0x8200ULL, 0x8000002080ULL, { 9, 15, 16 }, { 3, 2, 3 } },
+    { 0x8200ULL, 0x8000001080ULL, { 9, 15, 14 }, { 3, 2, 4 } },
+    { 0x600ULL, 0x400000180ULL, { 9, 10, 4 }, { 3, 3, 1 } },
+    { 0x600ULL, 0x10000000180ULL, { 9, 10, 16 }, { 3, 3, 2 } },
+    { 0x600ULL, 0x380ULL, { 9, 10, 11 }, { 3, 3, 3 } },
+    { 0x82ULL, 0x80000042ULL, { 7, 1, 2 }, { 4, 1, 3 } },
+    { 0x82ULL, 0x80000041ULL, { 7, 1, 0 }, { 4, 1, 4 } },
+    { 0x2080ULL, 0x82000000040ULL, { 7, 13, 19 }, { 4, 2, 2 } },
+    { 0x2080ULL, 0x2000000840ULL, { 7, 13, 14 }, { 4, 2, 3 } },
+    { 0x2080ULL, 0x2000000440ULL, { 7, 13, 12 }, { 4, 2, 4 } },
+    { 0xc0ULL, 0x40000060ULL, { 7, 6, 0 }, { 4, 4, 1 } },
+    { 0xc0ULL, 0x1000000060ULL, { 7, 6, 12 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x200000000ULL, { 3, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x8000000000ULL, { 15, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x100ULL, { 10, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x80ULL, { 8, -1, -1 }, { 4, 0, 0 } },
+    { 0x8ULL, 0x200000008ULL, { 3, 4, -1 }, { 1, 3, 0 } },
+    { 0x8ULL, 0x200000004ULL, { 3, 2, -1 }, { 1, 4, 0 } },
+    { 0x8000ULL, 0x208000000000ULL, { 15, 21, -1 }, { 2, 2, 0 } },
+    { 0x8000ULL, 0x8000002000ULL, { 15, 16, -1 }, { 2, 3, 0 } },
+    { 0x8000ULL, 0x8000001000ULL, { 15, 14, -1 }, { 2, 4, 0 } },
+    { 0x400ULL, 0x400000100ULL, { 10, 4, -1 }, { 3, 1, 0 } },
+    { 0x400ULL, 0x10000000100ULL, { 10, 16, -1 }, { 3, 2, 0 } },
+    { 0x400ULL, 0x300ULL, { 10, 11, -1 }, { 3, 3, 0 } },
+    { 0x100ULL, 0x100000080ULL, { 8, 2, -1 }, { 4, 1, 0 } },
+    { 0x100ULL, 0x4000000080ULL, { 8, 14, -1 }, { 4, 2, 0 } },
+    { 0x100ULL, 0xc0ULL, { 8, 7, -1 }, { 4, 4, 0 } },
+    { 0x18ULL, 0x600000008ULL, { 3, 4, 10 }, { 1, 3, 2 } },
+    { 0x18ULL, 0x200000018ULL, { 3, 4, 5 }, { 1, 3, 3 } },
+    { 0xcULL, 0x300000004ULL, { 3, 2, 8 }, { 1, 4, 2 } },
+    { 0xcULL, 0x200000006ULL, { 3, 2, 1 }, { 1, 4, 4 } },
+    { 0x208000ULL, 0x8208000000000ULL, { 15, 21, 27 }, { 2, 2, 2 } },
+    { 0x208000ULL, 0x208000040000ULL, { 15, 21, 22 }, { 2, 2, 3 } },
+    { 0x208000ULL, 0x208000020000ULL, { 15, 21, 20 }, { 2, 2, 4 } },
+    { 0x18000ULL, 0x18000002000ULL, { 15, 16, 10 }, { 2, 3, 1 } },
+    { 0x18000ULL, 0x408000002000ULL, { 15, 16, 22 }, { 2, 3, 2 } },
+    { 0x18000ULL, 0x8000006000ULL, { 15, 16, 17 }, { 2, 3, 3 } },
+    { 0xc000ULL, 0xc000001000ULL, { 15, 14, 8 }, { 2, 4, 1 } },
+    { 0xc000ULL, 0x108000001000ULL, { 15, 14, 20 }, { 2, 4, 2 } },
+    { 0xc000ULL, 0x8000001800ULL, { 15, 14, 13 }, { 2, 4, 4 } },
+    { 0x410ULL, 0x400000110ULL, { 10, 4, 5 }, { 3, 1, 3 } },
+    { 0x410ULL, 0x400000108ULL, { 10, 4, 3 }, { 3, 1, 4 } },
+    { 0x10400ULL, 0x410000000100ULL, { 10, 16, 22 }, { 3, 2, 2 } },
+    { 0x10400ULL, 0x10000004100ULL, { 10, 16, 17 }, { 3, 2, 3 } },
+    { 0x10400ULL, 0x10000002100ULL, { 10, 16, 15 }, { 3, 2, 4 } },
+    { 0xc00ULL, 0x800000300ULL, { 10, 11, 5 }, { 3, 3, 1 } },
+    { 0xc00ULL, 0x20000000300ULL, { 10, 11, 17 }, { 3, 3, 2 } },
+    { 0x104ULL, 0x100000084ULL, { 8, 2, 3 }, { 4, 1, 3 } },
+    { 0x104ULL, 0x100000082ULL, { 8, 2, 1 }, { 4, 1, 4 } },
+    { 0x4100ULL, 0x104000000080ULL, { 8, 14, 20 }, { 4, 2, 2 } },
+    { 0x4100ULL, 0x4000001080ULL, { 8, 14, 15 }, { 4, 2, 3 } },
+    { 0x4100ULL, 0x4000000880ULL, { 8, 14, 13 }, { 4, 2, 4 } },
+    { 0x180ULL, 0x800000c0ULL, { 8, 7, 1 }, { 4, 4, 1 } },
+    { 0x180ULL, 0x20000000c0ULL, { 8, 7, 13 }, { 4, 4, 2 } },
+    { 0x180ULL, 0xe0ULL, { 8, 7, 6 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x400000000ULL, { 4, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x10000000000ULL, { 16, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x200ULL, { 11, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x100ULL, { 9, -1, -1 }, { 4, 0, 0 } },
+    { 0x10ULL, 0x400000010ULL, { 4, 5, -1 }, { 1, 3, 0 } },
+    { 0x10ULL, 0x400000008ULL, { 4, 3, -1 }, { 1, 4, 0 } },
+    { 0x10000ULL, 0x410000000000ULL, { 16, 22, -1 }, { 2, 2, 0 } },
+    { 0x10000ULL, 0x10000004000ULL, { 16, 17, -1 }, { 2, 3, 0 } },
+    { 0x10000ULL, 0x10000002000ULL, { 16, 15, -1 }, { 2, 4, 0 } },
+    { 0x800ULL, 0x800000200ULL, { 11, 5, -1 }, { 3, 1, 0 } },
+    { 0x800ULL, 0x20000000200ULL, { 11, 17, -1 }, { 3, 2, 0 } },
+    { 0x200ULL, 0x200000100ULL, { 9, 3, -1 }, { 4, 1, 0 } },
+    { 0x200ULL, 0x8000000100ULL, { 9, 15, -1 }, { 4, 2, 0 } },
+    { 0x200ULL, 0x180ULL, { 9, 8, -1 }, { 4, 4, 0 } },
+    { 0x30ULL, 0xc00000010ULL, { 4, 5, 11 }, { 1, 3, 2 } },
+    { 0x18ULL, 0x600000008ULL, { 4, 3, 9 }, { 1, 4, 2 } },
+    { 0x18ULL, 0x40000000cULL, { 4, 3, 2 }, { 1, 4, 4 } },
+    { 0x410000ULL, 0x10410000000000ULL, { 16, 22, 28 }, { 2, 2, 2 } },
+    { 0x410000ULL, 0x410000080000ULL, { 16, 22, 23 }, { 2, 2, 3 } },
+    { 0x410000ULL, 0x410000040000ULL, { 16, 22, 21 }, { 2, 2, 4 } },
+    { 0x30000ULL, 0x30000004000ULL, { 16, 17, 11 }, { 2, 3, 1 } },
+    { 0x30000ULL, 0x810000004000ULL, { 16, 17, 23 }, { 2, 3, 2 } },
+    { 0x18000ULL, 0x18000002000ULL, { 16, 15, 9 }, { 2, 4, 1 } },
+    { 0x18000ULL, 0x210000002000ULL, { 16, 15, 21 }, { 2, 4, 2 } },
+    { 0x18000ULL, 0x10000003000ULL, { 16, 15, 14 }, { 2, 4, 4 } },
+    { 0x820ULL, 0x800000210ULL, { 11, 5, 4 }, { 3, 1, 4 } },
+    { 0x20800ULL, 0x820000000200ULL, { 11, 17, 23 }, { 3, 2, 2 } },
+    { 0x20800ULL, 0x20000004200ULL, { 11, 17, 16 }, { 3, 2, 4 } },
+    { 0x208ULL, 0x200000108ULL, { 9, 3, 4 }, { 4, 1, 3 } },
+    { 0x208ULL, 0x200000104ULL, { 9, 3, 2 }, { 4, 1, 4 } },
+    { 0x8200ULL, 0x208000000100ULL, { 9, 15, 21 }, { 4, 2, 2 } },
+    { 0x8200ULL, 0x8000002100ULL, { 9, 15, 16 }, { 4, 2, 3 } },
+    { 0x8200ULL, 0x8000001100ULL, { 9, 15, 14 }, { 4, 2, 4 } },
+    { 0x300ULL, 0x100000180ULL, { 9, 8, 2 }, { 4, 4, 1 } },
+    { 0x300ULL, 0x4000000180ULL, { 9, 8, 14 }, { 4, 4, 2 } },
+    { 0x300ULL, 0x1c0ULL, { 9, 8, 7 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x800000000ULL, { 5, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x20000000000ULL, { 17, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x200ULL, { 10, -1, -1 }, { 4, 0, 0 } },
+    { 0x20ULL, 0x800000010ULL, { 5, 4, -1 }, { 1, 4, 0 } },
+    { 0x20000ULL, 0x820000000000ULL, { 17, 23, -1 }, { 2, 2, 0 } },
+    { 0x20000ULL, 0x20000004000ULL, { 17, 16, -1 }, { 2, 4, 0 } },
+    { 0x400ULL, 0x400000200ULL, { 10, 4, -1 }, { 4, 1, 0 } },
+    { 0x400ULL, 0x10000000200ULL, { 10, 16, -1 }, { 4, 2, 0 } },
+    { 0x400ULL, 0x300ULL, { 10, 9, -1 }, { 4, 4, 0 } },
+    { 0x30ULL, 0xc00000010ULL, { 5, 4, 10 }, { 1, 4, 2 } },
+    { 0x30ULL, 0x800000018ULL, { 5, 4, 3 }, { 1, 4, 4 } },
+    { 0x820000ULL, 0x20820000000000ULL, { 17, 23, 29 }, { 2, 2, 2 } },
+    { 0x820000ULL, 0x820000080000ULL, { 17, 23, 22 }, { 2, 2, 4 } },
+    { 0x30000ULL, 0x30000004000ULL, { 17, 16, 10 }, { 2, 4, 1 } },
+    { 0x30000ULL, 0x420000004000ULL, { 17, 16, 22 }, { 2, 4, 2 } },
+    { 0x30000ULL, 0x20000006000ULL, { 17, 16, 15 }, { 2, 4, 4 } },
+    { 0x410ULL, 0x400000210ULL, { 10, 4, 5 }, { 4, 1, 3 } },
+    { 0x410ULL, 0x400000208ULL, { 10, 4, 3 }, { 4, 1, 4 } },
+    { 0x10400ULL, 0x410000000200ULL, { 10, 16, 22 }, { 4, 2, 2 } },
+    { 0x10400ULL, 0x10000004200ULL, { 10, 16, 17 }, { 4, 2, 3 } },
+    { 0x10400ULL, 0x10000002200ULL, { 10, 16, 15 }, { 4, 2, 4 } },
+    { 0x600ULL, 0x200000300ULL, { 10, 9, 3 }, { 4, 4, 1 } },
+    { 0x600ULL, 0x8000000300ULL, { 10, 9, 15 }, { 4, 4, 2 } },
+    { 0x600ULL, 0x380ULL, { 10, 9, 8 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x1000000000ULL, { 6, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x40000000000ULL, { 18, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x400ULL, { 13, -1, -1 }, { 3, 0, 0 } },
+    { 0x40ULL, 0x1040000000ULL, { 6, 0, -1 }, { 1, 1, 0 } },
+    { 0x40ULL, 0x1000000020ULL, { 6, 7, -1 }, { 1, 3, 0 } },
+    { 0x40000ULL, 0x1040000000000ULL, { 18, 24, -1 }, { 2, 2, 0 } },
+    { 0x40000ULL, 0x40000008000ULL, { 18, 19, -1 }, { 2, 3, 0 } },
+    { 0x2000ULL, 0x2000000400ULL, { 13, 7, -1 }, { 3, 1, 0 } },
+    { 0x2000ULL, 0x80000000400ULL, { 13, 19, -1 }, { 3, 2, 0 } },
+    { 0x2000ULL, 0xc00ULL, { 13, 14, -1 }, { 3, 3, 0 } },
+    { 0x41ULL, 0x1040000001ULL, { 6, 0, 1 }, { 1, 1, 3 } },
+    { 0xc0ULL, 0x1080000020ULL, { 6, 7, 1 }, { 1, 3, 1 } },
+    { 0xc0ULL, 0x3000000020ULL, { 6, 7, 13 }, { 1, 3, 2 } },
+    { 0xc0ULL, 0x1000000060ULL, { 6, 7, 8 }, { 1, 3, 3 } },
+    { 0x1040000ULL, 0x41040000000000ULL, { 18, 24, 30 }, { 2, 2, 2 } },
+    { 0x1040000ULL, 0x1040000100000ULL, { 18, 24, 25 }, { 2, 2, 3 } },
+    { 0xc0000ULL, 0xc0000008000ULL, { 18, 19, 13 }, { 2, 3, 1 } },
+    { 0xc0000ULL, 0x2040000008000ULL, { 18, 19, 25 }, { 2, 3, 2 } },
+    { 0xc0000ULL, 0x40000018000ULL, { 18, 19, 20 }, { 2, 3, 3 } },
+    { 0x2080ULL, 0x2080000400ULL, { 13, 7, 1 }, { 3, 1, 1 } },
+    { 0x2080ULL, 0x2000000440ULL, { 13, 7, 8 }, { 3, 1, 3 } },
+    { 0x2080ULL, 0x2000000420ULL, { 13, 7, 6 }, { 3, 1, 4 } },
+    { 0x82000ULL, 0x2080000000400ULL, { 13, 19, 25 }, { 3, 2, 2 } },
+    { 0x82000ULL, 0x80000010400ULL, { 13, 19, 20 }, { 3, 2, 3 } },
+    { 0x82000ULL, 0x80000008400ULL, { 13, 19, 18 }, { 3, 2, 4 } },
+    { 0x6000ULL, 0x4000000c00ULL, { 13, 14, 8 }, { 3, 3, 1 } },
+    { 0x6000ULL, 0x100000000c00ULL, { 13, 14, 20 }, { 3, 3, 2 } },
+    { 0x6000ULL, 0x1c00ULL, { 13, 14, 15 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x2000000000ULL, { 7, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x80000000000ULL, { 19, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x800ULL, { 14, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x400ULL, { 12, -1, -1 }, { 4, 0, 0 } },
+    { 0x80ULL, 0x2080000000ULL, { 7, 1, -1 }, { 1, 1, 0 } },
+    { 0x80ULL, 0x2000000040ULL, { 7, 8, -1 }, { 1, 3, 0 } },
+    { 0x80ULL, 0x2000000020ULL, { 7, 6, -1 }, { 1, 4, 0 } },
+    { 0x80000ULL, 0x2080000000000ULL, { 19, 25, -1 }, { 2, 2, 0 } },
+    { 0x80000ULL, 0x80000010000ULL, { 19, 20, -1 }, { 2, 3, 0 } },
+    { 0x80000ULL, 0x80000008000ULL, { 19, 18, -1 }, { 2, 4, 0 } },
+    { 0x4000ULL, 0x4000000800ULL, { 14, 8, -1 }, { 3, 1, 0 } },
+    { 0x4000ULL, 0x100000000800ULL, { 14, 20, -1 }, { 3, 2, 0 } },
+    { 0x4000ULL, 0x1800ULL, { 14, 15, -1 }, { 3, 3, 0 } },
+    { 0x1000ULL, 0x1000000400ULL, { 12, 6, -1 }, { 4, 1, 0 } },
+    { 0x1000ULL, 0x40000000400ULL, { 12, 18, -1 }, { 4, 2, 0 } },
+    { 0x82ULL, 0x2080000002ULL, { 7, 1, 2 }, { 1, 1, 3 } },
+    { 0x82ULL, 0x2080000001ULL, { 7, 1, 0 }, { 1, 1, 4 } },
+    { 0x180ULL, 0x2100000040ULL, { 7, 8, 2 }, { 1, 3, 1 } },
+    { 0x180ULL, 0x6000000040ULL, { 7, 8, 14 }, { 1, 3, 2 } },
+    { 0x180ULL, 0x20000000c0ULL, { 7, 8, 9 }, { 1, 3, 3 } },
+    { 0xc0ULL, 0x2040000020ULL, { 7, 6, 0 }, { 1, 4, 1 } },
+    { 0xc0ULL, 0x3000000020ULL, { 7, 6, 12 }, { 1, 4, 2 } },
+    { 0x2080000ULL, 0x82080000000000ULL, { 19, 25, 31 }, { 2, 2, 2 } },
+    { 0x2080000ULL, 0x2080000200000ULL, { 19, 25, 26 }, { 2, 2, 3 } },
+    { 0x2080000ULL, 0x2080000100000ULL, { 19, 25, 24 }, { 2, 2, 4 } },
+    { 0x180000ULL, 0x180000010000ULL, { 19, 20, 14 }, { 2, 3, 1 } },
+    { 0x180000ULL, 0x4080000010000ULL, { 19, 20, 26 }, { 2, 3, 2 } },
+    { 0x180000ULL, 0x80000030000ULL, { 19, 20, 21 }, { 2, 3, 3 } },
+    { 0xc0000ULL, 0xc0000008000ULL, { 19, 18, 12 }, { 2, 4, 1 } },
+    { 0xc0000ULL, 0x1080000008000ULL, { 19, 18, 24 }, { 2, 4, 2 } },
+    { 0x4100ULL, 0x4100000800ULL, { 14, 8, 2 }, { 3, 1, 1 } },
+    { 0x4100ULL, 0x4000000880ULL, { 14, 8, 9 }, { 3, 1, 3 } },
+    { 0x4100ULL, 0x4000000840ULL, { 14, 8, 7 }, { 3, 1, 4 } },
+    { 0x104000ULL, 0x4100000000800ULL, { 14, 20, 26 }, { 3, 2, 2 } },
+    { 0x104000ULL, 0x100000020800ULL, { 14, 20, 21 }, { 3, 2, 3 } },
+    { 0x104000ULL, 0x100000010800ULL, { 14, 20, 19 }, { 3, 2, 4 } },
+    { 0xc000ULL, 0x8000001800ULL, { 14, 15, 9 }, { 3, 3, 1 } },
+    { 0xc000ULL, 0x200000001800ULL, { 14, 15, 21 }, { 3, 3, 2 } },
+    { 0xc000ULL, 0x3800ULL, { 14, 15, 16 }, { 3, 3, 3 } },
+    { 0x1040ULL, 0x1040000400ULL, { 12, 6, 0 }, { 4, 1, 1 } },
+    { 0x1040ULL, 0x1000000420ULL, { 12, 6, 7 }, { 4, 1, 3 } },
+    { 0x41000ULL, 0x1040000000400ULL, { 12, 18, 24 }, { 4, 2, 2 } },
+    { 0x41000ULL, 0x40000008400ULL, { 12, 18, 19 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x4000000000ULL, { 8, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x100000000000ULL, { 20, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x1000ULL, { 15, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x800ULL, { 13, -1, -1 }, { 4, 0, 0 } },
+    { 0x100ULL, 0x4100000000ULL, { 8, 2, -1 }, { 1, 1, 0 } },
+    { 0x100ULL, 0x4000000080ULL, { 8, 9, -1 }, { 1, 3, 0 } },
+    { 0x100ULL, 0x4000000040ULL, { 8, 7, -1 }, { 1, 4, 0 } },
+    { 0x100000ULL, 0x4100000000000ULL, { 20, 26, -1 }, { 2, 2, 0 } },
+    { 0x100000ULL, 0x100000020000ULL, { 20, 21, -1 }, { 2, 3, 0 } },
+    { 0x100000ULL, 0x100000010000ULL, { 20, 19, -1 }, { 2, 4, 0 } },
+    { 0x8000ULL, 0x8000001000ULL, { 15, 9, -1 }, { 3, 1, 0 } },
+    { 0x8000ULL, 0x200000001000ULL, { 15, 21, -1 }, { 3, 2, 0 } },
+    { 0x8000ULL, 0x3000ULL, { 15, 16, -1 }, { 3, 3, 0 } },
+    { 0x2000ULL, 0x2000000800ULL, { 13, 7, -1 }, { 4, 1, 0 } },
+    { 0x2000ULL, 0x80000000800ULL, { 13, 19, -1 }, { 4, 2, 0 } },
+    { 0x2000ULL, 0xc00ULL, { 13, 12, -1 }, { 4, 4, 0 } },
+    { 0x104ULL, 0x4100000004ULL, { 8, 2, 3 }, { 1, 1, 3 } },
+    { 0x104ULL, 0x4100000002ULL, { 8, 2, 1 }, { 1, 1, 4 } },
+    { 0x300ULL, 0x4200000080ULL, { 8, 9, 3 }, { 1, 3, 1 } },
+    { 0x300ULL, 0xc000000080ULL, { 8, 9, 15 }, { 1, 3, 2 } },
+    { 0x300ULL, 0x4000000180ULL, { 8, 9, 10 }, { 1, 3, 3 } },
+    { 0x180ULL, 0x4080000040ULL, { 8, 7, 1 }, { 1, 4, 1 } },
+    { 0x180ULL, 0x6000000040ULL, { 8, 7, 13 }, { 1, 4, 2 } },
+    { 0x180ULL, 0x4000000060ULL, { 8, 7, 6 }, { 1, 4, 4 } },
+    { 0x4100000ULL, 0x104100000000000ULL, { 20, 26, 32 }, { 2, 2, 2 } },
+    { 0x4100000ULL, 0x4100000400000ULL, { 20, 26, 27 }, { 2, 2, 3 } },
+    { 0x4100000ULL, 0x4100000200000ULL, { 20, 26, 25 }, { 2, 2, 4 } },
+    { 0x300000ULL, 0x300000020000ULL, { 20, 21, 15 }, { 2, 3, 1 } },
+    { 0x300000ULL, 0x8100000020000ULL, { 20, 21, 27 }, { 2, 3, 2 } },
+    { 0x300000ULL, 0x100000060000ULL, { 20, 21, 22 }, { 2, 3, 3 } },
+    { 0x180000ULL, 0x180000010000ULL, { 20, 19, 13 }, { 2, 4, 1 } },
+    { 0x180000ULL, 0x2100000010000ULL, { 20, 19, 25 }, { 2, 4, 2 } },
+    { 0x180000ULL, 0x100000018000ULL, { 20, 19, 18 }, { 2, 4, 4 } },
+    { 0x8200ULL, 0x8200001000ULL, { 15, 9, 3 }, { 3, 1, 1 } },
+    { 0x8200ULL, 0x8000001100ULL, { 15, 9, 10 }, { 3, 1, 3 } },
+    { 0x8200ULL, 0x8000001080ULL, { 15, 9, 8 }, { 3, 1, 4 } },
+    { 0x208000ULL, 0x8200000001000ULL, { 15, 21, 27 }, { 3, 2, 2 } },
+    { 0x208000ULL, 0x200000041000ULL, { 15, 21, 22 }, { 3, 2, 3 } },
+    { 0x208000ULL, 0x200000021000ULL, { 15, 21, 20 }, { 3, 2, 4 } },
+    { 0x18000ULL, 0x10000003000ULL, { 15, 16, 10 }, { 3, 3, 1 } },
+    { 0x18000ULL, 0x400000003000ULL, { 15, 16, 22 }, { 3, 3, 2 } },
+    { 0x18000ULL, 0x7000ULL, { 15, 16, 17 }, { 3, 3, 3 } },
+    { 0x2080ULL, 0x2080000800ULL, { 13, 7, 1 }, { 4, 1, 1 } },
+    { 0x2080ULL, 0x2000000840ULL, { 13, 7, 8 }, { 4, 1, 3 } },
+    { 0x2080ULL, 0x2000000820ULL, { 13, 7, 6 }, { 4, 1, 4 } },
+    { 0x82000ULL, 0x2080000000800ULL, { 13, 19, 25 }, { 4, 2, 2 } },
+    { 0x82000ULL, 0x80000010800ULL, { 13, 19, 20 }, { 4, 2, 3 } },
+    { 0x82000ULL, 0x80000008800ULL, { 13, 19, 18 }, { 4, 2, 4 } },
+    { 0x3000ULL, 0x1000000c00ULL, { 13, 12, 6 }, { 4, 4, 1 } },
+    { 0x3000ULL, 0x40000000c00ULL, { 13, 12, 18 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x8000000000ULL, { 9, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x200000000000ULL, { 21, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x2000ULL, { 16, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x1000ULL, { 14, -1, -1 }, { 4, 0, 0 } },
+    { 0x200ULL, 0x8200000000ULL, { 9, 3, -1 }, { 1, 1, 0 } },
+    { 0x200ULL, 0x8000000100ULL, { 9, 10, -1 }, { 1, 3, 0 } },
+    { 0x200ULL, 0x8000000080ULL, { 9, 8, -1 }, { 1, 4, 0 } },
+    { 0x200000ULL, 0x8200000000000ULL, { 21, 27, -1 }, { 2, 2, 0 } },
+    { 0x200000ULL, 0x200000040000ULL, { 21, 22, -1 }, { 2, 3, 0 } },
+    { 0x200000ULL, 0x200000020000ULL, { 21, 20, -1 }, { 2, 4, 0 } },
+    { 0x10000ULL, 0x10000002000ULL, { 16, 10, -1 }, { 3, 1, 0 } },
+    { 0x10000ULL, 0x400000002000ULL, { 16, 22, -1 }, { 3, 2, 0 } },
+    { 0x10000ULL, 0x6000ULL, { 16, 17, -1 }, { 3, 3, 0 } },
+    { 0x4000ULL, 0x4000001000ULL, { 14, 8, -1 }, { 4, 1, 0 } },
+    { 0x4000ULL, 0x100000001000ULL, { 14, 20, -1 }, { 4, 2, 0 } },
+    { 0x4000ULL, 0x1800ULL, { 14, 13, -1 }, { 4, 4, 0 } },
+    { 0x208ULL, 0x8200000008ULL, { 9, 3, 4 }, { 1, 1, 3 } },
+    { 0x208ULL, 0x8200000004ULL, { 9, 3, 2 }, { 1, 1, 4 } },
+    { 0x600ULL, 0x8400000100ULL, { 9, 10, 4 }, { 1, 3, 1 } },
+    { 0x600ULL, 0x18000000100ULL, { 9, 10, 16 }, { 1, 3, 2 } },
+    { 0x600ULL, 0x8000000300ULL, { 9, 10, 11 }, { 1, 3, 3 } },
+    { 0x300ULL, 0x8100000080ULL, { 9, 8, 2 }, { 1, 4, 1 } },
+    { 0x300ULL, 0xc000000080ULL, { 9, 8, 14 }, { 1, 4, 2 } },
+    { 0x300ULL, 0x80000000c0ULL, { 9, 8, 7 }, { 1, 4, 4 } },
+    { 0x8200000ULL, 0x208200000000000ULL, { 21, 27, 33 }, { 2, 2, 2 } },
+    { 0x8200000ULL, 0x8200000800000ULL, { 21, 27, 28 }, { 2, 2, 3 } },
+    { 0x8200000ULL, 0x8200000400000ULL, { 21, 27, 26 }, { 2, 2, 4 } },
+    { 0x600000ULL, 0x600000040000ULL, { 21, 22, 16 }, { 2, 3, 1 } },
+    { 0x600000ULL, 0x10200000040000ULL, { 21, 22, 28 }, { 2, 3, 2 } },
+    { 0x600000ULL, 0x2000000c0000ULL, { 21, 22, 23 }, { 2, 3, 3 } },
+    { 0x300000ULL, 0x300000020000ULL, { 21, 20, 14 }, { 2, 4, 1 } },
+    { 0x300000ULL, 0x4200000020000ULL, { 21, 20, 26 }, { 2, 4, 2 } },
+    { 0x300000ULL, 0x200000030000ULL, { 21, 20, 19 }, { 2, 4, 4 } },
+    { 0x10400ULL, 0x10400002000ULL, { 16, 10, 4 }, { 3, 1, 1 } },
+    { 0x10400ULL, 0x10000002200ULL, { 16, 10, 11 }, { 3, 1, 3 } },
+    { 0x10400ULL, 0x10000002100ULL, { 16, 10, 9 }, { 3, 1, 4 } },
+    { 0x410000ULL, 0x10400000002000ULL, { 16, 22, 28 }, { 3, 2, 2 } },
+    { 0x410000ULL, 0x400000082000ULL, { 16, 22, 23 }, { 3, 2, 3 } },
+    { 0x410000ULL, 0x400000042000ULL, { 16, 22, 21 }, { 3, 2, 4 } },
+    { 0x30000ULL, 0x20000006000ULL, { 16, 17, 11 }, { 3, 3, 1 } },
+    { 0x30000ULL, 0x800000006000ULL, { 16, 17, 23 }, { 3, 3, 2 } },
+    { 0x4100ULL, 0x4100001000ULL, { 14, 8, 2 }, { 4, 1, 1 } },
+    { 0x4100ULL, 0x4000001080ULL, { 14, 8, 9 }, { 4, 1, 3 } },
+    { 0x4100ULL, 0x4000001040ULL, { 14, 8, 7 }, { 4, 1, 4 } },
+    { 0x104000ULL, 0x4100000001000ULL, { 14, 20, 26 }, { 4, 2, 2 } },
+    { 0x104000ULL, 0x100000021000ULL, { 14, 20, 21 }, { 4, 2, 3 } },
+    { 0x104000ULL, 0x100000011000ULL, { 14, 20, 19 }, { 4, 2, 4 } },
+    { 0x6000ULL, 0x2000001800ULL, { 14, 13, 7 }, { 4, 4, 1 } },
+    { 0x6000ULL, 0x80000001800ULL, { 14, 13, 19 }, { 4, 4, 2 } },
+    { 0x6000ULL, 0x1c00ULL, { 14, 13, 12 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x10000000000ULL, { 10, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x400000000000ULL, { 22, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x4000ULL, { 17, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x2000ULL, { 15, -1, -1 }, { 4, 0, 0 } },
+    { 0x400ULL, 0x10400000000ULL, { 10, 4, -1 }, { 1, 1, 0 } },
+    { 0x400ULL, 0x10000000200ULL, { 10, 11, -1 }, { 1, 3, 0 } },
+    { 0x400ULL, 0x10000000100ULL, { 10, 9, -1 }, { 1, 4, 0 } },
+    { 0x400000ULL, 0x10400000000000ULL, { 22, 28, -1 }, { 2, 2, 0 } },
+    { 0x400000ULL, 0x400000080000ULL, { 22, 23, -1 }, { 2, 3, 0 } },
+    { 0x400000ULL, 0x400000040000ULL, { 22, 21, -1 }, { 2, 4, 0 } },
+    { 0x20000ULL, 0x20000004000ULL, { 17, 11, -1 }, { 3, 1, 0 } },
+    { 0x20000ULL, 0x800000004000ULL, { 17, 23, -1 }, { 3, 2, 0 } },
+    { 0x8000ULL, 0x8000002000ULL, { 15, 9, -1 }, { 4, 1, 0 } },
+    { 0x8000ULL, 0x200000002000ULL, { 15, 21, -1 }, { 4, 2, 0 } },
+    { 0x8000ULL, 0x3000ULL, { 15, 14, -1 }, { 4, 4, 0 } },
+    { 0x410ULL, 0x10400000010ULL, { 10, 4, 5 }, { 1, 1, 3 } },
+    { 0x410ULL, 0x10400000008ULL, { 10, 4, 3 }, { 1, 1, 4 } },
+    { 0xc00ULL, 0x10800000200ULL, { 10, 11, 5 }, { 1, 3, 1 } },
+    { 0xc00ULL, 0x30000000200ULL, { 10, 11, 17 }, { 1, 3, 2 } },
+    { 0x600ULL, 0x10200000100ULL, { 10, 9, 3 }, { 1, 4, 1 } },
+    { 0x600ULL, 0x18000000100ULL, { 10, 9, 15 }, { 1, 4, 2 } },
+    { 0x600ULL, 0x10000000180ULL, { 10, 9, 8 }, { 1, 4, 4 } },
+    { 0x10400000ULL, 0x410400000000000ULL, { 22, 28, 34 }, { 2, 2, 2 } },
+    { 0x10400000ULL, 0x10400001000000ULL, { 22, 28, 29 }, { 2, 2, 3 } },
+    { 0x10400000ULL, 0x10400000800000ULL, { 22, 28, 27 }, { 2, 2, 4 } },
+    { 0xc00000ULL, 0xc00000080000ULL, { 22, 23, 17 }, { 2, 3, 1 } },
+    { 0xc00000ULL, 0x20400000080000ULL, { 22, 23, 29 }, { 2, 3, 2 } },
+    { 0x600000ULL, 0x600000040000ULL, { 22, 21, 15 }, { 2, 4, 1 } },
+    { 0x600000ULL, 0x8400000040000ULL, { 22, 21, 27 }, { 2, 4, 2 } },
+    { 0x600000ULL, 0x400000060000ULL, { 22, 21, 20 }, { 2, 4, 4 } },
+    { 0x20800ULL, 0x20800004000ULL, { 17, 11, 5 }, { 3, 1, 1 } },
+    { 0x20800ULL, 0x20000004200ULL, { 17, 11, 10 }, { 3, 1, 4 } },
+    { 0x820000ULL, 0x20800000004000ULL, { 17, 23, 29 }, { 3, 2, 2 } },
+    { 0x820000ULL, 0x800000084000ULL, { 17, 23, 22 }, { 3, 2, 4 } },
+    { 0x8200ULL, 0x8200002000ULL, { 15, 9, 3 }, { 4, 1, 1 } },
+    { 0x8200ULL, 0x8000002100ULL, { 15, 9, 10 }, { 4, 1, 3 } },
+    { 0x8200ULL, 0x8000002080ULL, { 15, 9, 8 }, { 4, 1, 4 } },
+    { 0x208000ULL, 0x8200000002000ULL, { 15, 21, 27 }, { 4, 2, 2 } },
+    { 0x208000ULL, 0x200000042000ULL, { 15, 21, 22 }, { 4, 2, 3 } },
+    { 0x208000ULL, 0x200000022000ULL, { 15, 21, 20 }, { 4, 2, 4 } },
+    { 0xc000ULL, 0x4000003000ULL, { 15, 14, 8 }, { 4, 4, 1 } },
+    { 0xc000ULL, 0x100000003000ULL, { 15, 14, 20 }, { 4, 4, 2 } },
+    { 0xc000ULL, 0x3800ULL, { 15, 14, 13 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x20000000000ULL, { 11, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x800000000000ULL, { 23, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x4000ULL, { 16, -1, -1 }, { 4, 0, 0 } },
+    { 0x800ULL, 0x20800000000ULL, { 11, 5, -1 }, { 1, 1, 0 } },
+    { 0x800ULL, 0x20000000200ULL, { 11, 10, -1 }, { 1, 4, 0 } },
+    { 0x800000ULL, 0x20800000000000ULL, { 23, 29, -1 }, { 2, 2, 0 } },
+    { 0x800000ULL, 0x800000080000ULL, { 23, 22, -1 }, { 2, 4, 0 } },
+    { 0x10000ULL, 0x10000004000ULL, { 16, 10, -1 }, { 4, 1, 0 } },
+    { 0x10000ULL, 0x400000004000ULL, { 16, 22, -1 }, { 4, 2, 0 } },
+    { 0x10000ULL, 0x6000ULL, { 16, 15, -1 }, { 4, 4, 0 } },
+    { 0x820ULL, 0x20800000010ULL, { 11, 5, 4 }, { 1, 1, 4 } },
+    { 0xc00ULL, 0x20400000200ULL, { 11, 10, 4 }, { 1, 4, 1 } },
+    { 0xc00ULL, 0x30000000200ULL, { 11, 10, 16 }, { 1, 4, 2 } },
+    { 0xc00ULL, 0x20000000300ULL, { 11, 10, 9 }, { 1, 4, 4 } },
+    { 0x20800000ULL, 0x820800000000000ULL, { 23, 29, 35 }, { 2, 2, 2 } },
+    { 0x20800000ULL, 0x20800001000000ULL, { 23, 29, 28 }, { 2, 2, 4 } },
+    { 0xc00000ULL, 0xc00000080000ULL, { 23, 22, 16 }, { 2, 4, 1 } },
+    { 0xc00000ULL, 0x10800000080000ULL, { 23, 22, 28 }, { 2, 4, 2 } },
+    { 0xc00000ULL, 0x8000000c0000ULL, { 23, 22, 21 }, { 2, 4, 4 } },
+    { 0x10400ULL, 0x10400004000ULL, { 16, 10, 4 }, { 4, 1, 1 } },
+    { 0x10400ULL, 0x10000004200ULL, { 16, 10, 11 }, { 4, 1, 3 } },
+    { 0x10400ULL, 0x10000004100ULL, { 16, 10, 9 }, { 4, 1, 4 } },
+    { 0x410000ULL, 0x10400000004000ULL, { 16, 22, 28 }, { 4, 2, 2 } },
+    { 0x410000ULL, 0x400000084000ULL, { 16, 22, 23 }, { 4, 2, 3 } },
+    { 0x410000ULL, 0x400000044000ULL, { 16, 22, 21 }, { 4, 2, 4 } },
+    { 0x18000ULL, 0x8000006000ULL, { 16, 15, 9 }, { 4, 4, 1 } },
+    { 0x18000ULL, 0x200000006000ULL, { 16, 15, 21 }, { 4, 4, 2 } },
+    { 0x18000ULL, 0x7000ULL, { 16, 15, 14 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x40000000000ULL, { 12, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x1000000000000ULL, { 24, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x8000ULL, { 19, -1, -1 }, { 3, 0, 0 } },
+    { 0x1000ULL, 0x41000000000ULL, { 12, 6, -1 }, { 1, 1, 0 } },
+    { 0x1000ULL, 0x40000000400ULL, { 12, 13, -1 }, { 1, 3, 0 } },
+    { 0x1000000ULL, 0x41000000000000ULL, { 24, 30, -1 }, { 2, 2, 0 } },
+    { 0x1000000ULL, 0x1000000100000ULL, { 24, 25, -1 }, { 2, 3, 0 } },
+    { 0x80000ULL, 0x80000008000ULL, { 19, 13, -1 }, { 3, 1, 0 } },
+    { 0x80000ULL, 0x2000000008000ULL, { 19, 25, -1 }, { 3, 2, 0 } },
+    { 0x80000ULL, 0x18000ULL, { 19, 20, -1 }, { 3, 3, 0 } },
+    { 0x1040ULL, 0x41040000000ULL, { 12, 6, 0 }, { 1, 1, 1 } },
+    { 0x1040ULL, 0x41000000020ULL, { 12, 6, 7 }, { 1, 1, 3 } },
+    { 0x3000ULL, 0x42000000400ULL, { 12, 13, 7 }, { 1, 3, 1 } },
+    { 0x3000ULL, 0xc0000000400ULL, { 12, 13, 19 }, { 1, 3, 2 } },
+    { 0x3000ULL, 0x40000000c00ULL, { 12, 13, 14 }, { 1, 3, 3 } },
+    { 0x41000000ULL, 0x41000002000000ULL, { 24, 30, 31 }, { 2, 2, 3 } },
+    { 0x3000000ULL, 0x3000000100000ULL, { 24, 25, 19 }, { 2, 3, 1 } },
+    { 0x3000000ULL, 0x81000000100000ULL, { 24, 25, 31 }, { 2, 3, 2 } },
+    { 0x3000000ULL, 0x1000000300000ULL, { 24, 25, 26 }, { 2, 3, 3 } },
+    { 0x82000ULL, 0x82000008000ULL, { 19, 13, 7 }, { 3, 1, 1 } },
+    { 0x82000ULL, 0x80000008800ULL, { 19, 13, 14 }, { 3, 1, 3 } },
+    { 0x82000ULL, 0x80000008400ULL, { 19, 13, 12 }, { 3, 1, 4 } },
+    { 0x2080000ULL, 0x82000000008000ULL, { 19, 25, 31 }, { 3, 2, 2 } },
+    { 0x2080000ULL, 0x2000000208000ULL, { 19, 25, 26 }, { 3, 2, 3 } },
+    { 0x2080000ULL, 0x2000000108000ULL, { 19, 25, 24 }, { 3, 2, 4 } },
+    { 0x180000ULL, 0x100000018000ULL, { 19, 20, 14 }, { 3, 3, 1 } },
+    { 0x180000ULL, 0x4000000018000ULL, { 19, 20, 26 }, { 3, 3, 2 } },
+    { 0x180000ULL, 0x38000ULL, { 19, 20, 21 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x80000000000ULL, { 13, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x2000000000000ULL, { 25, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x10000ULL, { 20, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x8000ULL, { 18, -1, -1 }, { 4, 0, 0 } },
+    { 0x2000ULL, 0x82000000000ULL, { 13, 7, -1 }, { 1, 1, 0 } },
+    { 0x2000ULL, 0x80000000800ULL, { 13, 14, -1 }, { 1, 3, 0 } },
+    { 0x2000ULL, 0x80000000400ULL, { 13, 12, -1 }, { 1, 4, 0 } },
+    { 0x2000000ULL, 0x82000000000000ULL, { 25, 31, -1 }, { 2, 2, 0 } },
+    { 0x2000000ULL, 0x2000000200000ULL, { 25, 26, -1 }, { 2, 3, 0 } },
+    { 0x2000000ULL, 0x2000000100000ULL, { 25, 24, -1 }, { 2, 4, 0 } },
+    { 0x100000ULL, 0x100000010000ULL, { 20, 14, -1 }, { 3, 1, 0 } },
+    { 0x100000ULL, 0x4000000010000ULL, { 20, 26, -1 }, { 3, 2, 0 } },
+    { 0x100000ULL, 0x30000ULL, { 20, 21, -1 }, { 3, 3, 0 } },
+    { 0x40000ULL, 0x40000008000ULL, { 18, 12, -1 }, { 4, 1, 0 } },
+    { 0x40000ULL, 0x1000000008000ULL, { 18, 24, -1 }, { 4, 2, 0 } },
+    { 0x2080ULL, 0x82080000000ULL, { 13, 7, 1 }, { 1, 1, 1 } },
+    { 0x2080ULL, 0x82000000040ULL, { 13, 7, 8 }, { 1, 1, 3 } },
+    { 0x2080ULL, 0x82000000020ULL, { 13, 7, 6 }, { 1, 1, 4 } },
+    { 0x6000ULL, 0x84000000800ULL, { 13, 14, 8 }, { 1, 3, 1 } },
+    { 0x6000ULL, 0x180000000800ULL, { 13, 14, 20 }, { 1, 3, 2 } },
+    { 0x6000ULL, 0x80000001800ULL, { 13, 14, 15 }, { 1, 3, 3 } },
+    { 0x3000ULL, 0x81000000400ULL, { 13, 12, 6 }, { 1, 4, 1 } },
+    { 0x3000ULL, 0xc0000000400ULL, { 13, 12, 18 }, { 1, 4, 2 } },
+    { 0x82000000ULL, 0x82000004000000ULL, { 25, 31, 32 }, { 2, 2, 3 } },
+    { 0x82000000ULL, 0x82000002000000ULL, { 25, 31, 30 }, { 2, 2, 4 } },
+    { 0x6000000ULL, 0x6000000200000ULL, { 25, 26, 20 }, { 2, 3, 1 } },
+    { 0x6000000ULL, 0x102000000200000ULL, { 25, 26, 32 }, { 2, 3, 2 } },
+    { 0x6000000ULL, 0x2000000600000ULL, { 25, 26, 27 }, { 2, 3, 3 } },
+    { 0x3000000ULL, 0x3000000100000ULL, { 25, 24, 18 }, { 2, 4, 1 } },
+    { 0x3000000ULL, 0x42000000100000ULL, { 25, 24, 30 }, { 2, 4, 2 } },
+    { 0x104000ULL, 0x104000010000ULL, { 20, 14, 8 }, { 3, 1, 1 } },
+    { 0x104000ULL, 0x100000011000ULL, { 20, 14, 15 }, { 3, 1, 3 } },
+    { 0x104000ULL, 0x100000010800ULL, { 20, 14, 13 }, { 3, 1, 4 } },
+    { 0x4100000ULL, 0x104000000010000ULL, { 20, 26, 32 }, { 3, 2, 2 } },
+    { 0x4100000ULL, 0x4000000410000ULL, { 20, 26, 27 }, { 3, 2, 3 } },
+    { 0x4100000ULL, 0x4000000210000ULL, { 20, 26, 25 }, { 3, 2, 4 } },
+    { 0x300000ULL, 0x200000030000ULL, { 20, 21, 15 }, { 3, 3, 1 } },
+    { 0x300000ULL, 0x8000000030000ULL, { 20, 21, 27 }, { 3, 3, 2 } },
+    { 0x300000ULL, 0x70000ULL, { 20, 21, 22 }, { 3, 3, 3 } },
+    { 0x41000ULL, 0x41000008000ULL, { 18, 12, 6 }, { 4, 1, 1 } },
+    { 0x41000ULL, 0x40000008400ULL, { 18, 12, 13 }, { 4, 1, 3 } },
+    { 0x1040000ULL, 0x41000000008000ULL, { 18, 24, 30 }, { 4, 2, 2 } },
+    { 0x1040000ULL, 0x1000000108000ULL, { 18, 24, 25 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x100000000000ULL, { 14, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x4000000000000ULL, { 26, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x20000ULL, { 21, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x10000ULL, { 19, -1, -1 }, { 4, 0, 0 } },
+    { 0x4000ULL, 0x104000000000ULL, { 14, 8, -1 }, { 1, 1, 0 } },
+    { 0x4000ULL, 0x100000001000ULL, { 14, 15, -1 }, { 1, 3, 0 } },
+    { 0x4000ULL, 0x100000000800ULL, { 14, 13, -1 }, { 1, 4, 0 } },
+    { 0x4000000ULL, 0x104000000000000ULL, { 26, 32, -1 }, { 2, 2, 0 } },
+    { 0x4000000ULL, 0x4000000400000ULL, { 26, 27, -1 }, { 2, 3, 0 } },
+    { 0x4000000ULL, 0x4000000200000ULL, { 26, 25, -1 }, { 2, 4, 0 } },
+    { 0x200000ULL, 0x200000020000ULL, { 21, 15, -1 }, { 3, 1, 0 } },
+    { 0x200000ULL, 0x8000000020000ULL, { 21, 27, -1 }, { 3, 2, 0 } },
+    { 0x200000ULL, 0x60000ULL, { 21, 22, -1 }, { 3, 3, 0 } },
+    { 0x80000ULL, 0x80000010000ULL, { 19, 13, -1 }, { 4, 1, 0 } },
+    { 0x80000ULL, 0x2000000010000ULL, { 19, 25, -1 }, { 4, 2, 0 } },
+    { 0x80000ULL, 0x18000ULL, { 19, 18, -1 }, { 4, 4, 0 } },
+    { 0x4100ULL, 0x104100000000ULL, { 14, 8, 2 }, { 1, 1, 1 } },
+    { 0x4100ULL, 0x104000000080ULL, { 14, 8, 9 }, { 1, 1, 3 } },
+    { 0x4100ULL, 0x104000000040ULL, { 14, 8, 7 }, { 1, 1, 4 } },
+    { 0xc000ULL, 0x108000001000ULL, { 14, 15, 9 }, { 1, 3, 1 } },
+    { 0xc000ULL, 0x300000001000ULL, { 14, 15, 21 }, { 1, 3, 2 } },
+    { 0xc000ULL, 0x100000003000ULL, { 14, 15, 16 }, { 1, 3, 3 } },
+    { 0x6000ULL, 0x102000000800ULL, { 14, 13, 7 }, { 1, 4, 1 } },
+    { 0x6000ULL, 0x180000000800ULL, { 14, 13, 19 }, { 1, 4, 2 } },
+    { 0x6000ULL, 0x100000000c00ULL, { 14, 13, 12 }, { 1, 4, 4 } },
+    { 0x104000000ULL, 0x104000008000000ULL, { 26, 32, 33 }, { 2, 2, 3 } },
+    { 0x104000000ULL, 0x104000004000000ULL, { 26, 32, 31 }, { 2, 2, 4 } },
+    { 0xc000000ULL, 0xc000000400000ULL, { 26, 27, 21 }, { 2, 3, 1 } },
+    { 0xc000000ULL, 0x204000000400000ULL, { 26, 27, 33 }, { 2, 3, 2 } },
+    { 0xc000000ULL, 0x4000000c00000ULL, { 26, 27, 28 }, { 2, 3, 3 } },
+    { 0x6000000ULL, 0x6000000200000ULL, { 26, 25, 19 }, { 2, 4, 1 } },
+    { 0x6000000ULL, 0x84000000200000ULL, { 26, 25, 31 }, { 2, 4, 2 } },
+    { 0x6000000ULL, 0x4000000300000ULL, { 26, 25, 24 }, { 2, 4, 4 } },
+    { 0x208000ULL, 0x208000020000ULL, { 21, 15, 9 }, { 3, 1, 1 } },
+    { 0x208000ULL, 0x200000022000ULL, { 21, 15, 16 }, { 3, 1, 3 } },
+    { 0x208000ULL, 0x200000021000ULL, { 21, 15, 14 }, { 3, 1, 4 } },
+    { 0x8200000ULL, 0x208000000020000ULL, { 21, 27, 33 }, { 3, 2, 2 } },
+    { 0x8200000ULL, 0x8000000820000ULL, { 21, 27, 28 }, { 3, 2, 3 } },
+    { 0x8200000ULL, 0x8000000420000ULL, { 21, 27, 26 }, { 3, 2, 4 } },
+    { 0x600000ULL, 0x400000060000ULL, { 21, 22, 16 }, { 3, 3, 1 } },
+    { 0x600000ULL, 0x10000000060000ULL, { 21, 22, 28 }, { 3, 3, 2 } },
+    { 0x600000ULL, 0xe0000ULL, { 21, 22, 23 }, { 3, 3, 3 } },
+    { 0x82000ULL, 0x82000010000ULL, { 19, 13, 7 }, { 4, 1, 1 } },
+    { 0x82000ULL, 0x80000010800ULL, { 19, 13, 14 }, { 4, 1, 3 } },
+    { 0x82000ULL, 0x80000010400ULL, { 19, 13, 12 }, { 4, 1, 4 } },
+    { 0x2080000ULL, 0x82000000010000ULL, { 19, 25, 31 }, { 4, 2, 2 } },
+    { 0x2080000ULL, 0x2000000210000ULL, { 19, 25, 26 }, { 4, 2, 3 } },
+    { 0x2080000ULL, 0x2000000110000ULL, { 19, 25, 24 }, { 4, 2, 4 } },
+    { 0xc0000ULL, 0x40000018000ULL, { 19, 18, 12 }, { 4, 4, 1 } },
+    { 0xc0000ULL, 0x1000000018000ULL, { 19, 18, 24 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x200000000000ULL, { 15, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x8000000000000ULL, { 27, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x40000ULL, { 22, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x20000ULL, { 20, -1, -1 }, { 4, 0, 0 } },
+    { 0x8000ULL, 0x208000000000ULL, { 15, 9, -1 }, { 1, 1, 0 } },
+    { 0x8000ULL, 0x200000002000ULL, { 15, 16, -1 }, { 1, 3, 0 } },
+    { 0x8000ULL, 0x200000001000ULL, { 15, 14, -1 }, { 1, 4, 0 } },
+    { 0x8000000ULL, 0x208000000000000ULL, { 27, 33, -1 }, { 2, 2, 0 } },
+    { 0x8000000ULL, 0x8000000800000ULL, { 27, 28, -1 }, { 2, 3, 0 } },
+    { 0x8000000ULL, 0x8000000400000ULL, { 27, 26, -1 }, { 2, 4, 0 } },
+    { 0x400000ULL, 0x400000040000ULL, { 22, 16, -1 }, { 3, 1, 0 } },
+    { 0x400000ULL, 0x10000000040000ULL, { 22, 28, -1 }, { 3, 2, 0 } },
+    { 0x400000ULL, 0xc0000ULL, { 22, 23, -1 }, { 3, 3, 0 } },
+    { 0x100000ULL, 0x100000020000ULL, { 20, 14, -1 }, { 4, 1, 0 } },
+    { 0x100000ULL, 0x4000000020000ULL, { 20, 26, -1 }, { 4, 2, 0 } },
+    { 0x100000ULL, 0x30000ULL, { 20, 19, -1 }, { 4, 4, 0 } },
+    { 0x8200ULL, 0x208200000000ULL, { 15, 9, 3 }, { 1, 1, 1 } },
+    { 0x8200ULL, 0x208000000100ULL, { 15, 9, 10 }, { 1, 1, 3 } },
+    { 0x8200ULL, 0x208000000080ULL, { 15, 9, 8 }, { 1, 1, 4 } },
+    { 0x18000ULL, 0x210000002000ULL, { 15, 16, 10 }, { 1, 3, 1 } },
+    { 0x18000ULL, 0x600000002000ULL, { 15, 16, 22 }, { 1, 3, 2 } },
+    { 0x18000ULL, 0x200000006000ULL, { 15, 16, 17 }, { 1, 3, 3 } },
+    { 0xc000ULL, 0x204000001000ULL, { 15, 14, 8 }, { 1, 4, 1 } },
+    { 0xc000ULL, 0x300000001000ULL, { 15, 14, 20 }, { 1, 4, 2 } },
+    { 0xc000ULL, 0x200000001800ULL, { 15, 14, 13 }, { 1, 4, 4 } },
+    { 0x208000000ULL, 0x208000010000000ULL, { 27, 33, 34 }, { 2, 2, 3 } },
+    { 0x208000000ULL, 0x208000008000000ULL, { 27, 33, 32 }, { 2, 2, 4 } },
+    { 0x18000000ULL, 0x18000000800000ULL, { 27, 28, 22 }, { 2, 3, 1 } },
+    { 0x18000000ULL, 0x408000000800000ULL, { 27, 28, 34 }, { 2, 3, 2 } },
+    { 0x18000000ULL, 0x8000001800000ULL, { 27, 28, 29 }, { 2, 3, 3 } },
+    { 0xc000000ULL, 0xc000000400000ULL, { 27, 26, 20 }, { 2, 4, 1 } },
+    { 0xc000000ULL, 0x108000000400000ULL, { 27, 26, 32 }, { 2, 4, 2 } },
+    { 0xc000000ULL, 0x8000000600000ULL, { 27, 26, 25 }, { 2, 4, 4 } },
+    { 0x410000ULL, 0x410000040000ULL, { 22, 16, 10 }, { 3, 1, 1 } },
+    { 0x410000ULL, 0x400000044000ULL, { 22, 16, 17 }, { 3, 1, 3 } },
+    { 0x410000ULL, 0x400000042000ULL, { 22, 16, 15 }, { 3, 1, 4 } },
+    { 0x10400000ULL, 0x410000000040000ULL, { 22, 28, 34 }, { 3, 2, 2 } },
+    { 0x10400000ULL, 0x10000001040000ULL, { 22, 28, 29 }, { 3, 2, 3 } },
+    { 0x10400000ULL, 0x10000000840000ULL, { 22, 28, 27 }, { 3, 2, 4 } },
+    { 0xc00000ULL, 0x8000000c0000ULL, { 22, 23, 17 }, { 3, 3, 1 } },
+    { 0xc00000ULL, 0x200000000c0000ULL, { 22, 23, 29 }, { 3, 3, 2 } },
+    { 0x104000ULL, 0x104000020000ULL, { 20, 14, 8 }, { 4, 1, 1 } },
+    { 0x104000ULL, 0x100000021000ULL, { 20, 14, 15 }, { 4, 1, 3 } },
+    { 0x104000ULL, 0x100000020800ULL, { 20, 14, 13 }, { 4, 1, 4 } },
+    { 0x4100000ULL, 0x104000000020000ULL, { 20, 26, 32 }, { 4, 2, 2 } },
+    { 0x4100000ULL, 0x4000000420000ULL, { 20, 26, 27 }, { 4, 2, 3 } },
+    { 0x4100000ULL, 0x4000000220000ULL, { 20, 26, 25 }, { 4, 2, 4 } },
+    { 0x180000ULL, 0x80000030000ULL, { 20, 19, 13 }, { 4, 4, 1 } },
+    { 0x180000ULL, 0x2000000030000ULL, { 20, 19, 25 }, { 4, 4, 2 } },
+    { 0x180000ULL, 0x38000ULL, { 20, 19, 18 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x400000000000ULL, { 16, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x10000000000000ULL, { 28, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x80000ULL, { 23, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x40000ULL, { 21, -1, -1 }, { 4, 0, 0 } },
+    { 0x10000ULL, 0x410000000000ULL, { 16, 10, -1 }, { 1, 1, 0 } },
+    { 0x10000ULL, 0x400000004000ULL, { 16, 17, -1 }, { 1, 3, 0 } },
+    { 0x10000ULL, 0x400000002000ULL, { 16, 15, -1 }, { 1, 4, 0 } },
+    { 0x10000000ULL, 0x410000000000000ULL, { 28, 34, -1 }, { 2, 2, 0 } },
+    { 0x10000000ULL, 0x10000001000000ULL, { 28, 29, -1 }, { 2, 3, 0 } },
+    { 0x10000000ULL, 0x10000000800000ULL, { 28, 27, -1 }, { 2, 4, 0 } },
+    { 0x800000ULL, 0x800000080000ULL, { 23, 17, -1 }, { 3, 1, 0 } },
+    { 0x800000ULL, 0x20000000080000ULL, { 23, 29, -1 }, { 3, 2, 0 } },
+    { 0x200000ULL, 0x200000040000ULL, { 21, 15, -1 }, { 4, 1, 0 } },
+    { 0x200000ULL, 0x8000000040000ULL, { 21, 27, -1 }, { 4, 2, 0 } },
+    { 0x200000ULL, 0x60000ULL, { 21, 20, -1 }, { 4, 4, 0 } },
+    { 0x10400ULL, 0x410400000000ULL, { 16, 10, 4 }, { 1, 1, 1 } },
+    { 0x10400ULL, 0x410000000200ULL, { 16, 10, 11 }, { 1, 1, 3 } },
+    { 0x10400ULL, 0x410000000100ULL, { 16, 10, 9 }, { 1, 1, 4 } },
+    { 0x30000ULL, 0x420000004000ULL, { 16, 17, 11 }, { 1, 3, 1 } },
+    { 0x30000ULL, 0xc00000004000ULL, { 16, 17, 23 }, { 1, 3, 2 } },
+    { 0x18000ULL, 0x408000002000ULL, { 16, 15, 9 }, { 1, 4, 1 } },
+    { 0x18000ULL, 0x600000002000ULL, { 16, 15, 21 }, { 1, 4, 2 } },
+    { 0x18000ULL, 0x400000003000ULL, { 16, 15, 14 }, { 1, 4, 4 } },
+    { 0x410000000ULL, 0x410000020000000ULL, { 28, 34, 35 }, { 2, 2, 3 } },
+    { 0x410000000ULL, 0x410000010000000ULL, { 28, 34, 33 }, { 2, 2, 4 } },
+    { 0x30000000ULL, 0x30000001000000ULL, { 28, 29, 23 }, { 2, 3, 1 } },
+    { 0x30000000ULL, 0x810000001000000ULL, { 28, 29, 35 }, { 2, 3, 2 } },
+    { 0x18000000ULL, 0x18000000800000ULL, { 28, 27, 21 }, { 2, 4, 1 } },
+    { 0x18000000ULL, 0x210000000800000ULL, { 28, 27, 33 }, { 2, 4, 2 } },
+    { 0x18000000ULL, 0x10000000c00000ULL, { 28, 27, 26 }, { 2, 4, 4 } },
+    { 0x820000ULL, 0x820000080000ULL, { 23, 17, 11 }, { 3, 1, 1 } },
+    { 0x820000ULL, 0x800000084000ULL, { 23, 17, 16 }, { 3, 1, 4 } },
+    { 0x20800000ULL, 0x820000000080000ULL, { 23, 29, 35 }, { 3, 2, 2 } },
+    { 0x20800000ULL, 0x20000001080000ULL, { 23, 29, 28 }, { 3, 2, 4 } },
+    { 0x208000ULL, 0x208000040000ULL, { 21, 15, 9 }, { 4, 1, 1 } },
+    { 0x208000ULL, 0x200000042000ULL, { 21, 15, 16 }, { 4, 1, 3 } },
+    { 0x208000ULL, 0x200000041000ULL, { 21, 15, 14 }, { 4, 1, 4 } },
+    { 0x8200000ULL, 0x208000000040000ULL, { 21, 27, 33 }, { 4, 2, 2 } },
+    { 0x8200000ULL, 0x8000000840000ULL, { 21, 27, 28 }, { 4, 2, 3 } },
+    { 0x8200000ULL, 0x8000000440000ULL, { 21, 27, 26 }, { 4, 2, 4 } },
+    { 0x300000ULL, 0x100000060000ULL, { 21, 20, 14 }, { 4, 4, 1 } },
+    { 0x300000ULL, 0x4000000060000ULL, { 21, 20, 26 }, { 4, 4, 2 } },
+    { 0x300000ULL, 0x70000ULL, { 21, 20, 19 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x800000000000ULL, { 17, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x20000000000000ULL, { 29, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x80000ULL, { 22, -1, -1 }, { 4, 0, 0 } },
+    { 0x20000ULL, 0x820000000000ULL, { 17, 11, -1 }, { 1, 1, 0 } },
+    { 0x20000ULL, 0x800000004000ULL, { 17, 16, -1 }, { 1, 4, 0 } },
+    { 0x20000000ULL, 0x820000000000000ULL, { 29, 35, -1 }, { 2, 2, 0 } },
+    { 0x20000000ULL, 0x20000001000000ULL, { 29, 28, -1 }, { 2, 4, 0 } },
+    { 0x400000ULL, 0x400000080000ULL, { 22, 16, -1 }, { 4, 1, 0 } },
+    { 0x400000ULL, 0x10000000080000ULL, { 22, 28, -1 }, { 4, 2, 0 } },
+    { 0x400000ULL, 0xc0000ULL, { 22, 21, -1 }, { 4, 4, 0 } },
+    { 0x20800ULL, 0x820800000000ULL, { 17, 11, 5 }, { 1, 1, 1 } },
+    { 0x20800ULL, 0x820000000200ULL, { 17, 11, 10 }, { 1, 1, 4 } },
+    { 0x30000ULL, 0x810000004000ULL, { 17, 16, 10 }, { 1, 4, 1 } },
+    { 0x30000ULL, 0xc00000004000ULL, { 17, 16, 22 }, { 1, 4, 2 } },
+    { 0x30000ULL, 0x800000006000ULL, { 17, 16, 15 }, { 1, 4, 4 } },
+    { 0x820000000ULL, 0x820000020000000ULL, { 29, 35, 34 }, { 2, 2, 4 } },
+    { 0x30000000ULL, 0x30000001000000ULL, { 29, 28, 22 }, { 2, 4, 1 } },
+    { 0x30000000ULL, 0x420000001000000ULL, { 29, 28, 34 }, { 2, 4, 2 } },
+    { 0x30000000ULL, 0x20000001800000ULL, { 29, 28, 27 }, { 2, 4, 4 } },
+    { 0x410000ULL, 0x410000080000ULL, { 22, 16, 10 }, { 4, 1, 1 } },
+    { 0x410000ULL, 0x400000084000ULL, { 22, 16, 17 }, { 4, 1, 3 } },
+    { 0x410000ULL, 0x400000082000ULL, { 22, 16, 15 }, { 4, 1, 4 } },
+    { 0x10400000ULL, 0x410000000080000ULL, { 22, 28, 34 }, { 4, 2, 2 } },
+    { 0x10400000ULL, 0x10000001080000ULL, { 22, 28, 29 }, { 4, 2, 3 } },
+    { 0x10400000ULL, 0x10000000880000ULL, { 22, 28, 27 }, { 4, 2, 4 } },
+    { 0x600000ULL, 0x2000000c0000ULL, { 22, 21, 15 }, { 4, 4, 1 } },
+    { 0x600000ULL, 0x80000000c0000ULL, { 22, 21, 27 }, { 4, 4, 2 } },
+    { 0x600000ULL, 0xe0000ULL, { 22, 21, 20 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x1000000000000ULL, { 18, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x40000000000000ULL, { 30, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x100000ULL, { 25, -1, -1 }, { 3, 0, 0 } },
+    { 0x40000ULL, 0x1040000000000ULL, { 18, 12, -1 }, { 1, 1, 0 } },
+    { 0x40000ULL, 0x1000000008000ULL, { 18, 19, -1 }, { 1, 3, 0 } },
+    { 0x40000000ULL, 0x40000002000000ULL, { 30, 31, -1 }, { 2, 3, 0 } },
+    { 0x2000000ULL, 0x2000000100000ULL, { 25, 19, -1 }, { 3, 1, 0 } },
+    { 0x2000000ULL, 0x80000000100000ULL, { 25, 31, -1 }, { 3, 2, 0 } },
+    { 0x2000000ULL, 0x300000ULL, { 25, 26, -1 }, { 3, 3, 0 } },
+    { 0x41000ULL, 0x1041000000000ULL, { 18, 12, 6 }, { 1, 1, 1 } },
+    { 0x41000ULL, 0x1040000000400ULL, { 18, 12, 13 }, { 1, 1, 3 } },
+    { 0xc0000ULL, 0x1080000008000ULL, { 18, 19, 13 }, { 1, 3, 1 } },
+    { 0xc0000ULL, 0x3000000008000ULL, { 18, 19, 25 }, { 1, 3, 2 } },
+    { 0xc0000ULL, 0x1000000018000ULL, { 18, 19, 20 }, { 1, 3, 3 } },
+    { 0xc0000000ULL, 0xc0000002000000ULL, { 30, 31, 25 }, { 2, 3, 1 } },
+    { 0xc0000000ULL, 0x40000006000000ULL, { 30, 31, 32 }, { 2, 3, 3 } },
+    { 0x2080000ULL, 0x2080000100000ULL, { 25, 19, 13 }, { 3, 1, 1 } },
+    { 0x2080000ULL, 0x2000000110000ULL, { 25, 19, 20 }, { 3, 1, 3 } },
+    { 0x2080000ULL, 0x2000000108000ULL, { 25, 19, 18 }, { 3, 1, 4 } },
+    { 0x82000000ULL, 0x80000004100000ULL, { 25, 31, 32 }, { 3, 2, 3 } },
+    { 0x82000000ULL, 0x80000002100000ULL, { 25, 31, 30 }, { 3, 2, 4 } },
+    { 0x6000000ULL, 0x4000000300000ULL, { 25, 26, 20 }, { 3, 3, 1 } },
+    { 0x6000000ULL, 0x100000000300000ULL, { 25, 26, 32 }, { 3, 3, 2 } },
+    { 0x6000000ULL, 0x700000ULL, { 25, 26, 27 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x2000000000000ULL, { 19, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x80000000000000ULL, { 31, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x200000ULL, { 26, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x100000ULL, { 24, -1, -1 }, { 4, 0, 0 } },
+    { 0x80000ULL, 0x2080000000000ULL, { 19, 13, -1 }, { 1, 1, 0 } },
+    { 0x80000ULL, 0x2000000010000ULL, { 19, 20, -1 }, { 1, 3, 0 } },
+    { 0x80000ULL, 0x2000000008000ULL, { 19, 18, -1 }, { 1, 4, 0 } },
+    { 0x80000000ULL, 0x80000004000000ULL, { 31, 32, -1 }, { 2, 3, 0 } },
+    { 0x80000000ULL, 0x80000002000000ULL, { 31, 30, -1 }, { 2, 4, 0 } },
+    { 0x4000000ULL, 0x4000000200000ULL, { 26, 20, -1 }, { 3, 1, 0 } },
+    { 0x4000000ULL, 0x100000000200000ULL, { 26, 32, -1 }, { 3, 2, 0 } },
+    { 0x4000000ULL, 0x600000ULL, { 26, 27, -1 }, { 3, 3, 0 } },
+    { 0x1000000ULL, 0x1000000100000ULL, { 24, 18, -1 }, { 4, 1, 0 } },
+    { 0x1000000ULL, 0x40000000100000ULL, { 24, 30, -1 }, { 4, 2, 0 } },
+    { 0x82000ULL, 0x2082000000000ULL, { 19, 13, 7 }, { 1, 1, 1 } },
+    { 0x82000ULL, 0x2080000000800ULL, { 19, 13, 14 }, { 1, 1, 3 } },
+    { 0x82000ULL, 0x2080000000400ULL, { 19, 13, 12 }, { 1, 1, 4 } },
+    { 0x180000ULL, 0x2100000010000ULL, { 19, 20, 14 }, { 1, 3, 1 } },
+    { 0x180000ULL, 0x6000000010000ULL, { 19, 20, 26 }, { 1, 3, 2 } },
+    { 0x180000ULL, 0x2000000030000ULL, { 19, 20, 21 }, { 1, 3, 3 } },
+    { 0xc0000ULL, 0x2040000008000ULL, { 19, 18, 12 }, { 1, 4, 1 } },
+    { 0xc0000ULL, 0x3000000008000ULL, { 19, 18, 24 }, { 1, 4, 2 } },
+    { 0x180000000ULL, 0x180000004000000ULL, { 31, 32, 26 }, { 2, 3, 1 } },
+    { 0x180000000ULL, 0x8000000c000000ULL, { 31, 32, 33 }, { 2, 3, 3 } },
+    { 0xc0000000ULL, 0xc0000002000000ULL, { 31, 30, 24 }, { 2, 4, 1 } },
+    { 0x4100000ULL, 0x4100000200000ULL, { 26, 20, 14 }, { 3, 1, 1 } },
+    { 0x4100000ULL, 0x4000000220000ULL, { 26, 20, 21 }, { 3, 1, 3 } },
+    { 0x4100000ULL, 0x4000000210000ULL, { 26, 20, 19 }, { 3, 1, 4 } },
+    { 0x104000000ULL, 0x100000008200000ULL, { 26, 32, 33 }, { 3, 2, 3 } },
+    { 0x104000000ULL, 0x100000004200000ULL, { 26, 32, 31 }, { 3, 2, 4 } },
+    { 0xc000000ULL, 0x8000000600000ULL, { 26, 27, 21 }, { 3, 3, 1 } },
+    { 0xc000000ULL, 0x200000000600000ULL, { 26, 27, 33 }, { 3, 3, 2 } },
+    { 0xc000000ULL, 0xe00000ULL, { 26, 27, 28 }, { 3, 3, 3 } },
+    { 0x1040000ULL, 0x1040000100000ULL, { 24, 18, 12 }, { 4, 1, 1 } },
+    { 0x1040000ULL, 0x1000000108000ULL, { 24, 18, 19 }, { 4, 1, 3 } },
+    { 0x41000000ULL, 0x40000002100000ULL, { 24, 30, 31 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x4000000000000ULL, { 20, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x100000000000000ULL, { 32, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x400000ULL, { 27, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x200000ULL, { 25, -1, -1 }, { 4, 0, 0 } },
+    { 0x100000ULL, 0x4100000000000ULL, { 20, 14, -1 }, { 1, 1, 0 } },
+    { 0x100000ULL, 0x4000000020000ULL, { 20, 21, -1 }, { 1, 3, 0 } },
+    { 0x100000ULL, 0x4000000010000ULL, { 20, 19, -1 }, { 1, 4, 0 } },
+    { 0x100000000ULL, 0x100000008000000ULL, { 32, 33, -1 }, { 2, 3, 0 } },
+    { 0x100000000ULL, 0x100000004000000ULL, { 32, 31, -1 }, { 2, 4, 0 } },
+    { 0x8000000ULL, 0x8000000400000ULL, { 27, 21, -1 }, { 3, 1, 0 } },
+    { 0x8000000ULL, 0x200000000400000ULL, { 27, 33, -1 }, { 3, 2, 0 } },
+    { 0x8000000ULL, 0xc00000ULL, { 27, 28, -1 }, { 3, 3, 0 } },
+    { 0x2000000ULL, 0x2000000200000ULL, { 25, 19, -1 }, { 4, 1, 0 } },
+    { 0x2000000ULL, 0x80000000200000ULL, { 25, 31, -1 }, { 4, 2, 0 } },
+    { 0x2000000ULL, 0x300000ULL, { 25, 24, -1 }, { 4, 4, 0 } },
+    { 0x104000ULL, 0x4104000000000ULL, { 20, 14, 8 }, { 1, 1, 1 } },
+    { 0x104000ULL, 0x4100000001000ULL, { 20, 14, 15 }, { 1, 1, 3 } },
+    { 0x104000ULL, 0x4100000000800ULL, { 20, 14, 13 }, { 1, 1, 4 } },
+    { 0x300000ULL, 0x4200000020000ULL, { 20, 21, 15 }, { 1, 3, 1 } },
+    { 0x300000ULL, 0xc000000020000ULL, { 20, 21, 27 }, { 1, 3, 2 } },
+    { 0x300000ULL, 0x4000000060000ULL, { 20, 21, 22 }, { 1, 3, 3 } },
+    { 0x180000ULL, 0x4080000010000ULL, { 20, 19, 13 }, { 1, 4, 1 } },
+    { 0x180000ULL, 0x6000000010000ULL, { 20, 19, 25 }, { 1, 4, 2 } },
+    { 0x180000ULL, 0x4000000018000ULL, { 20, 19, 18 }, { 1, 4, 4 } },
+    { 0x300000000ULL, 0x300000008000000ULL, { 32, 33, 27 }, { 2, 3, 1 } },
+    { 0x300000000ULL, 0x100000018000000ULL, { 32, 33, 34 }, { 2, 3, 3 } },
+    { 0x180000000ULL, 0x180000004000000ULL, { 32, 31, 25 }, { 2, 4, 1 } },
+    { 0x180000000ULL, 0x100000006000000ULL, { 32, 31, 30 }, { 2, 4, 4 } },
+    { 0x8200000ULL, 0x8200000400000ULL, { 27, 21, 15 }, { 3, 1, 1 } },
+    { 0x8200000ULL, 0x8000000440000ULL, { 27, 21, 22 }, { 3, 1, 3 } },
+    { 0x8200000ULL, 0x8000000420000ULL, { 27, 21, 20 }, { 3, 1, 4 } },
+    { 0x208000000ULL, 0x200000010400000ULL, { 27, 33, 34 }, { 3, 2, 3 } },
+    { 0x208000000ULL, 0x200000008400000ULL, { 27, 33, 32 }, { 3, 2, 4 } },
+    { 0x18000000ULL, 0x10000000c00000ULL, { 27, 28, 22 }, { 3, 3, 1 } },
+    { 0x18000000ULL, 0x400000000c00000ULL, { 27, 28, 34 }, { 3, 3, 2 } },
+    { 0x18000000ULL, 0x1c00000ULL, { 27, 28, 29 }, { 3, 3, 3 } },
+    { 0x2080000ULL, 0x2080000200000ULL, { 25, 19, 13 }, { 4, 1, 1 } },
+    { 0x2080000ULL, 0x2000000210000ULL, { 25, 19, 20 }, { 4, 1, 3 } },
+    { 0x2080000ULL, 0x2000000208000ULL, { 25, 19, 18 }, { 4, 1, 4 } },
+    { 0x82000000ULL, 0x80000004200000ULL, { 25, 31, 32 }, { 4, 2, 3 } },
+    { 0x82000000ULL, 0x80000002200000ULL, { 25, 31, 30 }, { 4, 2, 4 } },
+    { 0x3000000ULL, 0x1000000300000ULL, { 25, 24, 18 }, { 4, 4, 1 } },
+    { 0x3000000ULL, 0x40000000300000ULL, { 25, 24, 30 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x8000000000000ULL, { 21, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x200000000000000ULL, { 33, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x800000ULL, { 28, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x400000ULL, { 26, -1, -1 }, { 4, 0, 0 } },
+    { 0x200000ULL, 0x8200000000000ULL, { 21, 15, -1 }, { 1, 1, 0 } },
+    { 0x200000ULL, 0x8000000040000ULL, { 21, 22, -1 }, { 1, 3, 0 } },
+    { 0x200000ULL, 0x8000000020000ULL, { 21, 20, -1 }, { 1, 4, 0 } },
+    { 0x200000000ULL, 0x200000010000000ULL, { 33, 34, -1 }, { 2, 3, 0 } },
+    { 0x200000000ULL, 0x200000008000000ULL, { 33, 32, -1 }, { 2, 4, 0 } },
+    { 0x10000000ULL, 0x10000000800000ULL, { 28, 22, -1 }, { 3, 1, 0 } },
+    { 0x10000000ULL, 0x400000000800000ULL, { 28, 34, -1 }, { 3, 2, 0 } },
+    { 0x10000000ULL, 0x1800000ULL, { 28, 29, -1 }, { 3, 3, 0 } },
+    { 0x4000000ULL, 0x4000000400000ULL, { 26, 20, -1 }, { 4, 1, 0 } },
+    { 0x4000000ULL, 0x100000000400000ULL, { 26, 32, -1 }, { 4, 2, 0 } },
+    { 0x4000000ULL, 0x600000ULL, { 26, 25, -1 }, { 4, 4, 0 } },
+    { 0x208000ULL, 0x8208000000000ULL, { 21, 15, 9 }, { 1, 1, 1 } },
+    { 0x208000ULL, 0x8200000002000ULL, { 21, 15, 16 }, { 1, 1, 3 } },
+    { 0x208000ULL, 0x8200000001000ULL, { 21, 15, 14 }, { 1, 1, 4 } },
+    { 0x600000ULL, 0x8400000040000ULL, { 21, 22, 16 }, { 1, 3, 1 } },
+    { 0x600000ULL, 0x18000000040000ULL, { 21, 22, 28 }, { 1, 3, 2 } },
+    { 0x600000ULL, 0x80000000c0000ULL, { 21, 22, 23 }, { 1, 3, 3 } },
+    { 0x300000ULL, 0x8100000020000ULL, { 21, 20, 14 }, { 1, 4, 1 } },
+    { 0x300000ULL, 0xc000000020000ULL, { 21, 20, 26 }, { 1, 4, 2 } },
+    { 0x300000ULL, 0x8000000030000ULL, { 21, 20, 19 }, { 1, 4, 4 } },
+    { 0x600000000ULL, 0x600000010000000ULL, { 33, 34, 28 }, { 2, 3, 1 } },
+    { 0x600000000ULL, 0x200000030000000ULL, { 33, 34, 35 }, { 2, 3, 3 } },
+    { 0x300000000ULL, 0x300000008000000ULL, { 33, 32, 26 }, { 2, 4, 1 } },
+    { 0x300000000ULL, 0x20000000c000000ULL, { 33, 32, 31 }, { 2, 4, 4 } },
+    { 0x10400000ULL, 0x10400000800000ULL, { 28, 22, 16 }, { 3, 1, 1 } },
+    { 0x10400000ULL, 0x10000000880000ULL, { 28, 22, 23 }, { 3, 1, 3 } },
+    { 0x10400000ULL, 0x10000000840000ULL, { 28, 22, 21 }, { 3, 1, 4 } },
+    { 0x410000000ULL, 0x400000020800000ULL, { 28, 34, 35 }, { 3, 2, 3 } },
+    { 0x410000000ULL, 0x400000010800000ULL, { 28, 34, 33 }, { 3, 2, 4 } },
+    { 0x30000000ULL, 0x20000001800000ULL, { 28, 29, 23 }, { 3, 3, 1 } },
+    { 0x30000000ULL, 0x800000001800000ULL, { 28, 29, 35 }, { 3, 3, 2 } },
+    { 0x4100000ULL, 0x4100000400000ULL, { 26, 20, 14 }, { 4, 1, 1 } },
+    { 0x4100000ULL, 0x4000000420000ULL, { 26, 20, 21 }, { 4, 1, 3 } },
+    { 0x4100000ULL, 0x4000000410000ULL, { 26, 20, 19 }, { 4, 1, 4 } },
+    { 0x104000000ULL, 0x100000008400000ULL, { 26, 32, 33 }, { 4, 2, 3 } },
+    { 0x104000000ULL, 0x100000004400000ULL, { 26, 32, 31 }, { 4, 2, 4 } },
+    { 0x6000000ULL, 0x2000000600000ULL, { 26, 25, 19 }, { 4, 4, 1 } },
+    { 0x6000000ULL, 0x80000000600000ULL, { 26, 25, 31 }, { 4, 4, 2 } },
+    { 0x6000000ULL, 0x700000ULL, { 26, 25, 24 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x10000000000000ULL, { 22, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x400000000000000ULL, { 34, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x1000000ULL, { 29, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x800000ULL, { 27, -1, -1 }, { 4, 0, 0 } },
+    { 0x400000ULL, 0x10400000000000ULL, { 22, 16, -1 }, { 1, 1, 0 } },
+    { 0x400000ULL, 0x10000000080000ULL, { 22, 23, -1 }, { 1, 3, 0 } },
+    { 0x400000ULL, 0x10000000040000ULL, { 22, 21, -1 }, { 1, 4, 0 } },
+    { 0x400000000ULL, 0x400000020000000ULL, { 34, 35, -1 }, { 2, 3, 0 } },
+    { 0x400000000ULL, 0x400000010000000ULL, { 34, 33, -1 }, { 2, 4, 0 } },
+    { 0x20000000ULL, 0x20000001000000ULL, { 29, 23, -1 }, { 3, 1, 0 } },
+    { 0x20000000ULL, 0x800000001000000ULL, { 29, 35, -1 }, { 3, 2, 0 } },
+    { 0x8000000ULL, 0x8000000800000ULL, { 27, 21, -1 }, { 4, 1, 0 } },
+    { 0x8000000ULL, 0x200000000800000ULL, { 27, 33, -1 }, { 4, 2, 0 } },
+    { 0x8000000ULL, 0xc00000ULL, { 27, 26, -1 }, { 4, 4, 0 } },
+    { 0x410000ULL, 0x10410000000000ULL, { 22, 16, 10 }, { 1, 1, 1 } },
+    { 0x410000ULL, 0x10400000004000ULL, { 22, 16, 17 }, { 1, 1, 3 } },
+    { 0x410000ULL, 0x10400000002000ULL, { 22, 16, 15 }, { 1, 1, 4 } },
+    { 0xc00000ULL, 0x10800000080000ULL, { 22, 23, 17 }, { 1, 3, 1 } },
+    { 0xc00000ULL, 0x30000000080000ULL, { 22, 23, 29 }, { 1, 3, 2 } },
+    { 0x600000ULL, 0x10200000040000ULL, { 22, 21, 15 }, { 1, 4, 1 } },
+    { 0x600000ULL, 0x18000000040000ULL, { 22, 21, 27 }, { 1, 4, 2 } },
+    { 0x600000ULL, 0x10000000060000ULL, { 22, 21, 20 }, { 1, 4, 4 } },
+    { 0xc00000000ULL, 0xc00000020000000ULL, { 34, 35, 29 }, { 2, 3, 1 } },
+    { 0x600000000ULL, 0x600000010000000ULL, { 34, 33, 27 }, { 2, 4, 1 } },
+    { 0x600000000ULL, 0x400000018000000ULL, { 34, 33, 32 }, { 2, 4, 4 } },
+    { 0x20800000ULL, 0x20800001000000ULL, { 29, 23, 17 }, { 3, 1, 1 } },
+    { 0x20800000ULL, 0x20000001080000ULL, { 29, 23, 22 }, { 3, 1, 4 } },
+    { 0x820000000ULL, 0x800000021000000ULL, { 29, 35, 34 }, { 3, 2, 4 } },
+    { 0x8200000ULL, 0x8200000800000ULL, { 27, 21, 15 }, { 4, 1, 1 } },
+    { 0x8200000ULL, 0x8000000840000ULL, { 27, 21, 22 }, { 4, 1, 3 } },
+    { 0x8200000ULL, 0x8000000820000ULL, { 27, 21, 20 }, { 4, 1, 4 } },
+    { 0x208000000ULL, 0x200000010800000ULL, { 27, 33, 34 }, { 4, 2, 3 } },
+    { 0x208000000ULL, 0x200000008800000ULL, { 27, 33, 32 }, { 4, 2, 4 } },
+    { 0xc000000ULL, 0x4000000c00000ULL, { 27, 26, 20 }, { 4, 4, 1 } },
+    { 0xc000000ULL, 0x100000000c00000ULL, { 27, 26, 32 }, { 4, 4, 2 } },
+    { 0xc000000ULL, 0xe00000ULL, { 27, 26, 25 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x20000000000000ULL, { 23, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x800000000000000ULL, { 35, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x1000000ULL, { 28, -1, -1 }, { 4, 0, 0 } },
+    { 0x800000ULL, 0x20800000000000ULL, { 23, 17, -1 }, { 1, 1, 0 } },
+    { 0x800000ULL, 0x20000000080000ULL, { 23, 22, -1 }, { 1, 4, 0 } },
+    { 0x800000000ULL, 0x800000020000000ULL, { 35, 34, -1 }, { 2, 4, 0 } },
+    { 0x10000000ULL, 0x10000001000000ULL, { 28, 22, -1 }, { 4, 1, 0 } },
+    { 0x10000000ULL, 0x400000001000000ULL, { 28, 34, -1 }, { 4, 2, 0 } },
+    { 0x10000000ULL, 0x1800000ULL, { 28, 27, -1 }, { 4, 4, 0 } },
+    { 0x820000ULL, 0x20820000000000ULL, { 23, 17, 11 }, { 1, 1, 1 } },
+    { 0x820000ULL, 0x20800000004000ULL, { 23, 17, 16 }, { 1, 1, 4 } },
+    { 0xc00000ULL, 0x20400000080000ULL, { 23, 22, 16 }, { 1, 4, 1 } },
+    { 0xc00000ULL, 0x30000000080000ULL, { 23, 22, 28 }, { 1, 4, 2 } },
+    { 0xc00000ULL, 0x200000000c0000ULL, { 23, 22, 21 }, { 1, 4, 4 } },
+    { 0xc00000000ULL, 0xc00000020000000ULL, { 35, 34, 28 }, { 2, 4, 1 } },
+    { 0xc00000000ULL, 0x800000030000000ULL, { 35, 34, 33 }, { 2, 4, 4 } },
+    { 0x10400000ULL, 0x10400001000000ULL, { 28, 22, 16 }, { 4, 1, 1 } },
+    { 0x10400000ULL, 0x10000001080000ULL, { 28, 22, 23 }, { 4, 1, 3 } },
+    { 0x10400000ULL, 0x10000001040000ULL, { 28, 22, 21 }, { 4, 1, 4 } },
+    { 0x410000000ULL, 0x400000021000000ULL, { 28, 34, 35 }, { 4, 2, 3 } },
+    { 0x410000000ULL, 0x400000011000000ULL, { 28, 34, 33 }, { 4, 2, 4 } },
+    { 0x18000000ULL, 0x8000001800000ULL, { 28, 27, 21 }, { 4, 4, 1 } },
+    { 0x18000000ULL, 0x200000001800000ULL, { 28, 27, 33 }, { 4, 4, 2 } },
+    { 0x18000000ULL, 0x1c00000ULL, { 28, 27, 26 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x40000000000000ULL, { 24, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x2000000ULL, { 31, -1, -1 }, { 3, 0, 0 } },
+    { 0x1000000ULL, 0x41000000000000ULL, { 24, 18, -1 }, { 1, 1, 0 } },
+    { 0x1000000ULL, 0x40000000100000ULL, { 24, 25, -1 }, { 1, 3, 0 } },
+    { 0x80000000ULL, 0x80000002000000ULL, { 31, 25, -1 }, { 3, 1, 0 } },
+    { 0x80000000ULL, 0x6000000ULL, { 31, 32, -1 }, { 3, 3, 0 } },
+    { 0x1040000ULL, 0x41040000000000ULL, { 24, 18, 12 }, { 1, 1, 1 } },
+    { 0x1040000ULL, 0x41000000008000ULL, { 24, 18, 19 }, { 1, 1, 3 } },
+    { 0x3000000ULL, 0x42000000100000ULL, { 24, 25, 19 }, { 1, 3, 1 } },
+    { 0x3000000ULL, 0xc0000000100000ULL, { 24, 25, 31 }, { 1, 3, 2 } },
+    { 0x3000000ULL, 0x40000000300000ULL, { 24, 25, 26 }, { 1, 3, 3 } },
+    { 0x82000000ULL, 0x82000002000000ULL, { 31, 25, 19 }, { 3, 1, 1 } },
+    { 0x82000000ULL, 0x80000002200000ULL, { 31, 25, 26 }, { 3, 1, 3 } },
+    { 0x82000000ULL, 0x80000002100000ULL, { 31, 25, 24 }, { 3, 1, 4 } },
+    { 0x180000000ULL, 0x100000006000000ULL, { 31, 32, 26 }, { 3, 3, 1 } },
+    { 0x180000000ULL, 0xe000000ULL, { 31, 32, 33 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x80000000000000ULL, { 25, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x4000000ULL, { 32, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x2000000ULL, { 30, -1, -1 }, { 4, 0, 0 } },
+    { 0x2000000ULL, 0x82000000000000ULL, { 25, 19, -1 }, { 1, 1, 0 } },
+    { 0x2000000ULL, 0x80000000200000ULL, { 25, 26, -1 }, { 1, 3, 0 } },
+    { 0x2000000ULL, 0x80000000100000ULL, { 25, 24, -1 }, { 1, 4, 0 } },
+    { 0x100000000ULL, 0x100000004000000ULL, { 32, 26, -1 }, { 3, 1, 0 } },
+    { 0x100000000ULL, 0xc000000ULL, { 32, 33, -1 }, { 3, 3, 0 } },
+    { 0x40000000ULL, 0x40000002000000ULL, { 30, 24, -1 }, { 4, 1, 0 } },
+    { 0x2080000ULL, 0x82080000000000ULL, { 25, 19, 13 }, { 1, 1, 1 } },
+    { 0x2080000ULL, 0x82000000010000ULL, { 25, 19, 20 }, { 1, 1, 3 } },
+    { 0x2080000ULL, 0x82000000008000ULL, { 25, 19, 18 }, { 1, 1, 4 } },
+    { 0x6000000ULL, 0x84000000200000ULL, { 25, 26, 20 }, { 1, 3, 1 } },
+    { 0x6000000ULL, 0x180000000200000ULL, { 25, 26, 32 }, { 1, 3, 2 } },
+    { 0x6000000ULL, 0x80000000600000ULL, { 25, 26, 27 }, { 1, 3, 3 } },
+    { 0x3000000ULL, 0x81000000100000ULL, { 25, 24, 18 }, { 1, 4, 1 } },
+    { 0x3000000ULL, 0xc0000000100000ULL, { 25, 24, 30 }, { 1, 4, 2 } },
+    { 0x104000000ULL, 0x104000004000000ULL, { 32, 26, 20 }, { 3, 1, 1 } },
+    { 0x104000000ULL, 0x100000004400000ULL, { 32, 26, 27 }, { 3, 1, 3 } },
+    { 0x104000000ULL, 0x100000004200000ULL, { 32, 26, 25 }, { 3, 1, 4 } },
+    { 0x300000000ULL, 0x20000000c000000ULL, { 32, 33, 27 }, { 3, 3, 1 } },
+    { 0x300000000ULL, 0x1c000000ULL, { 32, 33, 34 }, { 3, 3, 3 } },
+    { 0x41000000ULL, 0x41000002000000ULL, { 30, 24, 18 }, { 4, 1, 1 } },
+    { 0x41000000ULL, 0x40000002100000ULL, { 30, 24, 25 }, { 4, 1, 3 } },
+    { 0x0ULL, 0x100000000000000ULL, { 26, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x8000000ULL, { 33, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x4000000ULL, { 31, -1, -1 }, { 4, 0, 0 } },
+    { 0x4000000ULL, 0x104000000000000ULL, { 26, 20, -1 }, { 1, 1, 0 } },
+    { 0x4000000ULL, 0x100000000400000ULL, { 26, 27, -1 }, { 1, 3, 0 } },
+    { 0x4000000ULL, 0x100000000200000ULL, { 26, 25, -1 }, { 1, 4, 0 } },
+    { 0x200000000ULL, 0x200000008000000ULL, { 33, 27, -1 }, { 3, 1, 0 } },
+    { 0x200000000ULL, 0x18000000ULL, { 33, 34, -1 }, { 3, 3, 0 } },
+    { 0x80000000ULL, 0x80000004000000ULL, { 31, 25, -1 }, { 4, 1, 0 } },
+    { 0x80000000ULL, 0x6000000ULL, { 31, 30, -1 }, { 4, 4, 0 } },
+    { 0x4100000ULL, 0x104100000000000ULL, { 26, 20, 14 }, { 1, 1, 1 } },
+    { 0x4100000ULL, 0x104000000020000ULL, { 26, 20, 21 }, { 1, 1, 3 } },
+    { 0x4100000ULL, 0x104000000010000ULL, { 26, 20, 19 }, { 1, 1, 4 } },
+    { 0xc000000ULL, 0x108000000400000ULL, { 26, 27, 21 }, { 1, 3, 1 } },
+    { 0xc000000ULL, 0x300000000400000ULL, { 26, 27, 33 }, { 1, 3, 2 } },
+    { 0xc000000ULL, 0x100000000c00000ULL, { 26, 27, 28 }, { 1, 3, 3 } },
+    { 0x6000000ULL, 0x102000000200000ULL, { 26, 25, 19 }, { 1, 4, 1 } },
+    { 0x6000000ULL, 0x180000000200000ULL, { 26, 25, 31 }, { 1, 4, 2 } },
+    { 0x6000000ULL, 0x100000000300000ULL, { 26, 25, 24 }, { 1, 4, 4 } },
+    { 0x208000000ULL, 0x208000008000000ULL, { 33, 27, 21 }, { 3, 1, 1 } },
+    { 0x208000000ULL, 0x200000008800000ULL, { 33, 27, 28 }, { 3, 1, 3 } },
+    { 0x208000000ULL, 0x200000008400000ULL, { 33, 27, 26 }, { 3, 1, 4 } },
+    { 0x600000000ULL, 0x400000018000000ULL, { 33, 34, 28 }, { 3, 3, 1 } },
+    { 0x600000000ULL, 0x38000000ULL, { 33, 34, 35 }, { 3, 3, 3 } },
+    { 0x82000000ULL, 0x82000004000000ULL, { 31, 25, 19 }, { 4, 1, 1 } },
+    { 0x82000000ULL, 0x80000004200000ULL, { 31, 25, 26 }, { 4, 1, 3 } },
+    { 0x82000000ULL, 0x80000004100000ULL, { 31, 25, 24 }, { 4, 1, 4 } },
+    { 0xc0000000ULL, 0x40000006000000ULL, { 31, 30, 24 }, { 4, 4, 1 } },
+    { 0x0ULL, 0x200000000000000ULL, { 27, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x10000000ULL, { 34, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x8000000ULL, { 32, -1, -1 }, { 4, 0, 0 } },
+    { 0x8000000ULL, 0x208000000000000ULL, { 27, 21, -1 }, { 1, 1, 0 } },
+    { 0x8000000ULL, 0x200000000800000ULL, { 27, 28, -1 }, { 1, 3, 0 } },
+    { 0x8000000ULL, 0x200000000400000ULL, { 27, 26, -1 }, { 1, 4, 0 } },
+    { 0x400000000ULL, 0x400000010000000ULL, { 34, 28, -1 }, { 3, 1, 0 } },
+    { 0x400000000ULL, 0x30000000ULL, { 34, 35, -1 }, { 3, 3, 0 } },
+    { 0x100000000ULL, 0x100000008000000ULL, { 32, 26, -1 }, { 4, 1, 0 } },
+    { 0x100000000ULL, 0xc000000ULL, { 32, 31, -1 }, { 4, 4, 0 } },
+    { 0x8200000ULL, 0x208200000000000ULL, { 27, 21, 15 }, { 1, 1, 1 } },
+    { 0x8200000ULL, 0x208000000040000ULL, { 27, 21, 22 }, { 1, 1, 3 } },
+    { 0x8200000ULL, 0x208000000020000ULL, { 27, 21, 20 }, { 1, 1, 4 } },
+    { 0x18000000ULL, 0x210000000800000ULL, { 27, 28, 22 }, { 1, 3, 1 } },
+    { 0x18000000ULL, 0x600000000800000ULL, { 27, 28, 34 }, { 1, 3, 2 } },
+    { 0x18000000ULL, 0x200000001800000ULL, { 27, 28, 29 }, { 1, 3, 3 } },
+    { 0xc000000ULL, 0x204000000400000ULL, { 27, 26, 20 }, { 1, 4, 1 } },
+    { 0xc000000ULL, 0x300000000400000ULL, { 27, 26, 32 }, { 1, 4, 2 } },
+    { 0xc000000ULL, 0x200000000600000ULL, { 27, 26, 25 }, { 1, 4, 4 } },
+    { 0x410000000ULL, 0x410000010000000ULL, { 34, 28, 22 }, { 3, 1, 1 } },
+    { 0x410000000ULL, 0x400000011000000ULL, { 34, 28, 29 }, { 3, 1, 3 } },
+    { 0x410000000ULL, 0x400000010800000ULL, { 34, 28, 27 }, { 3, 1, 4 } },
+    { 0xc00000000ULL, 0x800000030000000ULL, { 34, 35, 29 }, { 3, 3, 1 } },
+    { 0x104000000ULL, 0x104000008000000ULL, { 32, 26, 20 }, { 4, 1, 1 } },
+    { 0x104000000ULL, 0x100000008400000ULL, { 32, 26, 27 }, { 4, 1, 3 } },
+    { 0x104000000ULL, 0x100000008200000ULL, { 32, 26, 25 }, { 4, 1, 4 } },
+    { 0x180000000ULL, 0x8000000c000000ULL, { 32, 31, 25 }, { 4, 4, 1 } },
+    { 0x180000000ULL, 0xe000000ULL, { 32, 31, 30 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x400000000000000ULL, { 28, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x20000000ULL, { 35, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x10000000ULL, { 33, -1, -1 }, { 4, 0, 0 } },
+    { 0x10000000ULL, 0x410000000000000ULL, { 28, 22, -1 }, { 1, 1, 0 } },
+    { 0x10000000ULL, 0x400000001000000ULL, { 28, 29, -1 }, { 1, 3, 0 } },
+    { 0x10000000ULL, 0x400000000800000ULL, { 28, 27, -1 }, { 1, 4, 0 } },
+    { 0x800000000ULL, 0x800000020000000ULL, { 35, 29, -1 }, { 3, 1, 0 } },
+    { 0x200000000ULL, 0x200000010000000ULL, { 33, 27, -1 }, { 4, 1, 0 } },
+    { 0x200000000ULL, 0x18000000ULL, { 33, 32, -1 }, { 4, 4, 0 } },
+    { 0x10400000ULL, 0x410400000000000ULL, { 28, 22, 16 }, { 1, 1, 1 } },
+    { 0x10400000ULL, 0x410000000080000ULL, { 28, 22, 23 }, { 1, 1, 3 } },
+    { 0x10400000ULL, 0x410000000040000ULL, { 28, 22, 21 }, { 1, 1, 4 } },
+    { 0x30000000ULL, 0x420000001000000ULL, { 28, 29, 23 }, { 1, 3, 1 } },
+    { 0x30000000ULL, 0xc00000001000000ULL, { 28, 29, 35 }, { 1, 3, 2 } },
+    { 0x18000000ULL, 0x408000000800000ULL, { 28, 27, 21 }, { 1, 4, 1 } },
+    { 0x18000000ULL, 0x600000000800000ULL, { 28, 27, 33 }, { 1, 4, 2 } },
+    { 0x18000000ULL, 0x400000000c00000ULL, { 28, 27, 26 }, { 1, 4, 4 } },
+    { 0x820000000ULL, 0x820000020000000ULL, { 35, 29, 23 }, { 3, 1, 1 } },
+    { 0x820000000ULL, 0x800000021000000ULL, { 35, 29, 28 }, { 3, 1, 4 } },
+    { 0x208000000ULL, 0x208000010000000ULL, { 33, 27, 21 }, { 4, 1, 1 } },
+    { 0x208000000ULL, 0x200000010800000ULL, { 33, 27, 28 }, { 4, 1, 3 } },
+    { 0x208000000ULL, 0x200000010400000ULL, { 33, 27, 26 }, { 4, 1, 4 } },
+    { 0x300000000ULL, 0x100000018000000ULL, { 33, 32, 26 }, { 4, 4, 1 } },
+    { 0x300000000ULL, 0x1c000000ULL, { 33, 32, 31 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x800000000000000ULL, { 29, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x20000000ULL, { 34, -1, -1 }, { 4, 0, 0 } },
+    { 0x20000000ULL, 0x820000000000000ULL, { 29, 23, -1 }, { 1, 1, 0 } },
+    { 0x20000000ULL, 0x800000001000000ULL, { 29, 28, -1 }, { 1, 4, 0 } },
+    { 0x400000000ULL, 0x400000020000000ULL, { 34, 28, -1 }, { 4, 1, 0 } },
+    { 0x400000000ULL, 0x30000000ULL, { 34, 33, -1 }, { 4, 4, 0 } },
+    { 0x20800000ULL, 0x820800000000000ULL, { 29, 23, 17 }, { 1, 1, 1 } },
+    { 0x20800000ULL, 0x820000000080000ULL, { 29, 23, 22 }, { 1, 1, 4 } },
+    { 0x30000000ULL, 0x810000001000000ULL, { 29, 28, 22 }, { 1, 4, 1 } },
+    { 0x30000000ULL, 0xc00000001000000ULL, { 29, 28, 34 }, { 1, 4, 2 } },
+    { 0x30000000ULL, 0x800000001800000ULL, { 29, 28, 27 }, { 1, 4, 4 } },
+    { 0x410000000ULL, 0x410000020000000ULL, { 34, 28, 22 }, { 4, 1, 1 } },
+    { 0x410000000ULL, 0x400000021000000ULL, { 34, 28, 29 }, { 4, 1, 3 } },
+    { 0x410000000ULL, 0x400000020800000ULL, { 34, 28, 27 }, { 4, 1, 4 } },
+    { 0x600000000ULL, 0x200000030000000ULL, { 34, 33, 27 }, { 4, 4, 1 } },
+    { 0x600000000ULL, 0x38000000ULL, { 34, 33, 32 }, { 4, 4, 4 } },
+};
+
+const unsigned short walk_first[NB_SQUARES][NB_SIZE + 2] = {
+    { 0, 0, 2, 6, 16 },
+    { 16, 16, 19, 25, 40 },
+    { 40, 40, 43, 50, 68 },
+    { 68, 68, 71, 78, 96 },
+    { 96, 96, 99, 105, 120 },
+    { 120, 120, 122, 126, 136 },
+    { 136, 136, 139, 145, 160 },
+    { 160, 160, 164, 174, 196 },
+    { 196, 196, 200, 211, 239 },
+    { 239, 239, 243, 254, 282 },
+    { 282, 282, 286, 296, 318 },
+    { 318, 318, 321, 327, 342 },
+    { 342, 342, 345, 352, 370 },
+    { 370, 370, 374, 385, 413 },
+    { 413, 413, 417, 429, 463 },
+    { 463, 463, 467, 479, 513 },
+    { 513, 513, 517, 528, 556 },
+    { 556, 556, 559, 566, 584 },
+    { 584, 584, 587, 594, 612 },
+    { 612, 612, 616, 627, 655 },
+    { 655, 655, 659, 671, 705 },
+    { 705, 705, 709, 721, 755 },
+    { 755, 755, 759, 770, 798 },
+    { 798, 798, 801, 808, 826 },
+    { 826, 826, 829, 835, 850 },
+    { 850, 850, 854, 864, 886 },
+    { 886, 886, 890, 901, 929 },
+    { 929, 929, 933, 944, 972 },
+    { 972, 972, 976, 986, 1008 },
+    { 1008, 1008, 1011, 1017, 1032 },
+    { 1032, 1032, 1034, 1038, 1048 },
+    { 1048, 1048, 1051, 1057, 1072 },
+    { 1072, 1072, 1075, 1082, 1100 },
+    { 1100, 1100, 1103, 1110, 1128 },
+    { 1128, 1128, 1131, 1137, 1152 },
+    { 1152, 1152, 1154, 1158, 1168 },
+};
@@ -0,0 +1,412 @@
+// Fichier généré par gen_walks.c, ne pas modifier à la main.
+#include "walks.h"
+
+#if DIMENSION != 4
+#error "table générée pour DIMENSION 4 : relancer gen_walks"
+#endif
+
+const walk walk_table[384] = {
+    { 0x0ULL, 0x1000ULL, { 4, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x1ULL, { 1, -1, -1 }, { 3, 0, 0 } },
+    { 0x10ULL, 0x11000ULL, { 4, 8, -1 }, { 2, 2, 0 } },
+    { 0x10ULL, 0x1008ULL, { 4, 5, -1 }, { 2, 3, 0 } },
+    { 0x2ULL, 0x2001ULL, { 1, 5, -1 }, { 3, 2, 0 } },
+    { 0x2ULL, 0x3ULL, { 1, 2, -1 }, { 3, 3, 0 } },
+    { 0x110ULL, 0x111000ULL, { 4, 8, 12 }, { 2, 2, 2 } },
+    { 0x110ULL, 0x11040ULL, { 4, 8, 9 }, { 2, 2, 3 } },
+    { 0x30ULL, 0x3008ULL, { 4, 5, 1 }, { 2, 3, 1 } },
+    { 0x30ULL, 0x21008ULL, { 4, 5, 9 }, { 2, 3, 2 } },
+    { 0x30ULL, 0x1018ULL, { 4, 5, 6 }, { 2, 3, 3 } },
+    { 0x22ULL, 0x22001ULL, { 1, 5, 9 }, { 3, 2, 2 } },
+    { 0x22ULL, 0x2011ULL, { 1, 5, 6 }, { 3, 2, 3 } },
+    { 0x22ULL, 0x2009ULL, { 1, 5, 4 }, { 3, 2, 4 } },
+    { 0x6ULL, 0x4003ULL, { 1, 2, 6 }, { 3, 3, 2 } },
+    { 0x6ULL, 0x7ULL, { 1, 2, 3 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x2000ULL, { 5, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x2ULL, { 2, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x1ULL, { 0, -1, -1 }, { 4, 0, 0 } },
+    { 0x20ULL, 0x22000ULL, { 5, 9, -1 }, { 2, 2, 0 } },
+    { 0x20ULL, 0x2010ULL, { 5, 6, -1 }, { 2, 3, 0 } },
+    { 0x20ULL, 0x2008ULL, { 5, 4, -1 }, { 2, 4, 0 } },
+    { 0x4ULL, 0x4002ULL, { 2, 6, -1 }, { 3, 2, 0 } },
+    { 0x4ULL, 0x6ULL, { 2, 3, -1 }, { 3, 3, 0 } },
+    { 0x1ULL, 0x1001ULL, { 0, 4, -1 }, { 4, 2, 0 } },
+    { 0x220ULL, 0x222000ULL, { 5, 9, 13 }, { 2, 2, 2 } },
+    { 0x220ULL, 0x22080ULL, { 5, 9, 10 }, { 2, 2, 3 } },
+    { 0x220ULL, 0x22040ULL, { 5, 9, 8 }, { 2, 2, 4 } },
+    { 0x60ULL, 0x6010ULL, { 5, 6, 2 }, { 2, 3, 1 } },
+    { 0x60ULL, 0x42010ULL, { 5, 6, 10 }, { 2, 3, 2 } },
+    { 0x60ULL, 0x2030ULL, { 5, 6, 7 }, { 2, 3, 3 } },
+    { 0x30ULL, 0x3008ULL, { 5, 4, 0 }, { 2, 4, 1 } },
+    { 0x30ULL, 0x12008ULL, { 5, 4, 8 }, { 2, 4, 2 } },
+    { 0x44ULL, 0x44002ULL, { 2, 6, 10 }, { 3, 2, 2 } },
+    { 0x44ULL, 0x4022ULL, { 2, 6, 7 }, { 3, 2, 3 } },
+    { 0x44ULL, 0x4012ULL, { 2, 6, 5 }, { 3, 2, 4 } },
+    { 0xcULL, 0x8006ULL, { 2, 3, 7 }, { 3, 3, 2 } },
+    { 0x11ULL, 0x11001ULL, { 0, 4, 8 }, { 4, 2, 2 } },
+    { 0x11ULL, 0x1009ULL, { 0, 4, 5 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x4000ULL, { 6, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x4ULL, { 3, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x2ULL, { 1, -1, -1 }, { 4, 0, 0 } },
+    { 0x40ULL, 0x44000ULL, { 6, 10, -1 }, { 2, 2, 0 } },
+    { 0x40ULL, 0x4020ULL, { 6, 7, -1 }, { 2, 3, 0 } },
+    { 0x40ULL, 0x4010ULL, { 6, 5, -1 }, { 2, 4, 0 } },
+    { 0x8ULL, 0x8004ULL, { 3, 7, -1 }, { 3, 2, 0 } },
+    { 0x2ULL, 0x2002ULL, { 1, 5, -1 }, { 4, 2, 0 } },
+    { 0x2ULL, 0x3ULL, { 1, 0, -1 }, { 4, 4, 0 } },
+    { 0x440ULL, 0x444000ULL, { 6, 10, 14 }, { 2, 2, 2 } },
+    { 0x440ULL, 0x44100ULL, { 6, 10, 11 }, { 2, 2, 3 } },
+    { 0x440ULL, 0x44080ULL, { 6, 10, 9 }, { 2, 2, 4 } },
+    { 0xc0ULL, 0xc020ULL, { 6, 7, 3 }, { 2, 3, 1 } },
+    { 0xc0ULL, 0x84020ULL, { 6, 7, 11 }, { 2, 3, 2 } },
+    { 0x60ULL, 0x6010ULL, { 6, 5, 1 }, { 2, 4, 1 } },
+    { 0x60ULL, 0x24010ULL, { 6, 5, 9 }, { 2, 4, 2 } },
+    { 0x60ULL, 0x4018ULL, { 6, 5, 4 }, { 2, 4, 4 } },
+    { 0x88ULL, 0x88004ULL, { 3, 7, 11 }, { 3, 2, 2 } },
+    { 0x88ULL, 0x8024ULL, { 3, 7, 6 }, { 3, 2, 4 } },
+    { 0x22ULL, 0x22002ULL, { 1, 5, 9 }, { 4, 2, 2 } },
+    { 0x22ULL, 0x2012ULL, { 1, 5, 6 }, { 4, 2, 3 } },
+    { 0x22ULL, 0x200aULL, { 1, 5, 4 }, { 4, 2, 4 } },
+    { 0x3ULL, 0x1003ULL, { 1, 0, 4 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x8000ULL, { 7, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x4ULL, { 2, -1, -1 }, { 4, 0, 0 } },
+    { 0x80ULL, 0x88000ULL, { 7, 11, -1 }, { 2, 2, 0 } },
+    { 0x80ULL, 0x8020ULL, { 7, 6, -1 }, { 2, 4, 0 } },
+    { 0x4ULL, 0x4004ULL, { 2, 6, -1 }, { 4, 2, 0 } },
+    { 0x4ULL, 0x6ULL, { 2, 1, -1 }, { 4, 4, 0 } },
+    { 0x880ULL, 0x888000ULL, { 7, 11, 15 }, { 2, 2, 2 } },
+    { 0x880ULL, 0x88100ULL, { 7, 11, 10 }, { 2, 2, 4 } },
+    { 0xc0ULL, 0xc020ULL, { 7, 6, 2 }, { 2, 4, 1 } },
+    { 0xc0ULL, 0x48020ULL, { 7, 6, 10 }, { 2, 4, 2 } },
+    { 0xc0ULL, 0x8030ULL, { 7, 6, 5 }, { 2, 4, 4 } },
+    { 0x44ULL, 0x44004ULL, { 2, 6, 10 }, { 4, 2, 2 } },
+    { 0x44ULL, 0x4024ULL, { 2, 6, 7 }, { 4, 2, 3 } },
+    { 0x44ULL, 0x4014ULL, { 2, 6, 5 }, { 4, 2, 4 } },
+    { 0x6ULL, 0x2006ULL, { 2, 1, 5 }, { 4, 4, 2 } },
+    { 0x6ULL, 0x7ULL, { 2, 1, 0 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x1000ULL, { 0, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x10000ULL, { 8, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x8ULL, { 5, -1, -1 }, { 3, 0, 0 } },
+    { 0x1ULL, 0x1001ULL, { 0, 1, -1 }, { 1, 3, 0 } },
+    { 0x100ULL, 0x110000ULL, { 8, 12, -1 }, { 2, 2, 0 } },
+    { 0x100ULL, 0x10040ULL, { 8, 9, -1 }, { 2, 3, 0 } },
+    { 0x20ULL, 0x2008ULL, { 5, 1, -1 }, { 3, 1, 0 } },
+    { 0x20ULL, 0x20008ULL, { 5, 9, -1 }, { 3, 2, 0 } },
+    { 0x20ULL, 0x18ULL, { 5, 6, -1 }, { 3, 3, 0 } },
+    { 0x3ULL, 0x3001ULL, { 0, 1, 5 }, { 1, 3, 2 } },
+    { 0x3ULL, 0x1003ULL, { 0, 1, 2 }, { 1, 3, 3 } },
+    { 0x1100ULL, 0x110200ULL, { 8, 12, 13 }, { 2, 2, 3 } },
+    { 0x300ULL, 0x30040ULL, { 8, 9, 5 }, { 2, 3, 1 } },
+    { 0x300ULL, 0x210040ULL, { 8, 9, 13 }, { 2, 3, 2 } },
+    { 0x300ULL, 0x100c0ULL, { 8, 9, 10 }, { 2, 3, 3 } },
+    { 0x22ULL, 0x200aULL, { 5, 1, 2 }, { 3, 1, 3 } },
+    { 0x22ULL, 0x2009ULL, { 5, 1, 0 }, { 3, 1, 4 } },
+    { 0x220ULL, 0x220008ULL, { 5, 9, 13 }, { 3, 2, 2 } },
+    { 0x220ULL, 0x20088ULL, { 5, 9, 10 }, { 3, 2, 3 } },
+    { 0x220ULL, 0x20048ULL, { 5, 9, 8 }, { 3, 2, 4 } },
+    { 0x60ULL, 0x4018ULL, { 5, 6, 2 }, { 3, 3, 1 } },
+    { 0x60ULL, 0x40018ULL, { 5, 6, 10 }, { 3, 3, 2 } },
+    { 0x60ULL, 0x38ULL, { 5, 6, 7 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x2000ULL, { 1, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x20000ULL, { 9, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x10ULL, { 6, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x8ULL, { 4, -1, -1 }, { 4, 0, 0 } },
+    { 0x2ULL, 0x2002ULL, { 1, 2, -1 }, { 1, 3, 0 } },
+    { 0x2ULL, 0x2001ULL, { 1, 0, -1 }, { 1, 4, 0 } },
+    { 0x200ULL, 0x220000ULL, { 9, 13, -1 }, { 2, 2, 0 } },
+    { 0x200ULL, 0x20080ULL, { 9, 10, -1 }, { 2, 3, 0 } },
+    { 0x200ULL, 0x20040ULL, { 9, 8, -1 }, { 2, 4, 0 } },
+    { 0x40ULL, 0x4010ULL, { 6, 2, -1 }, { 3, 1, 0 } },
+    { 0x40ULL, 0x40010ULL, { 6, 10, -1 }, { 3, 2, 0 } },
+    { 0x40ULL, 0x30ULL, { 6, 7, -1 }, { 3, 3, 0 } },
+    { 0x10ULL, 0x1008ULL, { 4, 0, -1 }, { 4, 1, 0 } },
+    { 0x10ULL, 0x10008ULL, { 4, 8, -1 }, { 4, 2, 0 } },
+    { 0x6ULL, 0x6002ULL, { 1, 2, 6 }, { 1, 3, 2 } },
+    { 0x6ULL, 0x2006ULL, { 1, 2, 3 }, { 1, 3, 3 } },
+    { 0x3ULL, 0x3001ULL, { 1, 0, 4 }, { 1, 4, 2 } },
+    { 0x2200ULL, 0x220400ULL, { 9, 13, 14 }, { 2, 2, 3 } },
+    { 0x2200ULL, 0x220200ULL, { 9, 13, 12 }, { 2, 2, 4 } },
+    { 0x600ULL, 0x60080ULL, { 9, 10, 6 }, { 2, 3, 1 } },
+    { 0x600ULL, 0x420080ULL, { 9, 10, 14 }, { 2, 3, 2 } },
+    { 0x600ULL, 0x20180ULL, { 9, 10, 11 }, { 2, 3, 3 } },
+    { 0x300ULL, 0x30040ULL, { 9, 8, 4 }, { 2, 4, 1 } },
+    { 0x300ULL, 0x120040ULL, { 9, 8, 12 }, { 2, 4, 2 } },
+    { 0x44ULL, 0x4014ULL, { 6, 2, 3 }, { 3, 1, 3 } },
+    { 0x44ULL, 0x4012ULL, { 6, 2, 1 }, { 3, 1, 4 } },
+    { 0x440ULL, 0x440010ULL, { 6, 10, 14 }, { 3, 2, 2 } },
+    { 0x440ULL, 0x40110ULL, { 6, 10, 11 }, { 3, 2, 3 } },
+    { 0x440ULL, 0x40090ULL, { 6, 10, 9 }, { 3, 2, 4 } },
+    { 0xc0ULL, 0x8030ULL, { 6, 7, 3 }, { 3, 3, 1 } },
+    { 0xc0ULL, 0x80030ULL, { 6, 7, 11 }, { 3, 3, 2 } },
+    { 0x11ULL, 0x1009ULL, { 4, 0, 1 }, { 4, 1, 3 } },
+    { 0x110ULL, 0x110008ULL, { 4, 8, 12 }, { 4, 2, 2 } },
+    { 0x110ULL, 0x10048ULL, { 4, 8, 9 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x4000ULL, { 2, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x40000ULL, { 10, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x20ULL, { 7, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x10ULL, { 5, -1, -1 }, { 4, 0, 0 } },
+    { 0x4ULL, 0x4004ULL, { 2, 3, -1 }, { 1, 3, 0 } },
+    { 0x4ULL, 0x4002ULL, { 2, 1, -1 }, { 1, 4, 0 } },
+    { 0x400ULL, 0x440000ULL, { 10, 14, -1 }, { 2, 2, 0 } },
+    { 0x400ULL, 0x40100ULL, { 10, 11, -1 }, { 2, 3, 0 } },
+    { 0x400ULL, 0x40080ULL, { 10, 9, -1 }, { 2, 4, 0 } },
+    { 0x80ULL, 0x8020ULL, { 7, 3, -1 }, { 3, 1, 0 } },
+    { 0x80ULL, 0x80020ULL, { 7, 11, -1 }, { 3, 2, 0 } },
+    { 0x20ULL, 0x2010ULL, { 5, 1, -1 }, { 4, 1, 0 } },
+    { 0x20ULL, 0x20010ULL, { 5, 9, -1 }, { 4, 2, 0 } },
+    { 0x20ULL, 0x18ULL, { 5, 4, -1 }, { 4, 4, 0 } },
+    { 0xcULL, 0xc004ULL, { 2, 3, 7 }, { 1, 3, 2 } },
+    { 0x6ULL, 0x6002ULL, { 2, 1, 5 }, { 1, 4, 2 } },
+    { 0x6ULL, 0x4003ULL, { 2, 1, 0 }, { 1, 4, 4 } },
+    { 0x4400ULL, 0x440800ULL, { 10, 14, 15 }, { 2, 2, 3 } },
+    { 0x4400ULL, 0x440400ULL, { 10, 14, 13 }, { 2, 2, 4 } },
+    { 0xc00ULL, 0xc0100ULL, { 10, 11, 7 }, { 2, 3, 1 } },
+    { 0xc00ULL, 0x840100ULL, { 10, 11, 15 }, { 2, 3, 2 } },
+    { 0x600ULL, 0x60080ULL, { 10, 9, 5 }, { 2, 4, 1 } },
+    { 0x600ULL, 0x240080ULL, { 10, 9, 13 }, { 2, 4, 2 } },
+    { 0x600ULL, 0x400c0ULL, { 10, 9, 8 }, { 2, 4, 4 } },
+    { 0x88ULL, 0x8024ULL, { 7, 3, 2 }, { 3, 1, 4 } },
+    { 0x880ULL, 0x880020ULL, { 7, 11, 15 }, { 3, 2, 2 } },
+    { 0x880ULL, 0x80120ULL, { 7, 11, 10 }, { 3, 2, 4 } },
+    { 0x22ULL, 0x2012ULL, { 5, 1, 2 }, { 4, 1, 3 } },
+    { 0x22ULL, 0x2011ULL, { 5, 1, 0 }, { 4, 1, 4 } },
+    { 0x220ULL, 0x220010ULL, { 5, 9, 13 }, { 4, 2, 2 } },
+    { 0x220ULL, 0x20090ULL, { 5, 9, 10 }, { 4, 2, 3 } },
+    { 0x220ULL, 0x20050ULL, { 5, 9, 8 }, { 4, 2, 4 } },
+    { 0x30ULL, 0x1018ULL, { 5, 4, 0 }, { 4, 4, 1 } },
+    { 0x30ULL, 0x10018ULL, { 5, 4, 8 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x8000ULL, { 3, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x80000ULL, { 11, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x20ULL, { 6, -1, -1 }, { 4, 0, 0 } },
+    { 0x8ULL, 0x8004ULL, { 3, 2, -1 }, { 1, 4, 0 } },
+    { 0x800ULL, 0x880000ULL, { 11, 15, -1 }, { 2, 2, 0 } },
+    { 0x800ULL, 0x80100ULL, { 11, 10, -1 }, { 2, 4, 0 } },
+    { 0x40ULL, 0x4020ULL, { 6, 2, -1 }, { 4, 1, 0 } },
+    { 0x40ULL, 0x40020ULL, { 6, 10, -1 }, { 4, 2, 0 } },
+    { 0x40ULL, 0x30ULL, { 6, 5, -1 }, { 4, 4, 0 } },
+    { 0xcULL, 0xc004ULL, { 3, 2, 6 }, { 1, 4, 2 } },
+    { 0xcULL, 0x8006ULL, { 3, 2, 1 }, { 1, 4, 4 } },
+    { 0x8800ULL, 0x880800ULL, { 11, 15, 14 }, { 2, 2, 4 } },
+    { 0xc00ULL, 0xc0100ULL, { 11, 10, 6 }, { 2, 4, 1 } },
+    { 0xc00ULL, 0x480100ULL, { 11, 10, 14 }, { 2, 4, 2 } },
+    { 0xc00ULL, 0x80180ULL, { 11, 10, 9 }, { 2, 4, 4 } },
+    { 0x44ULL, 0x4024ULL, { 6, 2, 3 }, { 4, 1, 3 } },
+    { 0x44ULL, 0x4022ULL, { 6, 2, 1 }, { 4, 1, 4 } },
+    { 0x440ULL, 0x440020ULL, { 6, 10, 14 }, { 4, 2, 2 } },
+    { 0x440ULL, 0x40120ULL, { 6, 10, 11 }, { 4, 2, 3 } },
+    { 0x440ULL, 0x400a0ULL, { 6, 10, 9 }, { 4, 2, 4 } },
+    { 0x60ULL, 0x2030ULL, { 6, 5, 1 }, { 4, 4, 1 } },
+    { 0x60ULL, 0x20030ULL, { 6, 5, 9 }, { 4, 4, 2 } },
+    { 0x60ULL, 0x38ULL, { 6, 5, 4 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x10000ULL, { 4, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x100000ULL, { 12, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x40ULL, { 9, -1, -1 }, { 3, 0, 0 } },
+    { 0x10ULL, 0x11000ULL, { 4, 0, -1 }, { 1, 1, 0 } },
+    { 0x10ULL, 0x10008ULL, { 4, 5, -1 }, { 1, 3, 0 } },
+    { 0x1000ULL, 0x100200ULL, { 12, 13, -1 }, { 2, 3, 0 } },
+    { 0x200ULL, 0x20040ULL, { 9, 5, -1 }, { 3, 1, 0 } },
+    { 0x200ULL, 0x200040ULL, { 9, 13, -1 }, { 3, 2, 0 } },
+    { 0x200ULL, 0xc0ULL, { 9, 10, -1 }, { 3, 3, 0 } },
+    { 0x11ULL, 0x11001ULL, { 4, 0, 1 }, { 1, 1, 3 } },
+    { 0x30ULL, 0x12008ULL, { 4, 5, 1 }, { 1, 3, 1 } },
+    { 0x30ULL, 0x30008ULL, { 4, 5, 9 }, { 1, 3, 2 } },
+    { 0x30ULL, 0x10018ULL, { 4, 5, 6 }, { 1, 3, 3 } },
+    { 0x3000ULL, 0x300200ULL, { 12, 13, 9 }, { 2, 3, 1 } },
+    { 0x3000ULL, 0x100600ULL, { 12, 13, 14 }, { 2, 3, 3 } },
+    { 0x220ULL, 0x22040ULL, { 9, 5, 1 }, { 3, 1, 1 } },
+    { 0x220ULL, 0x20050ULL, { 9, 5, 6 }, { 3, 1, 3 } },
+    { 0x220ULL, 0x20048ULL, { 9, 5, 4 }, { 3, 1, 4 } },
+    { 0x2200ULL, 0x200440ULL, { 9, 13, 14 }, { 3, 2, 3 } },
+    { 0x2200ULL, 0x200240ULL, { 9, 13, 12 }, { 3, 2, 4 } },
+    { 0x600ULL, 0x400c0ULL, { 9, 10, 6 }, { 3, 3, 1 } },
+    { 0x600ULL, 0x4000c0ULL, { 9, 10, 14 }, { 3, 3, 2 } },
+    { 0x600ULL, 0x1c0ULL, { 9, 10, 11 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x20000ULL, { 5, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x200000ULL, { 13, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x80ULL, { 10, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x40ULL, { 8, -1, -1 }, { 4, 0, 0 } },
+    { 0x20ULL, 0x22000ULL, { 5, 1, -1 }, { 1, 1, 0 } },
+    { 0x20ULL, 0x20010ULL, { 5, 6, -1 }, { 1, 3, 0 } },
+    { 0x20ULL, 0x20008ULL, { 5, 4, -1 }, { 1, 4, 0 } },
+    { 0x2000ULL, 0x200400ULL, { 13, 14, -1 }, { 2, 3, 0 } },
+    { 0x2000ULL, 0x200200ULL, { 13, 12, -1 }, { 2, 4, 0 } },
+    { 0x400ULL, 0x40080ULL, { 10, 6, -1 }, { 3, 1, 0 } },
+    { 0x400ULL, 0x400080ULL, { 10, 14, -1 }, { 3, 2, 0 } },
+    { 0x400ULL, 0x180ULL, { 10, 11, -1 }, { 3, 3, 0 } },
+    { 0x100ULL, 0x10040ULL, { 8, 4, -1 }, { 4, 1, 0 } },
+    { 0x100ULL, 0x100040ULL, { 8, 12, -1 }, { 4, 2, 0 } },
+    { 0x22ULL, 0x22002ULL, { 5, 1, 2 }, { 1, 1, 3 } },
+    { 0x22ULL, 0x22001ULL, { 5, 1, 0 }, { 1, 1, 4 } },
+    { 0x60ULL, 0x24010ULL, { 5, 6, 2 }, { 1, 3, 1 } },
+    { 0x60ULL, 0x60010ULL, { 5, 6, 10 }, { 1, 3, 2 } },
+    { 0x60ULL, 0x20030ULL, { 5, 6, 7 }, { 1, 3, 3 } },
+    { 0x30ULL, 0x21008ULL, { 5, 4, 0 }, { 1, 4, 1 } },
+    { 0x30ULL, 0x30008ULL, { 5, 4, 8 }, { 1, 4, 2 } },
+    { 0x6000ULL, 0x600400ULL, { 13, 14, 10 }, { 2, 3, 1 } },
+    { 0x6000ULL, 0x200c00ULL, { 13, 14, 15 }, { 2, 3, 3 } },
+    { 0x3000ULL, 0x300200ULL, { 13, 12, 8 }, { 2, 4, 1 } },
+    { 0x440ULL, 0x44080ULL, { 10, 6, 2 }, { 3, 1, 1 } },
+    { 0x440ULL, 0x400a0ULL, { 10, 6, 7 }, { 3, 1, 3 } },
+    { 0x440ULL, 0x40090ULL, { 10, 6, 5 }, { 3, 1, 4 } },
+    { 0x4400ULL, 0x400880ULL, { 10, 14, 15 }, { 3, 2, 3 } },
+    { 0x4400ULL, 0x400480ULL, { 10, 14, 13 }, { 3, 2, 4 } },
+    { 0xc00ULL, 0x80180ULL, { 10, 11, 7 }, { 3, 3, 1 } },
+    { 0xc00ULL, 0x800180ULL, { 10, 11, 15 }, { 3, 3, 2 } },
+    { 0x110ULL, 0x11040ULL, { 8, 4, 0 }, { 4, 1, 1 } },
+    { 0x110ULL, 0x10048ULL, { 8, 4, 5 }, { 4, 1, 3 } },
+    { 0x1100ULL, 0x100240ULL, { 8, 12, 13 }, { 4, 2, 3 } },
+    { 0x0ULL, 0x40000ULL, { 6, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x400000ULL, { 14, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x100ULL, { 11, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x80ULL, { 9, -1, -1 }, { 4, 0, 0 } },
+    { 0x40ULL, 0x44000ULL, { 6, 2, -1 }, { 1, 1, 0 } },
+    { 0x40ULL, 0x40020ULL, { 6, 7, -1 }, { 1, 3, 0 } },
+    { 0x40ULL, 0x40010ULL, { 6, 5, -1 }, { 1, 4, 0 } },
+    { 0x4000ULL, 0x400800ULL, { 14, 15, -1 }, { 2, 3, 0 } },
+    { 0x4000ULL, 0x400400ULL, { 14, 13, -1 }, { 2, 4, 0 } },
+    { 0x800ULL, 0x80100ULL, { 11, 7, -1 }, { 3, 1, 0 } },
+    { 0x800ULL, 0x800100ULL, { 11, 15, -1 }, { 3, 2, 0 } },
+    { 0x200ULL, 0x20080ULL, { 9, 5, -1 }, { 4, 1, 0 } },
+    { 0x200ULL, 0x200080ULL, { 9, 13, -1 }, { 4, 2, 0 } },
+    { 0x200ULL, 0xc0ULL, { 9, 8, -1 }, { 4, 4, 0 } },
+    { 0x44ULL, 0x44004ULL, { 6, 2, 3 }, { 1, 1, 3 } },
+    { 0x44ULL, 0x44002ULL, { 6, 2, 1 }, { 1, 1, 4 } },
+    { 0xc0ULL, 0x48020ULL, { 6, 7, 3 }, { 1, 3, 1 } },
+    { 0xc0ULL, 0xc0020ULL, { 6, 7, 11 }, { 1, 3, 2 } },
+    { 0x60ULL, 0x42010ULL, { 6, 5, 1 }, { 1, 4, 1 } },
+    { 0x60ULL, 0x60010ULL, { 6, 5, 9 }, { 1, 4, 2 } },
+    { 0x60ULL, 0x40018ULL, { 6, 5, 4 }, { 1, 4, 4 } },
+    { 0xc000ULL, 0xc00800ULL, { 14, 15, 11 }, { 2, 3, 1 } },
+    { 0x6000ULL, 0x600400ULL, { 14, 13, 9 }, { 2, 4, 1 } },
+    { 0x6000ULL, 0x400600ULL, { 14, 13, 12 }, { 2, 4, 4 } },
+    { 0x880ULL, 0x88100ULL, { 11, 7, 3 }, { 3, 1, 1 } },
+    { 0x880ULL, 0x80120ULL, { 11, 7, 6 }, { 3, 1, 4 } },
+    { 0x8800ULL, 0x800900ULL, { 11, 15, 14 }, { 3, 2, 4 } },
+    { 0x220ULL, 0x22080ULL, { 9, 5, 1 }, { 4, 1, 1 } },
+    { 0x220ULL, 0x20090ULL, { 9, 5, 6 }, { 4, 1, 3 } },
+    { 0x220ULL, 0x20088ULL, { 9, 5, 4 }, { 4, 1, 4 } },
+    { 0x2200ULL, 0x200480ULL, { 9, 13, 14 }, { 4, 2, 3 } },
+    { 0x2200ULL, 0x200280ULL, { 9, 13, 12 }, { 4, 2, 4 } },
+    { 0x300ULL, 0x100c0ULL, { 9, 8, 4 }, { 4, 4, 1 } },
+    { 0x300ULL, 0x1000c0ULL, { 9, 8, 12 }, { 4, 4, 2 } },
+    { 0x0ULL, 0x80000ULL, { 7, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x800000ULL, { 15, -1, -1 }, { 2, 0, 0 } },
+    { 0x0ULL, 0x100ULL, { 10, -1, -1 }, { 4, 0, 0 } },
+    { 0x80ULL, 0x88000ULL, { 7, 3, -1 }, { 1, 1, 0 } },
+    { 0x80ULL, 0x80020ULL, { 7, 6, -1 }, { 1, 4, 0 } },
+    { 0x8000ULL, 0x800800ULL, { 15, 14, -1 }, { 2, 4, 0 } },
+    { 0x400ULL, 0x40100ULL, { 10, 6, -1 }, { 4, 1, 0 } },
+    { 0x400ULL, 0x400100ULL, { 10, 14, -1 }, { 4, 2, 0 } },
+    { 0x400ULL, 0x180ULL, { 10, 9, -1 }, { 4, 4, 0 } },
+    { 0x88ULL, 0x88004ULL, { 7, 3, 2 }, { 1, 1, 4 } },
+    { 0xc0ULL, 0x84020ULL, { 7, 6, 2 }, { 1, 4, 1 } },
+    { 0xc0ULL, 0xc0020ULL, { 7, 6, 10 }, { 1, 4, 2 } },
+    { 0xc0ULL, 0x80030ULL, { 7, 6, 5 }, { 1, 4, 4 } },
+    { 0xc000ULL, 0xc00800ULL, { 15, 14, 10 }, { 2, 4, 1 } },
+    { 0xc000ULL, 0x800c00ULL, { 15, 14, 13 }, { 2, 4, 4 } },
+    { 0x440ULL, 0x44100ULL, { 10, 6, 2 }, { 4, 1, 1 } },
+    { 0x440ULL, 0x40120ULL, { 10, 6, 7 }, { 4, 1, 3 } },
+    { 0x440ULL, 0x40110ULL, { 10, 6, 5 }, { 4, 1, 4 } },
+    { 0x4400ULL, 0x400900ULL, { 10, 14, 15 }, { 4, 2, 3 } },
+    { 0x4400ULL, 0x400500ULL, { 10, 14, 13 }, { 4, 2, 4 } },
+    { 0x600ULL, 0x20180ULL, { 10, 9, 5 }, { 4, 4, 1 } },
+    { 0x600ULL, 0x200180ULL, { 10, 9, 13 }, { 4, 4, 2 } },
+    { 0x600ULL, 0x1c0ULL, { 10, 9, 8 }, { 4, 4, 4 } },
+    { 0x0ULL, 0x100000ULL, { 8, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x200ULL, { 13, -1, -1 }, { 3, 0, 0 } },
+    { 0x100ULL, 0x110000ULL, { 8, 4, -1 }, { 1, 1, 0 } },
+    { 0x100ULL, 0x100040ULL, { 8, 9, -1 }, { 1, 3, 0 } },
+    { 0x2000ULL, 0x200200ULL, { 13, 9, -1 }, { 3, 1, 0 } },
+    { 0x2000ULL, 0x600ULL, { 13, 14, -1 }, { 3, 3, 0 } },
+    { 0x110ULL, 0x111000ULL, { 8, 4, 0 }, { 1, 1, 1 } },
+    { 0x110ULL, 0x110008ULL, { 8, 4, 5 }, { 1, 1, 3 } },
+    { 0x300ULL, 0x120040ULL, { 8, 9, 5 }, { 1, 3, 1 } },
+    { 0x300ULL, 0x300040ULL, { 8, 9, 13 }, { 1, 3, 2 } },
+    { 0x300ULL, 0x1000c0ULL, { 8, 9, 10 }, { 1, 3, 3 } },
+    { 0x2200ULL, 0x220200ULL, { 13, 9, 5 }, { 3, 1, 1 } },
+    { 0x2200ULL, 0x200280ULL, { 13, 9, 10 }, { 3, 1, 3 } },
+    { 0x2200ULL, 0x200240ULL, { 13, 9, 8 }, { 3, 1, 4 } },
+    { 0x6000ULL, 0x400600ULL, { 13, 14, 10 }, { 3, 3, 1 } },
+    { 0x6000ULL, 0xe00ULL, { 13, 14, 15 }, { 3, 3, 3 } },
+    { 0x0ULL, 0x200000ULL, { 9, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x400ULL, { 14, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x200ULL, { 12, -1, -1 }, { 4, 0, 0 } },
+    { 0x200ULL, 0x220000ULL, { 9, 5, -1 }, { 1, 1, 0 } },
+    { 0x200ULL, 0x200080ULL, { 9, 10, -1 }, { 1, 3, 0 } },
+    { 0x200ULL, 0x200040ULL, { 9, 8, -1 }, { 1, 4, 0 } },
+    { 0x4000ULL, 0x400400ULL, { 14, 10, -1 }, { 3, 1, 0 } },
+    { 0x4000ULL, 0xc00ULL, { 14, 15, -1 }, { 3, 3, 0 } },
+    { 0x1000ULL, 0x100200ULL, { 12, 8, -1 }, { 4, 1, 0 } },
+    { 0x220ULL, 0x222000ULL, { 9, 5, 1 }, { 1, 1, 1 } },
+    { 0x220ULL, 0x220010ULL, { 9, 5, 6 }, { 1, 1, 3 } },
+    { 0x220ULL, 0x220008ULL, { 9, 5, 4 }, { 1, 1, 4 } },
+    { 0x600ULL, 0x240080ULL, { 9, 10, 6 }, { 1, 3, 1 } },
+    { 0x600ULL, 0x600080ULL, { 9, 10, 14 }, { 1, 3, 2 } },
+    { 0x600ULL, 0x200180ULL, { 9, 10, 11 }, { 1, 3, 3 } },
+    { 0x300ULL, 0x210040ULL, { 9, 8, 4 }, { 1, 4, 1 } },
+    { 0x300ULL, 0x300040ULL, { 9, 8, 12 }, { 1, 4, 2 } },
+    { 0x4400ULL, 0x440400ULL, { 14, 10, 6 }, { 3, 1, 1 } },
+    { 0x4400ULL, 0x400500ULL, { 14, 10, 11 }, { 3, 1, 3 } },
+    { 0x4400ULL, 0x400480ULL, { 14, 10, 9 }, { 3, 1, 4 } },
+    { 0xc000ULL, 0x800c00ULL, { 14, 15, 11 }, { 3, 3, 1 } },
+    { 0x1100ULL, 0x110200ULL, { 12, 8, 4 }, { 4, 1, 1 } },
+    { 0x1100ULL, 0x100240ULL, { 12, 8, 9 }, { 4, 1, 3 } },
+    { 0x0ULL, 0x400000ULL, { 10, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x800ULL, { 15, -1, -1 }, { 3, 0, 0 } },
+    { 0x0ULL, 0x400ULL, { 13, -1, -1 }, { 4, 0, 0 } },
+    { 0x400ULL, 0x440000ULL, { 10, 6, -1 }, { 1, 1, 0 } },
+    { 0x400ULL, 0x400100ULL, { 10, 11, -1 }, { 1, 3, 0 } },
+    { 0x400ULL, 0x400080ULL, { 10, 9, -1 }, { 1, 4, 0 } },
+    { 0x8000ULL, 0x800800ULL, { 15, 11, -1 }, { 3, 1, 0 } },
+    { 0x2000ULL, 0x200400ULL, { 13, 9, -1 }, { 4, 1, 0 } },
+    { 0x2000ULL, 0x600ULL, { 13, 12, -1 }, { 4, 4, 0 } },
+    { 0x440ULL, 0x444000ULL, { 10, 6, 2 }, { 1, 1, 1 } },
+    { 0x440ULL, 0x440020ULL, { 10, 6, 7 }, { 1, 1, 3 } },
+    { 0x440ULL, 0x440010ULL, { 10, 6, 5 }, { 1, 1, 4 } },
+    { 0xc00ULL, 0x480100ULL, { 10, 11, 7 }, { 1, 3, 1 } },
+    { 0xc00ULL, 0xc00100ULL, { 10, 11, 15 }, { 1, 3, 2 } },
+    { 0x600ULL, 0x420080ULL, { 10, 9, 5 }, { 1, 4, 1 } },
+    { 0x600ULL, 0x600080ULL, { 10, 9, 13 }, { 1, 4, 2 } },
+    { 0x600ULL, 0x4000c0ULL, { 10, 9, 8 }, { 1, 4, 4 } },
+    { 0x8800ULL, 0x880800ULL, { 15, 11, 7 }, { 3, 1, 1 } },
+    { 0x8800ULL, 0x800900ULL, { 15, 11, 10 }, { 3, 1, 4 } },
+    { 0x2200ULL, 0x220400ULL, { 13, 9, 5 }, { 4, 1, 1 } },
+    { 0x2200ULL, 0x200480ULL, { 13, 9, 10 }, { 4, 1, 3 } },
+    { 0x2200ULL, 0x200440ULL, { 13, 9, 8 }, { 4, 1, 4 } },
+    { 0x3000ULL, 0x100600ULL, { 13, 12, 8 }, { 4, 4, 1 } },
+    { 0x0ULL, 0x800000ULL, { 11, -1, -1 }, { 1, 0, 0 } },
+    { 0x0ULL, 0x800ULL, { 14, -1, -1 }, { 4, 0, 0 } },
+    { 0x800ULL, 0x880000ULL, { 11, 7, -1 }, { 1, 1, 0 } },
+    { 0x800ULL, 0x800100ULL, { 11, 10, -1 }, { 1, 4, 0 } },
+    { 0x4000ULL, 0x400800ULL, { 14, 10, -1 }, { 4, 1, 0 } },
+    { 0x4000ULL, 0xc00ULL, { 14, 13, -1 }, { 4, 4, 0 } },
+    { 0x880ULL, 0x888000ULL, { 11, 7, 3 }, { 1, 1, 1 } },
+    { 0x880ULL, 0x880020ULL, { 11, 7, 6 }, { 1, 1, 4 } },
+    { 0xc00ULL, 0x840100ULL, { 11, 10, 6 }, { 1, 4, 1 } },
+    { 0xc00ULL, 0xc00100ULL, { 11, 10, 14 }, { 1, 4, 2 } },
+    { 0xc00ULL, 0x800180ULL, { 11, 10, 9 }, { 1, 4, 4 } },
+    { 0x4400ULL, 0x440800ULL, { 14, 10, 6 }, { 4, 1, 1 } },
+    { 0x4400ULL, 0x400900ULL, { 14, 10, 11 }, { 4, 1, 3 } },
+    { 0x4400ULL, 0x400880ULL, { 14, 10, 9 }, { 4, 1, 4 } },
+    { 0x6000ULL, 0x200c00ULL, { 14, 13, 9 }, { 4, 4, 1 } },
+    { 0x6000ULL, 0xe00ULL, { 14, 13, 12 }, { 4, 4, 4 } },
+};
+
+const unsigned short walk_first[NB_SQUARES][NB_SIZE + 2] = {
+    { 0, 0, 2, 6, 16 },
+    { 16, 16, 19, 25, 39 },
+    { 39, 39, 42, 48, 62 },
+    { 62, 62, 64, 68, 78 },
+    { 78, 78, 81, 87, 101 },
+    { 101, 101, 105, 115, 135 },
+    { 135, 135, 139, 149, 169 },
+    { 169, 169, 172, 178, 192 },
+    { 192, 192, 195, 201, 215 },
+    { 215, 215, 219, 229, 249 },
+    { 249, 249, 253, 263, 283 },
+    { 283, 283, 286, 292, 306 },
+    { 306, 306, 308, 312, 322 },
+    { 322, 322, 325, 331, 345 },
+    { 345, 345, 348, 354, 368 },
+    { 368, 368, 370, 374, 384 },
+};